@@ -0,0 +1,1512 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+
+#include "../include/javltree.h"
+#include "../include/jcompactavltree.h"
+#include "../include/jwal.h"
+#include "../include/jmappedavltree.h"
+#include "../include/jbloomfilter.h"
+#include "../include/jlookupcache.h"
+#include "../include/jchunkedavltree.h"
+#include "../include/jintervaltree.h"
+#include "../include/jhashindex.h"
+#include "../include/jbufferedavltree.h"
+#include "../include/jingestqueue.h"
+#include "../include/jcharbitmap.h"
+#include "../include/jsmallavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 벤치마크에 사용할 키 개수
+#define BENCH_KEY_COUNT 1000000
+// 거의 정렬된 입력에서 키가 뒤섞이는 범위
+#define BENCH_SHUFFLE_WINDOW 16
+// 로그 벤치마크에 사용할 키 개수 (fsync 가 느리므로 따로 줄인다)
+#define BENCH_WAL_KEY_COUNT 2000
+// 문자열 키 벤치마크 키 개수
+#define BENCH_STRING_KEY_COUNT 200000
+// 로그 벤치마크 파일 경로
+#define BENCH_WAL_PATH "javltree_bench.log"
+// 스냅샷 벤치마크 파일 경로
+#define BENCH_SNAPSHOT_PATH "javltree_bench.snap"
+// 파일 기반 트리 벤치마크 파일 경로
+#define BENCH_MAPPED_PATH "javltree_bench.jav"
+// 삽입 버퍼 벤치마크에서 동시에 추가하는 스레드 개수
+#define BENCH_THREAD_COUNT 4
+// 작은 char 집합 벤치마크에서 만드는 집합 개수
+#define BENCH_CHAR_SET_COUNT 100000
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double GetNanoseconds()
+ * @brief 단조 증가하는 현재 시간을 나노초 단위로 반환하는 함수
+ * @return 현재 시간(ns)
+ */
+static double GetNanoseconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+/**
+ * @fn static void PrintResult(const char *name, double elapsed, int count)
+ * @brief 벤치마크 결과를 연산 당 나노초로 출력하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param elapsed 전체 소요 시간(ns)(입력)
+ * @param count 수행한 연산 횟수(입력)
+ * @return 반환값 없음
+ */
+static void PrintResult(const char *name, double elapsed, int count)
+{
+	printf("%-40s %10.1f ns/op\n", name, elapsed / count);
+}
+
+/**
+ * @fn static int CompareDouble(const void *value1, const void *value2)
+ * @brief qsort 에 사용하는 실수 오름차순 비교 함수
+ * @param value1 첫 번째 비교할 값의 주소(입력, 읽기 전용)
+ * @param value2 두 번째 비교할 값의 주소(입력, 읽기 전용)
+ * @return value1 이 작으면 -1, 같으면 0, 크면 1 반환
+ */
+static int CompareDouble(const void *value1, const void *value2)
+{
+	double left = *((const double*)value1);
+	double right = *((const double*)value2);
+	return (left > right) - (left < right);
+}
+
+/**
+ * @fn static void MakeMonotoneKeys(int *keys, int count)
+ * @brief 오름차순으로 정렬된 키를 만드는 함수
+ * @param keys 키를 저장할 배열(출력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void MakeMonotoneKeys(int *keys, int count)
+{
+	int index = 0;
+	for(; index < count; index++) keys[index] = index;
+}
+
+/**
+ * @fn static void MakeNearMonotoneKeys(int *keys, int count)
+ * @brief 정렬된 키를 작은 범위 안에서만 뒤섞어서 거의 정렬된 키를 만드는 함수
+ * 도착 순서가 조금씩 어긋나는 타임스탬프를 흉내낸다.
+ * @param keys 키를 저장할 배열(출력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void MakeNearMonotoneKeys(int *keys, int count)
+{
+	int index = 0;
+	MakeMonotoneKeys(keys, count);
+	for(; index + BENCH_SHUFFLE_WINDOW < count; index++)
+	{
+		int target = index + rand() % BENCH_SHUFFLE_WINDOW;
+		int temp = keys[index];
+		keys[index] = keys[target];
+		keys[target] = temp;
+	}
+}
+
+/**
+ * @fn static void MakeRandomKeys(int *keys, int count)
+ * @brief 중복 없이 무작위 순서로 섞인 키를 만드는 함수
+ * @param keys 키를 저장할 배열(출력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void MakeRandomKeys(int *keys, int count)
+{
+	int index = count - 1;
+	MakeMonotoneKeys(keys, count);
+	for(; index > 0; index--)
+	{
+		int target = rand() % (index + 1);
+		int temp = keys[index];
+		keys[index] = keys[target];
+		keys[target] = temp;
+	}
+}
+
+/**
+ * @fn static void SumIdentity(void *aggregate, void *userData)
+ * @brief 합계 집계 값의 항등원(0)을 만드는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void SumIdentity(void *aggregate, void *userData)
+{
+	(void)userData;
+	*((long long*)aggregate) = 0;
+}
+
+/**
+ * @fn static void SumLift(void *aggregate, const void *key, void *userData)
+ * @brief 정수 키 하나의 합계 집계 값을 만드는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param key 정수 키의 주소(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void SumLift(void *aggregate, const void *key, void *userData)
+{
+	(void)userData;
+	*((long long*)aggregate) = *((const int*)key);
+}
+
+/**
+ * @fn static void SumCombine(void *result, const void *left, const void *right, void *userData)
+ * @brief 두 합계 집계 값을 더하는 함수
+ * @param result 결합한 집계 값을 저장할 주소(출력)
+ * @param left 왼쪽 범위의 집계 값(입력, 읽기 전용)
+ * @param right 오른쪽 범위의 집계 값(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void SumCombine(void *result, const void *left, const void *right, void *userData)
+{
+	(void)userData;
+	*((long long*)result) = *((const long long*)left) + *((const long long*)right);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void BenchAddNode(const char *name, int *keys, int count)
+ * @brief 루트부터 탐색하는 JAVLTreeAddNode 의 삽입 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchAddNode(const char *name, int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int index = 0;
+
+	double start = GetNanoseconds();
+	for(; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	PrintResult(name, GetNanoseconds() - start, count);
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchAddNodeHint(const char *name, int *keys, int count)
+ * @brief 마지막 삽입 위치부터 탐색하는 JAVLTreeAddNodeHint 의 삽입 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchAddNodeHint(const char *name, int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int index = 0;
+
+	double start = GetNanoseconds();
+	for(; index < count; index++) JAVLTreeAddNodeHint(tree, NULL, &keys[index]);
+	PrintResult(name, GetNanoseconds() - start, count);
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchLookup(int *keys, int count)
+ * @brief 포인터 기반 AVL Tree 와 배열 기반 AVL Tree 의 무작위 조회 시간과 키 당 메모리를 비교하는 함수
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchLookup(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JCompactAVLTreePtr compactTree = NewJCompactAVLTree(IntType);
+	int index = 0;
+	int found = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		JAVLTreeAddNode(tree, &keys[index]);
+		JCompactAVLTreeAddKey(compactTree, &keys[index]);
+	}
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &keys[index]) != NULL);
+	PrintResult("Lookup (pointer nodes)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JCompactAVLTreeFindKey(compactTree, &keys[index]) == FindSuccess);
+	PrintResult("Lookup (compact nodes)", GetNanoseconds() - start, count);
+
+	// 포인터 기반 노드는 malloc 헤더(16 바이트)를 포함한 크기
+	printf("%-40s %10d bytes/key\n", "Memory (pointer nodes)", (int)(sizeof(JNode) + 16));
+	printf("%-40s %10.1f bytes/key\n", "Memory (compact nodes)", (double)sizeof(JCompactNode) * compactTree->capacity / count);
+	if(found != count * 2) printf("lookup mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	DeleteJCompactAVLTree(&compactTree);
+}
+
+/**
+ * @fn static void BenchFindBatch(int *keys, int count)
+ * @brief 키를 하나씩 찾는 JAVLTreeFindNode 와 묶어서 찾는 JAVLTreeFindBatch 의 조회 시간을 비교하는 함수
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchFindBatch(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	void **lookupKeys = (void**)malloc(sizeof(void*) * (size_t)count);
+	JNodePtr *results = (JNodePtr*)malloc(sizeof(JNodePtr) * (size_t)count);
+	int index = 0;
+	int found = 0;
+
+	if(lookupKeys == NULL || results == NULL) return;
+
+	for(index = 0; index < count; index++)
+	{
+		JAVLTreeAddNode(tree, &keys[index]);
+		lookupKeys[index] = &keys[(int)(((long long)index * 7919) % count)];
+	}
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, lookupKeys[index]) != NULL);
+	PrintResult("FindNode (one by one)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	found += JAVLTreeFindBatch(tree, lookupKeys, count, results);
+	PrintResult("FindBatch (prefetched groups)", GetNanoseconds() - start, count);
+	if(found != count * 2) printf("lookup mismatch\n");
+
+	free(lookupKeys);
+	free(results);
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchDeleteNodeKey(const char *name, int *keys, int count, int thresholdPercent)
+ * @brief 키 절반을 삭제하는 시간을 바로 삭제와 지연 삭제(삭제 표시)로 비교하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입, 삭제할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param thresholdPercent 지연 삭제 정리 임계값, 0 이면 바로 삭제(입력)
+ * @return 반환값 없음
+ */
+static void BenchDeleteNodeKey(const char *name, int *keys, int count, int thresholdPercent)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int index = 0;
+
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	JAVLTreeSetLazyDelete(tree, thresholdPercent);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index += 2) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	PrintResult(name, GetNanoseconds() - start, count / 2);
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchWAL(const char *name, int *keys, int count, int batchSize)
+ * @brief 로그가 연결된 트리의 삽입 시간을 그룹 커밋 크기별로 측정하는 함수
+ * 마지막에 JWALSync 까지 포함해서 모든 기록이 디스크에 남을 때까지의 시간을 잰다.
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param batchSize fsync 한 번에 묶을 기록 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchWAL(const char *name, int *keys, int count, int batchSize)
+{
+	JWALPolicy policy;
+	policy.batchSize = batchSize;
+	policy.windowMicros = 0;
+
+	remove(BENCH_WAL_PATH);
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JWALPtr wal = NewJWAL(BENCH_WAL_PATH, IntType, policy);
+	if(wal == NULL) return;
+	JAVLTreeAttachWAL(tree, wal);
+
+	int index = 0;
+	double start = GetNanoseconds();
+	for(; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	JWALSync(wal);
+	PrintResult(name, GetNanoseconds() - start, count);
+
+	DeleteJAVLTree(&tree);
+	DeleteJWAL(&wal);
+	remove(BENCH_WAL_PATH);
+}
+
+/**
+ * @fn static void BenchMappedOpen(int *keys, int count)
+ * @brief 스냅샷을 읽어 트리를 다시 만드는 시간과 파일 기반 트리를 여는 시간을 비교하는 함수
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchMappedOpen(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JMappedAVLTreePtr mappedTree = NULL;
+	int index = 0;
+	int found = 0;
+
+	remove(BENCH_MAPPED_PATH);
+	mappedTree = NewJMappedAVLTree(BENCH_MAPPED_PATH, IntType, MappedReadWrite);
+	if(mappedTree == NULL) return;
+
+	for(index = 0; index < count; index++)
+	{
+		JAVLTreeAddNode(tree, &keys[index]);
+		JMappedAVLTreeAddKey(mappedTree, &keys[index]);
+	}
+	JWALSaveSnapshot(tree, BENCH_SNAPSHOT_PATH);
+	JMappedAVLTreeSync(mappedTree);
+	DeleteJAVLTree(&tree);
+	DeleteJMappedAVLTree(&mappedTree);
+
+	double start = GetNanoseconds();
+	tree = JWALRecover(IntType, BENCH_SNAPSHOT_PATH, NULL);
+	PrintResult("Open by snapshot load (per key)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	mappedTree = NewJMappedAVLTree(BENCH_MAPPED_PATH, IntType, MappedReadOnly);
+	PrintResult("Open by mmap (total)", GetNanoseconds() - start, 1);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JMappedAVLTreeFindKey(mappedTree, &keys[index]) == FindSuccess);
+	PrintResult("FindKey (mmap, first touch)", GetNanoseconds() - start, count);
+	if(found != count) printf("lookup mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	DeleteJMappedAVLTree(&mappedTree);
+	remove(BENCH_SNAPSHOT_PATH);
+	remove(BENCH_MAPPED_PATH);
+}
+
+/**
+ * @fn static void BenchBloomFilter(const char *name, int *keys, int count, JBloomMode mode)
+ * @brief 70% 가 없는 키인 검색을 Bloom Filter 유무에 따라 비교하는 함수
+ * 짝수 키만 트리에 넣고, 열 번 중 일곱 번은 홀수 키(없는 키)를 찾는다.
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 0 ~ count - 1 을 섞은 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param mode Bloom Filter 종류, 0 이면 Bloom Filter 를 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void BenchBloomFilter(const char *name, int *keys, int count, JBloomMode mode)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JBloomFilterPtr filter = NULL;
+	int *storedKeys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *queryKeys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int found = 0;
+	int expected = 0;
+
+	if(storedKeys == NULL || queryKeys == NULL)
+	{
+		free(storedKeys);
+		free(queryKeys);
+		DeleteJAVLTree(&tree);
+		return;
+	}
+
+	for(index = 0; index < count; index++)
+	{
+		storedKeys[index] = keys[index] * 2;
+		queryKeys[index] = (index % 10 < 3) ? storedKeys[index] : storedKeys[index] + 1;
+		expected += (index % 10 < 3);
+		JAVLTreeAddNode(tree, &storedKeys[index]);
+	}
+
+	if(mode != 0)
+	{
+		filter = NewJBloomFilter(IntType, mode, (unsigned int)count, 10);
+		JAVLTreeAttachBloomFilter(tree, filter);
+	}
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &queryKeys[index]) != NULL);
+	PrintResult(name, GetNanoseconds() - start, count);
+	if(found != expected) printf("lookup mismatch\n");
+	if(filter != NULL) printf("%-40s %10.2f %%\n", "  false positive rate", JBloomFilterGetFalsePositiveRate(filter) * 100.0);
+
+	DeleteJAVLTree(&tree);
+	DeleteJBloomFilter(&filter);
+	free(storedKeys);
+	free(queryKeys);
+}
+
+/**
+ * @fn static void BenchLookupCache(const char *name, int *keys, int count, unsigned int entryCount)
+ * @brief 1% 의 키에 검색 80% 가 몰리는 경우를 검색 캐시 유무에 따라 비교하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param entryCount 검색 캐시 항목 개수, 0 이면 검색 캐시를 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void BenchLookupCache(const char *name, int *keys, int count, unsigned int entryCount)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JLookupCachePtr cache = NULL;
+	int *queryKeys = (int*)malloc(sizeof(int) * (size_t)count);
+	int hotCount = count / 100;
+	int index = 0;
+	int found = 0;
+
+	if(queryKeys == NULL || hotCount == 0)
+	{
+		free(queryKeys);
+		DeleteJAVLTree(&tree);
+		return;
+	}
+
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+
+	srand(5678);
+	for(index = 0; index < count; index++)
+	{
+		if(rand() % 100 < 80) queryKeys[index] = keys[rand() % hotCount];
+		else queryKeys[index] = keys[rand() % count];
+	}
+
+	if(entryCount > 0)
+	{
+		cache = NewJLookupCache(IntType, entryCount);
+		JAVLTreeAttachLookupCache(tree, cache);
+	}
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &queryKeys[index]) != NULL);
+	PrintResult(name, GetNanoseconds() - start, count);
+	if(found != count) printf("lookup mismatch\n");
+	if(cache != NULL) printf("%-40s %10.2f %%\n", "  hit ratio", JLookupCacheGetHitRatio(cache) * 100.0);
+
+	DeleteJAVLTree(&tree);
+	DeleteJLookupCache(&cache);
+	free(queryKeys);
+}
+
+/**
+ * @fn static void BenchChunkedInt(int *keys, int count)
+ * @brief 정수 키 삽입, 조회를 노드 하나에 키 하나인 트리와 키 배열 노드 트리로 비교하는 함수
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchChunkedInt(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JChunkedAVLTreePtr chunkedTree = NewJChunkedAVLTree(IntType);
+	int index = 0;
+	int found = 0;
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	PrintResult("AddNode int (JNode)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) JChunkedAVLTreeAddKey(chunkedTree, &keys[index]);
+	PrintResult("AddKey int (chunked)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &keys[index]) != NULL);
+	PrintResult("FindNode int (JNode)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JChunkedAVLTreeFindKey(chunkedTree, &keys[index]) != NULL);
+	PrintResult("FindKey int (chunked)", GetNanoseconds() - start, count);
+
+	printf("%-40s %10.1f keys/node\n", "  chunked fill", (double)count / chunkedTree->nodeCount);
+	if(found != count * 2) printf("lookup mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	DeleteJChunkedAVLTree(&chunkedTree);
+}
+
+/**
+ * @fn static void BenchChunkedString(int *keys, int count)
+ * @brief 문자열 키 삽입, 조회를 노드 하나에 키 하나인 트리와 키 배열 노드 트리로 비교하는 함수
+ * 키는 "key%08d" 형식이라 앞 8 바이트가 같은 키가 많다.
+ * @param keys 문자열 키를 만들 정수 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchChunkedString(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(StringType);
+	JChunkedAVLTreePtr chunkedTree = NewJChunkedAVLTree(StringType);
+	char *stringKeys = (char*)malloc((size_t)count * 16);
+	int index = 0;
+	int found = 0;
+
+	if(stringKeys == NULL)
+	{
+		DeleteJAVLTree(&tree);
+		DeleteJChunkedAVLTree(&chunkedTree);
+		return;
+	}
+	for(index = 0; index < count; index++) sprintf(stringKeys + index * 16, "key%08d", keys[index]);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, stringKeys + index * 16);
+	PrintResult("AddNode string (JNode)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) JChunkedAVLTreeAddKey(chunkedTree, stringKeys + index * 16);
+	PrintResult("AddKey string (chunked)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, stringKeys + index * 16) != NULL);
+	PrintResult("FindNode string (JNode)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JChunkedAVLTreeFindKey(chunkedTree, stringKeys + index * 16) != NULL);
+	PrintResult("FindKey string (chunked)", GetNanoseconds() - start, count);
+
+	if(found != count * 2) printf("lookup mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	DeleteJChunkedAVLTree(&chunkedTree);
+	free(stringKeys);
+}
+
+/**
+ * @fn static void BenchAggregate(int *keys, int count)
+ * @brief 집계 값 유지 비용과 범위 합계를 구하는 시간을 순회 방식과 비교하는 함수
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchAggregate(int *keys, int count)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JAVLTreePtr augmentedTree = NewJAVLTree(IntType);
+	JAVLTreeAugment augment;
+	int queryCount = 1000;
+	int width = count / 100;
+	int index = 0;
+	long long iterateSum = 0;
+	long long aggregateSum = 0;
+
+	augment.aggregateSize = sizeof(long long);
+	augment.identity = SumIdentity;
+	augment.lift = SumLift;
+	augment.combine = SumCombine;
+	augment.userData = NULL;
+	JAVLTreeSetAugment(augmentedTree, &augment);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	PrintResult("AddNode (no augment)", GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(augmentedTree, &keys[index]);
+	PrintResult("AddNode (sum augment)", GetNanoseconds() - start, count);
+
+	srand(3737);
+	start = GetNanoseconds();
+	for(index = 0; index < queryCount; index++)
+	{
+		int lowKey = rand() % count;
+		int highKey = lowKey + width;
+		JNodePtr node = JAVLTreeLowerBound(tree, &lowKey);
+		for(; node != NULL && *((int*)node->key) <= highKey; node = JNodeGetNext(node)) iterateSum += *((int*)node->key);
+	}
+	PrintResult("Range sum 1% (LowerBound + GetNext)", GetNanoseconds() - start, queryCount);
+
+	srand(3737);
+	start = GetNanoseconds();
+	for(index = 0; index < queryCount; index++)
+	{
+		int lowKey = rand() % count;
+		int highKey = lowKey + width;
+		long long sum = 0;
+		JAVLTreeAggregateRange(augmentedTree, &lowKey, &highKey, &sum);
+		aggregateSum += sum;
+	}
+	PrintResult("Range sum 1% (AggregateRange)", GetNanoseconds() - start, queryCount);
+	if(iterateSum != aggregateSum) printf("aggregate mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	DeleteJAVLTree(&augmentedTree);
+}
+
+/**
+ * @fn static void BenchIntervalStab(int count)
+ * @brief 한 점을 포함하는 구간 찾기를 최대 끝 값을 이용하는 반복자와 시작 값 순서 순회로 비교하는 함수
+ * @param count 구간 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchIntervalStab(int count)
+{
+	JAVLTreePtr tree = NewJIntervalTree();
+	JIntervalPtr intervals = (JIntervalPtr)malloc(sizeof(JInterval) * (size_t)count);
+	JIntervalIterator iterator;
+	int queryCount = 1000;
+	int index = 0;
+	long long scanFound = 0;
+	long long stabFound = 0;
+
+	if(intervals == NULL)
+	{
+		DeleteJAVLTree(&tree);
+		return;
+	}
+
+	srand(3838);
+	for(index = 0; index < count; index++)
+	{
+		intervals[index].start = rand() % (count * 10);
+		intervals[index].end = intervals[index].start + rand() % 100;
+	}
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &intervals[index]);
+	PrintResult("AddNode interval (max end)", GetNanoseconds() - start, count);
+
+	srand(3939);
+	start = GetNanoseconds();
+	for(index = 0; index < queryCount; index++)
+	{
+		int point = rand() % (count * 10);
+		JNodePtr node = JAVLTreeGetMin(tree);
+		for(; node != NULL && ((JInterval*)node->key)->start <= point; node = JNodeGetNext(node))
+		{
+			if(((JInterval*)node->key)->end >= point) scanFound++;
+		}
+	}
+	PrintResult("Stab (in-order scan)", GetNanoseconds() - start, queryCount);
+
+	srand(3939);
+	start = GetNanoseconds();
+	for(index = 0; index < queryCount; index++)
+	{
+		JIntervalTreeStab(tree, rand() % (count * 10), &iterator);
+		while(JIntervalIteratorNext(&iterator) != NULL) stabFound++;
+	}
+	PrintResult("Stab (interval iterator)", GetNanoseconds() - start, queryCount);
+	if(scanFound != stabFound) printf("stab mismatch\n");
+
+	DeleteJAVLTree(&tree);
+	free(intervals);
+}
+
+/**
+ * @fn static void BenchHashLookup(const char *name, int *keys, int count, JAVLTreeLookup lookup)
+ * @brief 점 검색 방식에 따른 삽입, 무작위 조회, 삭제 시간을 측정하는 함수
+ * @param name 출력할 측정 이름(입력, 읽기 전용)
+ * @param keys 삽입, 조회할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param lookup 점 검색 방식(입력)
+ * @return 반환값 없음
+ */
+static void BenchHashLookup(const char *name, int *keys, int count, JAVLTreeLookup lookup)
+{
+	JAVLTreeOptions options;
+	char label[64];
+	int index = 0;
+	int found = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.lookup = lookup;
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	if(tree == NULL) return;
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	snprintf(label, sizeof(label), "AddNode (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = count - 1; index >= 0; index--) found += (JAVLTreeFindNode(tree, &keys[index]) != NULL);
+	snprintf(label, sizeof(label), "FindNode (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count) printf("lookup mismatch\n");
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	snprintf(label, sizeof(label), "DeleteNodeKey (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchExpire(int *keys, int count)
+ * @brief 만료된 키를 찾기 위해 전체를 훑는 방법과 만료 시각 힙을 사용하는 JAVLTreeExpire 를 비교하는 함수
+ * 키마다 임의의 만료 시각을 주고, 현재 시각을 1% 씩 옮기면서 만료된 키를 삭제한다.
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchExpire(int *keys, int count)
+{
+	JAVLTreePtr scanTree = NewJAVLTree(IntType);
+	JAVLTreePtr heapTree = NewJAVLTree(IntType);
+	// 키 값(0 ~ count - 1)을 위치로 사용하는 키별 만료 시각
+	long long *expireAts = (long long*)malloc(sizeof(long long) * (size_t)count);
+	int *expiredKeys = (int*)malloc(sizeof(int) * (size_t)count);
+	int stepCount = 100;
+	int step = 0;
+	int index = 0;
+	int scanRemoved = 0;
+	int heapRemoved = 0;
+
+	if(expireAts == NULL || expiredKeys == NULL || JAVLTreeEnableExpiry(heapTree, NULL, NULL) == NULL)
+	{
+		free(expireAts);
+		free(expiredKeys);
+		DeleteJAVLTree(&scanTree);
+		DeleteJAVLTree(&heapTree);
+		return;
+	}
+
+	srand(4321);
+	for(index = 0; index < count; index++)
+	{
+		expireAts[keys[index]] = rand() % count;
+		JAVLTreeAddNode(scanTree, &keys[index]);
+		JAVLTreeAddNodeExpire(heapTree, &keys[index], expireAts[keys[index]]);
+	}
+
+	double start = GetNanoseconds();
+	for(step = 1; step <= stepCount; step++)
+	{
+		long long now = (long long)count * step / stepCount;
+		int expiredCount = 0;
+		JNodePtr node = JAVLTreeGetMin(scanTree);
+		for(; node != NULL; node = JNodeGetNext(node))
+		{
+			int key = *((int*)JNodeGetKey(node));
+			if(expireAts[key] <= now) expiredKeys[expiredCount++] = key;
+		}
+		for(index = 0; index < expiredCount; index++) JAVLTreeDeleteNodeKey(scanTree, &expiredKeys[index]);
+		scanRemoved += expiredCount;
+	}
+	PrintResult("Expire 1% step (in-order scan)", GetNanoseconds() - start, stepCount);
+
+	start = GetNanoseconds();
+	for(step = 1; step <= stepCount; step++)
+	{
+		heapRemoved += JAVLTreeExpire(heapTree, (long long)count * step / stepCount, 0);
+	}
+	PrintResult("Expire 1% step (expiry heap)", GetNanoseconds() - start, stepCount);
+	if(scanRemoved != heapRemoved) printf("expire mismatch\n");
+
+	free(expireAts);
+	free(expiredKeys);
+	DeleteJAVLTree(&scanTree);
+	DeleteJAVLTree(&heapTree);
+}
+
+/**
+ * @fn static void BenchBalancePolicy(const char *name, int *keys, int count, JAVLTreeBalance balance)
+ * @brief 삭제가 절반인 혼합 작업에서 균형 정책별 연산 당 시간과 회전 횟수를 측정하는 함수
+ * 앞쪽 절반의 키를 먼저 넣고, 가장 오래된 키 삭제와 새 키 추가를 번갈아 수행한다.
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param balance 균형 정책(입력)
+ * @return 반환값 없음
+ */
+static void BenchBalancePolicy(const char *name, int *keys, int count, JAVLTreeBalance balance)
+{
+	JAVLTreeOptions options;
+	int half = count / 2;
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.balance = balance;
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	if(tree == NULL) return;
+
+	for(index = 0; index < half; index++) JAVLTreeAddNode(tree, &keys[index]);
+	unsigned long long rotationCount = JAVLTreeGetRotationCount(tree);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < half; index++)
+	{
+		JAVLTreeDeleteNodeKey(tree, &keys[index]);
+		JAVLTreeAddNode(tree, &keys[half + index]);
+	}
+	PrintResult(name, GetNanoseconds() - start, half * 2);
+	printf("%-40s %10.3f rot/op\n", name, (double)(JAVLTreeGetRotationCount(tree) - rotationCount) / (half * 2));
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchRelaxedBalance(const char *name, int *keys, int count, int isRelaxed, int stepBudget)
+ * @brief 절반이 채워진 트리에 나머지 절반을 몰아서 추가할 때 추가 한 번의 평균, p99 시간을 측정하는 함수
+ * 완화 균형 모드이면 추가가 끝난 뒤 남은 균형 작업을 처리하는 시간과 처리 전 높이도 출력한다.
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param isRelaxed 완화 균형 모드 사용 여부(입력)
+ * @param stepBudget 추가할 때마다 수행할 균형 작업량(입력)
+ * @return 반환값 없음
+ */
+static void BenchRelaxedBalance(const char *name, int *keys, int count, int isRelaxed, int stepBudget)
+{
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int half = count / 2;
+	int index = 0;
+	double *latencies = (double*)malloc(sizeof(double) * (size_t)half);
+
+	if(tree == NULL || latencies == NULL)
+	{
+		free(latencies);
+		DeleteJAVLTree(&tree);
+		return;
+	}
+
+	for(index = 0; index < half; index++) JAVLTreeAddNode(tree, &keys[index]);
+	if(isRelaxed == 1) JAVLTreeSetRelaxed(tree, 1, stepBudget);
+
+	double total = 0;
+	for(index = 0; index < half; index++)
+	{
+		double start = GetNanoseconds();
+		JAVLTreeAddNode(tree, &keys[half + index]);
+		latencies[index] = GetNanoseconds() - start;
+		total += latencies[index];
+	}
+	qsort(latencies, (size_t)half, sizeof(double), CompareDouble);
+	PrintResult(name, total, half);
+	printf("%-40s %10.1f ns p99, height %d\n", name, latencies[half / 100 * 99], tree->root->height);
+
+	if(isRelaxed == 1)
+	{
+		double start = GetNanoseconds();
+		JAVLTreeSetRelaxed(tree, 0, 0);
+		printf("%-40s %10.1f ms drain, height %d\n", name, (GetNanoseconds() - start) / 1e6, tree->root->height);
+	}
+
+	free(latencies);
+	DeleteJAVLTree(&tree);
+}
+
+// 삽입 스레드 하나가 추가할 키 범위
+typedef struct _bench_insert_work_t {
+	// 공유 트리 (잠금 방식에서 사용)
+	JAVLTreePtr tree;
+	// 공유 트리 잠금 (잠금 방식에서 사용)
+	pthread_mutex_t *lock;
+	// 앞단 구조체 (삽입 버퍼 방식에서 사용, 없으면 NULL)
+	JBufferedAVLTreePtr front;
+	// 추가할 키 배열
+	int *keys;
+	// 키 개수
+	int count;
+} BenchInsertWork, *BenchInsertWorkPtr;
+
+/**
+ * @fn static void* BenchInsertThread(void *userData)
+ * @brief 키마다 공유 트리 잠금을 잡고 추가하거나, 자신의 삽입 버퍼에 추가하는 스레드 함수
+ * @param userData 추가할 키 범위(BenchInsertWork)(입력)
+ * @return 항상 NULL 반환
+ */
+static void* BenchInsertThread(void *userData)
+{
+	BenchInsertWorkPtr work = (BenchInsertWorkPtr)userData;
+	int index = 0;
+
+	if(work->front == NULL)
+	{
+		for(index = 0; index < work->count; index++)
+		{
+			pthread_mutex_lock(work->lock);
+			JAVLTreeAddNode(work->tree, &work->keys[index]);
+			pthread_mutex_unlock(work->lock);
+		}
+		return NULL;
+	}
+
+	JInsertBufferPtr buffer = NewJInsertBuffer(work->front);
+	for(index = 0; index < work->count; index++) JInsertBufferAddKey(buffer, &work->keys[index]);
+	DeleteJInsertBuffer(&buffer);
+	return NULL;
+}
+
+/**
+ * @fn static void BenchBufferedInsert(const char *name, int *keys, int count, int bufferCapacity)
+ * @brief 여러 스레드가 공유 트리에 키를 나눠서 추가하는 시간과 공유 잠금 횟수를 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param bufferCapacity 삽입 버퍼 크기, 0 이면 키마다 공유 잠금을 잡음(입력)
+ * @return 반환값 없음
+ */
+static void BenchBufferedInsert(const char *name, int *keys, int count, int bufferCapacity)
+{
+	pthread_t threads[BENCH_THREAD_COUNT];
+	BenchInsertWork works[BENCH_THREAD_COUNT];
+	pthread_mutex_t lock;
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JBufferedAVLTreePtr front = NULL;
+	int index = 0;
+
+	pthread_mutex_init(&lock, NULL);
+	if(bufferCapacity > 0) front = NewJBufferedAVLTree(tree, bufferCapacity);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < BENCH_THREAD_COUNT; index++)
+	{
+		works[index].tree = tree;
+		works[index].lock = &lock;
+		works[index].front = front;
+		works[index].keys = keys + (size_t)count / BENCH_THREAD_COUNT * (size_t)index;
+		works[index].count = count / BENCH_THREAD_COUNT;
+		pthread_create(&threads[index], NULL, BenchInsertThread, &works[index]);
+	}
+	for(index = 0; index < BENCH_THREAD_COUNT; index++) pthread_join(threads[index], NULL);
+	PrintResult(name, GetNanoseconds() - start, count);
+	printf("%-40s %10llu shared locks\n", name, (front != NULL) ? front->mergeCount : (unsigned long long)count);
+	if(JAVLTreeGetSize(tree) != count) printf("buffered insert mismatch\n");
+
+	DeleteJBufferedAVLTree(&front);
+	DeleteJAVLTree(&tree);
+	pthread_mutex_destroy(&lock);
+}
+
+// 작업 큐에 키를 넣는 스레드 하나가 넣을 키 범위
+typedef struct _bench_ingest_work_t {
+	// 작업 큐
+	JIngestQueuePtr queue;
+	// 추가할 키 배열
+	int *keys;
+	// 키 개수
+	int count;
+	// 큐가 가득 차서 다시 넣은 횟수
+	unsigned long long retryCount;
+} BenchIngestWork, *BenchIngestWorkPtr;
+
+/**
+ * @fn static void* BenchIngestThread(void *userData)
+ * @brief 작업 큐에 키 추가 작업을 넣는 스레드 함수 (큐가 가득 차면 양보하고 다시 넣음)
+ * @param userData 넣을 키 범위(BenchIngestWork)(입력)
+ * @return 항상 NULL 반환
+ */
+static void* BenchIngestThread(void *userData)
+{
+	BenchIngestWorkPtr work = (BenchIngestWorkPtr)userData;
+	int index = 0;
+
+	for(index = 0; index < work->count; index++)
+	{
+		while(JIngestQueueSubmit(work->queue, IngestInsert, &work->keys[index], NULL, NULL) == NULL)
+		{
+			work->retryCount++;
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void BenchIngestQueue(const char *name, int *keys, int count, unsigned int capacity)
+ * @brief 여러 스레드가 작업 큐에 키를 넣고 쓰기 스레드 하나가 트리에 반영할 때까지의 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param capacity 작업 큐 칸 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchIngestQueue(const char *name, int *keys, int count, unsigned int capacity)
+{
+	pthread_t threads[BENCH_THREAD_COUNT];
+	BenchIngestWork works[BENCH_THREAD_COUNT];
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JIngestQueuePtr queue = NewJIngestQueue(tree, capacity, 0);
+	unsigned long long retryCount = 0;
+	int index = 0;
+
+	double start = GetNanoseconds();
+	for(index = 0; index < BENCH_THREAD_COUNT; index++)
+	{
+		works[index].queue = queue;
+		works[index].keys = keys + (size_t)count / BENCH_THREAD_COUNT * (size_t)index;
+		works[index].count = count / BENCH_THREAD_COUNT;
+		works[index].retryCount = 0;
+		pthread_create(&threads[index], NULL, BenchIngestThread, &works[index]);
+	}
+	for(index = 0; index < BENCH_THREAD_COUNT; index++)
+	{
+		pthread_join(threads[index], NULL);
+		retryCount += works[index].retryCount;
+	}
+	JIngestQueueSync(queue);
+	PrintResult(name, GetNanoseconds() - start, count);
+	printf("%-40s %10llu full retries\n", name, retryCount);
+	if(JAVLTreeGetSize(tree) != count) printf("ingest queue mismatch\n");
+
+	DeleteJIngestQueue(&queue);
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchOwnedKeys(const char *name, int *keys, int count, JAVLTreeKeyOwner keyOwner, const char *format)
+ * @brief 문자열 키를 추가, 검색, 해제하는 시간을 키 소유 방식별로 측정하는 함수
+ * KeyOwnerCaller 는 키마다 따로 할당해서 복사해 두고 트리를 삭제한 뒤 하나씩 해제한다.
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 문자열 키를 만들 정수 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param keyOwner 키 소유 방식(입력)
+ * @param format 정수 키로 문자열 키를 만드는 형식(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void BenchOwnedKeys(const char *name, int *keys, int count, JAVLTreeKeyOwner keyOwner, const char *format)
+{
+	JAVLTreeOptions options;
+	char **callerKeys = (char**)malloc(sizeof(char*) * (size_t)count);
+	char label[64];
+	char buffer[64];
+	int index = 0;
+	int found = 0;
+
+	if(callerKeys == NULL) return;
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.keyOwner = keyOwner;
+	JAVLTreePtr tree = NewJAVLTreeEx(StringType, &options);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++)
+	{
+		sprintf(buffer, format, keys[index]);
+		if(keyOwner == KeyOwnerTree) JAVLTreeAddNode(tree, buffer);
+		else
+		{
+			callerKeys[index] = (char*)malloc(strlen(buffer) + 1);
+			strcpy(callerKeys[index], buffer);
+			if(JAVLTreeAddNode(tree, callerKeys[index]) == NULL)
+			{
+				free(callerKeys[index]);
+				callerKeys[index] = NULL;
+			}
+		}
+	}
+	sprintf(label, "%s add", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++)
+	{
+		sprintf(buffer, format, keys[index]);
+		found += (JAVLTreeFindNode(tree, buffer) != NULL);
+	}
+	sprintf(label, "%s find", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count) printf("owned key lookup mismatch\n");
+
+	start = GetNanoseconds();
+	DeleteJAVLTree(&tree);
+	if(keyOwner != KeyOwnerTree)
+	{
+		for(index = 0; index < count; index++) free(callerKeys[index]);
+	}
+	sprintf(label, "%s delete", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	free(callerKeys);
+}
+
+// 할당자 벤치마크에서 사용하는 단순 증가 메모리 풀 (해제는 풀 전체를 한 번에)
+typedef struct _bench_pool_t {
+	// 풀 메모리
+	unsigned char *bytes;
+	// 사용한 바이트 수
+	size_t used;
+	// 풀 크기
+	size_t capacity;
+} BenchPool, *BenchPoolPtr;
+
+/**
+ * @fn static void* BenchPoolAlloc(size_t size, void *context)
+ * @brief 풀에서 16 바이트 단위로 잘라서 할당하는 함수 (풀이 부족하면 NULL 반환)
+ * @param size 할당할 바이트 수(입력)
+ * @param context 메모리 풀(BenchPool)(출력)
+ * @return 성공 시 할당된 메모리의 주소, 실패 시 NULL 반환
+ */
+static void* BenchPoolAlloc(size_t size, void *context)
+{
+	BenchPoolPtr pool = (BenchPoolPtr)context;
+	size_t alignedSize = (size + 15) & ~(size_t)15;
+	if(pool->capacity - pool->used < alignedSize) return NULL;
+
+	void *memory = pool->bytes + pool->used;
+	pool->used += alignedSize;
+	return memory;
+}
+
+/**
+ * @fn static void BenchPoolFree(void *pointer, void *context)
+ * @brief 개별 해제는 하지 않는 해제 함수 (풀 전체를 나중에 해제)
+ * @param pointer 해제할 메모리의 주소(입력)
+ * @param context 메모리 풀(입력)
+ * @return 반환값 없음
+ */
+static void BenchPoolFree(void *pointer, void *context)
+{
+	(void)pointer;
+	(void)context;
+}
+
+/**
+ * @fn static void BenchAllocator(const char *name, int *keys, int count, int isPool)
+ * @brief 노드 할당을 malloc 과 증가 메모리 풀로 바꿔 가며 삽입, 조회, 트리 삭제 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param isPool 1 이면 메모리 풀 할당자, 0 이면 malloc(입력)
+ * @return 반환값 없음
+ */
+static void BenchAllocator(const char *name, int *keys, int count, int isPool)
+{
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	BenchPool pool;
+	char label[64];
+	int index = 0;
+	int found = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	pool.used = 0;
+	pool.capacity = (size_t)count * 64 + 4096;
+	pool.bytes = (unsigned char*)malloc(pool.capacity);
+	if(pool.bytes == NULL) return;
+	if(isPool == 1)
+	{
+		allocator.alloc = BenchPoolAlloc;
+		allocator.free = BenchPoolFree;
+		allocator.context = &pool;
+		options.allocator = &allocator;
+	}
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	sprintf(label, "%s add", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &keys[index]) != NULL);
+	sprintf(label, "%s find", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count) printf("allocator lookup mismatch\n");
+
+	start = GetNanoseconds();
+	DeleteJAVLTree(&tree);
+	free(pool.bytes);
+	sprintf(label, "%s delete", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+}
+
+/**
+ * @fn static void BenchCompact(const char *name, int *keys, int count, JAVLTreeLayout layout)
+ * @brief 추가, 삭제로 노드가 흩어진 트리를 재배치한 뒤 순회, 조회 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입할 키 배열(입력)
+ * @param count 키 개수(입력)
+ * @param layout 재배치 순서, 0 이면 재배치하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void BenchCompact(const char *name, int *keys, int count, JAVLTreeLayout layout)
+{
+	char label[64];
+	int index = 0;
+	int found = 0;
+	long long sum = 0;
+
+	// 절반을 지우고 다시 넣어서 키 순서와 할당 순서가 어긋나게 만든다.
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	for(index = 0; index < count; index++) JAVLTreeAddNode(tree, &keys[index]);
+	for(index = 0; index < count; index += 2) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	for(index = 0; index < count; index += 2) JAVLTreeAddNode(tree, &keys[index]);
+
+	double start = GetNanoseconds();
+	if(layout != 0) JAVLTreeCompact(tree, layout);
+	sprintf(label, "%s compact", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	JNodePtr node = JAVLTreeGetMin(tree);
+	for(; node != NULL; node = JNodeGetNext(node)) sum += *(int*)JNodeGetKey(node);
+	sprintf(label, "%s scan", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (JAVLTreeFindNode(tree, &keys[(int)(((long long)index * 7919) % count)]) != NULL);
+	sprintf(label, "%s find", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count || sum == 0) printf("compact lookup mismatch\n");
+
+	DeleteJAVLTree(&tree);
+}
+
+/**
+ * @fn static void BenchCharSets(int setCount, int keysPerSet)
+ * @brief 작은 char 집합을 많이 만들어 CharType AVL Tree 와 char 비트맵의 추가, 검색, 순회 시간을 비교하는 함수
+ * @param setCount 집합 개수(입력)
+ * @param keysPerSet 집합 하나에 추가할 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchCharSets(int setCount, int keysPerSet)
+{
+	static char charKeys[256];
+	JAVLTreePtr *trees = (JAVLTreePtr*)malloc(sizeof(JAVLTreePtr) * (size_t)setCount);
+	JCharBitmapPtr bitmaps = (JCharBitmapPtr)malloc(sizeof(JCharBitmap) * (size_t)setCount);
+	int operationCount = setCount * keysPerSet;
+	int index = 0;
+	int found = 0;
+	long long sum = 0;
+	if(trees == NULL || bitmaps == NULL) return;
+
+	for(index = 0; index < 256; index++) charKeys[index] = (char)(index - 128);
+
+	// 트리는 노드 주소만 저장하므로 키는 정적 배열에 둔다.
+	double start = GetNanoseconds();
+	for(index = 0; index < setCount; index++)
+	{
+		int keyIndex = 0;
+		trees[index] = NewJAVLTree(CharType);
+		for(; keyIndex < keysPerSet; keyIndex++) JAVLTreeAddNode(trees[index], &charKeys[(index + keyIndex * 97) & 255]);
+	}
+	PrintResult("char sets add (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < setCount; index++)
+	{
+		int keyIndex = 0;
+		JCharBitmapClear(&bitmaps[index]);
+		for(; keyIndex < keysPerSet; keyIndex++) JCharBitmapAddKey(&bitmaps[index], &charKeys[(index + keyIndex * 97) & 255]);
+	}
+	PrintResult("char sets add (bitmap)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < operationCount; index++) found += (JAVLTreeFindNode(trees[index % setCount], &charKeys[index & 255]) != NULL);
+	PrintResult("char sets find (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < operationCount; index++) found -= (JCharBitmapFindKey(&bitmaps[index % setCount], &charKeys[index & 255]) == FindSuccess);
+	PrintResult("char sets find (bitmap)", GetNanoseconds() - start, operationCount);
+	if(found != 0) printf("char set lookup mismatch\n");
+
+	start = GetNanoseconds();
+	for(index = 0; index < setCount; index++)
+	{
+		JNodePtr node = JAVLTreeGetMin(trees[index]);
+		for(; node != NULL; node = JNodeGetNext(node)) sum += *(char*)JNodeGetKey(node);
+	}
+	PrintResult("char sets scan (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < setCount; index++)
+	{
+		char key = 0;
+		FindResult result = JCharBitmapGetMin(&bitmaps[index], &key);
+		for(; result == FindSuccess; result = JCharBitmapSuccessor(&bitmaps[index], &key, &key)) sum -= key;
+	}
+	PrintResult("char sets scan (bitmap)", GetNanoseconds() - start, operationCount);
+	if(sum != 0) printf("char set scan mismatch\n");
+
+	printf("%-40s %10.1f bytes/set (bitmap %d)\n", "char sets memory (AVL tree)", (double)(sizeof(JAVLTree) + sizeof(JNode) * (size_t)keysPerSet), (int)sizeof(JCharBitmap));
+
+	for(index = 0; index < setCount; index++) DeleteJAVLTree(&trees[index]);
+	free(trees);
+	free(bitmaps);
+}
+
+/**
+ * @fn static void BenchSmallTrees(int *keys, int treeCount, int keysPerTree)
+ * @brief 키가 적은 트리를 많이 만들어 노드 기반 AVL Tree 와 배열로 시작하는 작은 AVL Tree 의 추가, 검색, 삭제 시간을 비교하는 함수
+ * @param keys 삽입할 키 배열, treeCount * keysPerTree 개 이상(입력)
+ * @param treeCount 트리 개수(입력)
+ * @param keysPerTree 트리 하나에 추가할 키 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchSmallTrees(int *keys, int treeCount, int keysPerTree)
+{
+	JAVLTreePtr *trees = (JAVLTreePtr*)malloc(sizeof(JAVLTreePtr) * (size_t)treeCount);
+	JSmallAVLTreePtr *smallTrees = (JSmallAVLTreePtr*)malloc(sizeof(JSmallAVLTreePtr) * (size_t)treeCount);
+	int operationCount = treeCount * keysPerTree;
+	int index = 0;
+	int found = 0;
+	if(trees == NULL || smallTrees == NULL) return;
+
+	double start = GetNanoseconds();
+	for(index = 0; index < treeCount; index++)
+	{
+		int keyIndex = 0;
+		trees[index] = NewJAVLTree(IntType);
+		for(; keyIndex < keysPerTree; keyIndex++) JAVLTreeAddNode(trees[index], &keys[index * keysPerTree + keyIndex]);
+	}
+	PrintResult("tiny trees add (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < treeCount; index++)
+	{
+		int keyIndex = 0;
+		smallTrees[index] = NewJSmallAVLTree(IntType);
+		for(; keyIndex < keysPerTree; keyIndex++) JSmallAVLTreeAddKey(smallTrees[index], &keys[index * keysPerTree + keyIndex]);
+	}
+	PrintResult("tiny trees add (small array)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < operationCount; index++) found += (JAVLTreeFindNode(trees[index / keysPerTree], &keys[index]) != NULL);
+	PrintResult("tiny trees find (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < operationCount; index++) found -= (JSmallAVLTreeFindKey(smallTrees[index / keysPerTree], &keys[index]) != NULL);
+	PrintResult("tiny trees find (small array)", GetNanoseconds() - start, operationCount);
+	if(found != 0) printf("tiny tree lookup mismatch\n");
+
+	// 작은 트리를 먼저 삭제한다. glibc 는 작은 노드(fastbin 크기)의 해제를 미뤄 두었다가, 뒤에서 fastbin 보다 큰 블록
+	// (152 바이트 구조체)을 해제해서 64KB 이상의 빈 공간이 생길 때 한 번에 합치므로(malloc_consolidate),
+	// 노드 기반 트리를 먼저 삭제하면 노드 약 100 만 개를 합치는 시간이 작은 트리 삭제 시간에 들어간다.
+	start = GetNanoseconds();
+	for(index = 0; index < treeCount; index++) DeleteJSmallAVLTree(&smallTrees[index]);
+	PrintResult("tiny trees delete (small array)", GetNanoseconds() - start, operationCount);
+
+	start = GetNanoseconds();
+	for(index = 0; index < treeCount; index++) DeleteJAVLTree(&trees[index]);
+	PrintResult("tiny trees delete (AVL tree)", GetNanoseconds() - start, operationCount);
+
+	printf("%-40s %10.1f bytes/tree (small array %d)\n", "tiny trees memory (AVL tree)", (double)(sizeof(JAVLTree) + sizeof(JNode) * (size_t)keysPerTree), (int)sizeof(JSmallAVLTree));
+
+	free(trees);
+	free(smallTrees);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	int *keys = (int*)malloc(sizeof(int) * BENCH_KEY_COUNT);
+	if(keys == NULL) return -1;
+
+	srand(1234);
+
+	// @ Hinted Insertion -------------------------------------------
+	MakeMonotoneKeys(keys, BENCH_KEY_COUNT);
+	BenchAddNode("AddNode (monotone)", keys, BENCH_KEY_COUNT);
+	BenchAddNodeHint("AddNodeHint (monotone)", keys, BENCH_KEY_COUNT);
+
+	MakeNearMonotoneKeys(keys, BENCH_KEY_COUNT);
+	BenchAddNode("AddNode (near-monotone)", keys, BENCH_KEY_COUNT);
+	BenchAddNodeHint("AddNodeHint (near-monotone)", keys, BENCH_KEY_COUNT);
+
+	MakeRandomKeys(keys, BENCH_KEY_COUNT);
+	BenchAddNode("AddNode (random)", keys, BENCH_KEY_COUNT);
+	BenchAddNodeHint("AddNodeHint (random)", keys, BENCH_KEY_COUNT);
+
+	// @ Compact Node Storage ---------------------------------------
+	BenchLookup(keys, BENCH_KEY_COUNT);
+
+	// @ Batched Lookup ---------------------------------------------
+	BenchFindBatch(keys, BENCH_KEY_COUNT);
+
+	// @ Lazy Delete ------------------------------------------------
+	BenchDeleteNodeKey("DeleteNodeKey (eager)", keys, BENCH_KEY_COUNT, 0);
+	BenchDeleteNodeKey("DeleteNodeKey (tombstone, purge at 25%)", keys, BENCH_KEY_COUNT, 25);
+
+	// @ Write-Ahead Log --------------------------------------------
+	BenchWAL("AddNode + WAL (fsync per record)", keys, BENCH_WAL_KEY_COUNT, 1);
+	BenchWAL("AddNode + WAL (group commit 64)", keys, BENCH_WAL_KEY_COUNT, 64);
+	BenchWAL("AddNode + WAL (group commit 1024)", keys, BENCH_WAL_KEY_COUNT, 1024);
+
+	// @ Memory-Mapped Tree -----------------------------------------
+	BenchMappedOpen(keys, BENCH_KEY_COUNT);
+
+	// @ Bloom Filter -----------------------------------------------
+	MakeRandomKeys(keys, BENCH_KEY_COUNT);
+	BenchBloomFilter("FindNode 70% miss (no filter)", keys, BENCH_KEY_COUNT, 0);
+	BenchBloomFilter("FindNode 70% miss (blocked bloom)", keys, BENCH_KEY_COUNT, BloomBlocked);
+	BenchBloomFilter("FindNode 70% miss (counting bloom)", keys, BENCH_KEY_COUNT, BloomCounting);
+
+	// @ Hot-Key Lookup Cache ---------------------------------------
+	BenchLookupCache("FindNode 80/1 skew (no cache)", keys, BENCH_KEY_COUNT, 0);
+	BenchLookupCache("FindNode 80/1 skew (cache 4096)", keys, BENCH_KEY_COUNT, 4096);
+	BenchLookupCache("FindNode 80/1 skew (cache 32768)", keys, BENCH_KEY_COUNT, 32768);
+
+	// @ Chunked Nodes ----------------------------------------------
+	BenchChunkedInt(keys, BENCH_KEY_COUNT);
+	BenchChunkedString(keys, BENCH_STRING_KEY_COUNT);
+
+	// @ Subtree Aggregates -----------------------------------------
+	BenchAggregate(keys, BENCH_KEY_COUNT);
+
+	// @ Interval Tree ----------------------------------------------
+	BenchIntervalStab(BENCH_STRING_KEY_COUNT);
+
+	// @ Hash Index -------------------------------------------------
+	BenchHashLookup("tree lookup", keys, BENCH_KEY_COUNT, LookupTree);
+	BenchHashLookup("hash lookup", keys, BENCH_KEY_COUNT, LookupHash);
+
+	// @ Expiring Entries -------------------------------------------
+	BenchExpire(keys, BENCH_KEY_COUNT);
+
+	// @ Balancing Policy -------------------------------------------
+	BenchBalancePolicy("50% delete mix (AVL)", keys, BENCH_KEY_COUNT, BalanceAVL);
+	BenchBalancePolicy("50% delete mix (WAVL)", keys, BENCH_KEY_COUNT, BalanceWAVL);
+	BenchBalancePolicy("50% delete mix (red-black)", keys, BENCH_KEY_COUNT, BalanceRedBlack);
+
+	// @ Relaxed Balancing ------------------------------------------
+	BenchRelaxedBalance("AddNode burst (strict)", keys, BENCH_KEY_COUNT, 0, 0);
+	BenchRelaxedBalance("AddNode burst (relaxed, step 0)", keys, BENCH_KEY_COUNT, 1, 0);
+	BenchRelaxedBalance("AddNode burst (relaxed, step 8)", keys, BENCH_KEY_COUNT, 1, 8);
+
+	// @ Per-Thread Insert Buffers ----------------------------------
+	BenchBufferedInsert("4 threads AddNode (lock per key)", keys, BENCH_KEY_COUNT, 0);
+	BenchBufferedInsert("4 threads AddNode (buffer 256)", keys, BENCH_KEY_COUNT, 256);
+
+	// @ Single-Writer Ingest Queue ---------------------------------
+	BenchIngestQueue("4 threads Submit (queue 4096)", keys, BENCH_KEY_COUNT, 4096);
+	BenchIngestQueue("4 threads Submit (queue 65536)", keys, BENCH_KEY_COUNT, 65536);
+
+	// @ Tree-Owned Keys --------------------------------------------
+	BenchOwnedKeys("short (caller malloc)", keys, BENCH_STRING_KEY_COUNT, KeyOwnerCaller, "key%08d");
+	BenchOwnedKeys("short (tree inline)", keys, BENCH_STRING_KEY_COUNT, KeyOwnerTree, "key%08d");
+	BenchOwnedKeys("long (caller malloc)", keys, BENCH_STRING_KEY_COUNT, KeyOwnerCaller, "long-string-key-%08d");
+	BenchOwnedKeys("long (tree arena)", keys, BENCH_STRING_KEY_COUNT, KeyOwnerTree, "long-string-key-%08d");
+
+	// @ Pluggable Allocator ----------------------------------------
+	BenchAllocator("random (malloc)", keys, BENCH_KEY_COUNT, 0);
+	BenchAllocator("random (bump pool)", keys, BENCH_KEY_COUNT, 1);
+
+	// @ Node Relayout ----------------------------------------------
+	BenchCompact("churned (no relayout)", keys, BENCH_KEY_COUNT, 0);
+	BenchCompact("churned (in-order)", keys, BENCH_KEY_COUNT, LayoutInOrder);
+	BenchCompact("churned (van Emde Boas)", keys, BENCH_KEY_COUNT, LayoutVanEmdeBoas);
+
+	// @ Char Bitmap Sets -------------------------------------------
+	BenchCharSets(BENCH_CHAR_SET_COUNT, 24);
+
+	// @ Small-Tree Inline Array ------------------------------------
+	BenchSmallTrees(keys, BENCH_KEY_COUNT / 12, 12);
+
+	free(keys);
+	return 0;
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <time.h>
+
+#include "../include/javltree.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 정수 키 벤치마크에 사용할 키 개수
+#define BENCH_KEY_COUNT 1000000
+// 문자열 키 벤치마크에 사용할 키 개수
+#define BENCH_STRING_KEY_COUNT 200000
+
+// 집합(std::set) 비교에 사용할 빈 값
+struct Empty {};
+
+// 결과가 틀린 벤치마크 수 (0 이 아니면 main 이 실패로 종료)
+static int mismatchCount = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double GetNanoseconds()
+ * @brief 단조 증가하는 현재 시간을 나노초 단위로 반환하는 함수
+ * @return 현재 시간(ns)
+ */
+static double GetNanoseconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+/**
+ * @fn static void PrintResult(const char *name, double elapsed, int count)
+ * @brief 벤치마크 결과를 연산 당 나노초로 출력하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param elapsed 전체 소요 시간(ns)(입력)
+ * @param count 수행한 연산 횟수(입력)
+ * @return 반환값 없음
+ */
+static void PrintResult(const char *name, double elapsed, int count)
+{
+	printf("%-40s %10.1f ns/op\n", name, elapsed / count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void BenchMap(const char *name, const std::vector<Key> &keys)
+ * @brief emplace, find, 순회, erase 시간을 측정하는 함수 (std::map 과 javl::tree 공통)
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입, 조회, 삭제할 키 배열(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+template <class Map, class Key>
+static void BenchMap(const char *name, const std::vector<Key> &keys)
+{
+	Map map;
+	int count = (int)keys.size();
+	int index = 0;
+	int found = 0;
+	long long sum = 0;
+	char label[64];
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) map.emplace(keys[index], index);
+	snprintf(label, sizeof(label), "emplace (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (map.find(keys[index]) != map.end());
+	snprintf(label, sizeof(label), "find (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count) { printf("find mismatch\n"); mismatchCount++; }
+
+	start = GetNanoseconds();
+	for(typename Map::const_iterator iterator = map.begin(); iterator != map.end(); ++iterator) sum += iterator->second;
+	snprintf(label, sizeof(label), "iterate (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(sum != (long long)count * (count - 1) / 2) { printf("iterate mismatch\n"); mismatchCount++; }
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) map.erase(keys[index]);
+	snprintf(label, sizeof(label), "erase (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(map.empty() == false) { printf("erase mismatch\n"); mismatchCount++; }
+}
+
+/**
+ * @fn static void BenchSet(const char *name, const std::vector<int> &keys, Insert insert)
+ * @brief 키만 저장할 때 삽입, 조회 시간을 측정하는 함수
+ * @param name 벤치마크 이름(입력, 읽기 전용)
+ * @param keys 삽입, 조회할 키 배열(입력, 읽기 전용)
+ * @param insert 키 하나를 추가하는 함수(입력)
+ * @return 반환값 없음
+ */
+template <class Set, class Insert>
+static void BenchSet(const char *name, const std::vector<int> &keys, Insert insert)
+{
+	Set set;
+	int count = (int)keys.size();
+	int index = 0;
+	int found = 0;
+	char label[64];
+
+	double start = GetNanoseconds();
+	for(index = 0; index < count; index++) insert(set, keys[index]);
+	snprintf(label, sizeof(label), "insert (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+
+	start = GetNanoseconds();
+	for(index = 0; index < count; index++) found += (int)set.count(keys[index]);
+	snprintf(label, sizeof(label), "count (%s)", name);
+	PrintResult(label, GetNanoseconds() - start, count);
+	if(found != count) { printf("count mismatch\n"); mismatchCount++; }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	std::vector<int> keys(BENCH_KEY_COUNT);
+	std::vector<std::string> stringKeys(BENCH_STRING_KEY_COUNT);
+	int index = 0;
+
+	srand(3939);
+	for(index = 0; index < BENCH_KEY_COUNT; index++) keys[index] = index;
+	for(index = BENCH_KEY_COUNT - 1; index > 0; index--) std::swap(keys[index], keys[rand() % (index + 1)]);
+	for(index = 0; index < BENCH_STRING_KEY_COUNT; index++)
+	{
+		char buffer[32];
+		snprintf(buffer, sizeof(buffer), "key-%08d", keys[index]);
+		stringKeys[index] = buffer;
+	}
+
+	// @ Map (int) --------------------------------------------------
+	BenchMap<std::map<int, int> >("std::map<int>", keys);
+	BenchMap<javl::tree<int, int> >("javl::tree<int>", keys);
+
+	// @ Map (string) -----------------------------------------------
+	BenchMap<std::map<std::string, int> >("std::map<string>", stringKeys);
+	BenchMap<javl::tree<std::string, int> >("javl::tree<string>", stringKeys);
+
+	// @ Set (int) --------------------------------------------------
+	BenchSet<std::set<int> >("std::set<int>", keys, [](std::set<int> &set, int key) { set.insert(key); });
+	BenchSet<javl::tree<int, Empty> >("javl::tree<int, Empty>", keys, [](javl::tree<int, Empty> &set, int key) { set.try_emplace(key); });
+
+	// @ <algorithm> ------------------------------------------------
+	javl::tree<int, int> tree;
+	for(index = 0; index < 1000; index++) tree.emplace(keys[index], index);
+	bool isSorted = std::is_sorted(tree.begin(), tree.end(), [](const std::pair<const int, int> &left, const std::pair<const int, int> &right) { return left.first < right.first; });
+	long long distance = (long long)std::distance(tree.rbegin(), tree.rend());
+	if(isSorted == false || distance != 1000) { printf("algorithm mismatch\n"); mismatchCount++; }
+
+	return (mismatchCount > 0) ? 1 : 0;
+}
+
@@ -1,6 +1,12 @@
 #ifndef __JAVLTREE_H__
 #define __JAVLTREE_H__
 
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Enums
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,34 +35,220 @@ typedef enum KeyType
 	Unknown = -1,
 	IntType = 1,
 	CharType,
-	StringType
+	StringType,
+	// 닫힌 정수 구간 (JInterval, 시작 값 다음 끝 값 순서로 정렬)
+	IntervalType,
+	// 사용자 정의 키 (JAVLTreeSetCompare 로 비교 함수를 설정해야 함)
+	CustomType
 } KeyType;
 
+// 점 검색(키가 같은 노드 찾기) 방식 열거형
+typedef enum JAVLTreeLookup
+{
+	// 트리를 내려가서 찾음 (O(log n))
+	LookupTree = 1,
+	// 트리와 함께 갱신되는 해시 색인에서 찾음 (평균 O(1), 범위 검색과 순회는 트리 사용)
+	LookupHash
+} JAVLTreeLookup;
+
+// 균형 정책 열거형 (키 순서와 API 는 같고, 삽입, 삭제 후 균형을 맞추는 방법만 다름)
+typedef enum JAVLTreeBalance
+{
+	// 양쪽 높이 차이 1 이하 (JNode.height 는 높이), 트리가 가장 낮지만 삭제 시 루트까지 회전할 수 있음
+	BalanceAVL = 1,
+	// Weak AVL (JNode.height 는 랭크), 삽입만 하면 AVL 과 같고 삭제 시 회전은 최대 2 번
+	BalanceWAVL,
+	// Red-Black (JNode.height 는 색), 삽입 시 회전 최대 2 번, 삭제 시 최대 3 번
+	BalanceRedBlack
+} JAVLTreeBalance;
+
+// 키 소유 방식 열거형
+typedef enum JAVLTreeKeyOwner
+{
+	// 호출한 쪽이 키 메모리를 소유 (트리는 키 주소만 저장하므로 노드가 있는 동안 키를 유지해야 함)
+	KeyOwnerCaller = 1,
+	// 트리가 추가할 때 키를 복사해서 소유 (JAVLTREE_INLINE_KEY_SIZE 이하는 노드 안에, 나머지는 키 저장 블록에 저장)
+	KeyOwnerTree
+} JAVLTreeKeyOwner;
+
+// 노드 재배치 순서 열거형 (JAVLTreeCompact 참고)
+typedef enum JAVLTreeLayout
+{
+	// 키 순서대로 배치 (범위 검색, 순회가 메모리를 차례로 읽음)
+	LayoutInOrder = 1,
+	// van Emde Boas 순서로 배치 (위쪽 절반 높이의 트리 다음에 아래쪽 하위 트리들을 재귀적으로 배치, 점 검색 경로가 적은 캐시 라인에 모임)
+	LayoutVanEmdeBoas
+} JAVLTreeLayout;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Macro
 ///////////////////////////////////////////////////////////////////////////////
 
+// 지연 삭제 모드에서 삭제 표시된 노드 (JNode.flags)
+#define JNODE_FLAG_TOMBSTONE 0x1
+// 완화 균형 모드에서 하위 트리의 균형을 아직 맞추지 않은 노드 (JNode.flags)
+#define JNODE_FLAG_UNBALANCED 0x2
+// JAVLTreeInsertNode 로 연결되어 호출한 쪽이 소유하는 노드, JAVLTreeCompact 가 옮기지 않음 (JNode.flags)
+#define JNODE_FLAG_EXTERNAL 0x4
+// 만료 시각이 없음 (JAVLTreeSetExpire 에 지정하면 만료 시각을 지움)
+#define JAVLTREE_NO_EXPIRE 0x7fffffffffffffffLL
+// 트리가 키를 소유할 때 노드 안에 저장하는 키의 최대 바이트 수 (문자열은 NULL 문자 포함, 15 글자까지)
+#define JAVLTREE_INLINE_KEY_SIZE 16
 
 ///////////////////////////////////////////////////////////////////////////////
 /// Definitions
 ///////////////////////////////////////////////////////////////////////////////
 
+// 변경 기록 로그 구조체 (jwal.h 참고)
+struct _jwal_t;
+// 없는 키 검색을 빠르게 거르는 Bloom Filter 구조체 (jbloomfilter.h 참고)
+struct _jbloom_t;
+// 자주 찾는 키의 노드를 기억하는 검색 캐시 구조체 (jlookupcache.h 참고)
+struct _jlookup_cache_t;
+// 트리가 소유하는 키 저장 블록 구조체 (javltree.c 참고)
+struct _jkey_block_t;
+// 키에서 노드를 바로 찾는 해시 색인 구조체 (jhashindex.h 참고)
+struct _jhash_index_t;
+// 만료 시각 순서로 노드를 꺼내는 최소 힙 구조체 (javltree.c 참고)
+struct _jexpiry_heap_t;
+// 재배치한 노드를 연속해서 저장하는 블록 구조체 (javltree.c 참고)
+struct _jnode_slab_t;
+
+// IntervalType 키로 사용하는 닫힌 정수 구간 구조체 [start, end]
+typedef struct _jinterval_t {
+	// 구간 시작 값
+	int start;
+	// 구간 끝 값 (start 이상)
+	int end;
+} JInterval, *JIntervalPtr;
+
 // Linked List 에서 key 를 관리하기 위한 노드 구조체
 typedef struct _jnode_t {
 	// Value
 	void *key;
-	// 이전 노드 주소
+	// 왼쪽 자식 노드 주소
 	struct _jnode_t *left;
-	// 다음 노드 주소
+	// 오른쪽 자식 노드 주소
 	struct _jnode_t *right;
+	// 부모 노드 주소
+	struct _jnode_t *parent;
+	// 균형 정보 (AVL 은 하위 트리의 높이, WAVL 은 랭크, Red-Black 은 색, JAVLTreeBalance 참고)
+	int height;
+	// 노드 상태 플래그 (JNODE_FLAG_TOMBSTONE, JNODE_FLAG_UNBALANCED 참고)
+	int flags;
 } JNode, *JNodePtr, **JNodePtrContainer;
 
+// 하위 트리 집계 값 정의 구조체 (결합 법칙을 만족하는 연산과 항등원, 예: 합, 최솟값, 최댓값)
+// 노드마다 자신을 루트로 하는 하위 트리의 키들을 순서대로 결합한 값을 저장한다.
+typedef struct _javltree_augment_t {
+	// 노드 하나에 저장할 집계 값 크기 (바이트), 0 이면 사용하지 않음
+	size_t aggregateSize;
+	// 빈 범위의 집계 값(항등원)을 저장하는 함수
+	void (*identity)(void *aggregate, void *userData);
+	// 키 하나의 집계 값을 저장하는 함수
+	void (*lift)(void *aggregate, const void *key, void *userData);
+	// left 다음에 right 를 결합한 값을 result 에 저장하는 함수 (result 는 left 또는 right 와 같은 주소일 수 있음)
+	void (*combine)(void *result, const void *left, const void *right, void *userData);
+	// 함수들에 전달할 사용자 데이터
+	void *userData;
+} JAVLTreeAugment, *JAVLTreeAugmentPtr;
+
+// CustomType 키 비교 함수 (key1 이 작으면 음수, 같으면 0, 크면 양수 반환)
+typedef int (*JAVLTreeCompareFunc)(const void *key1, const void *key2, void *userData);
+
+// 만료 검사에 사용할 현재 시각을 반환하는 함수 (단위는 만료 시각과 같아야 함)
+typedef long long (*JAVLTreeClockFunc)(void *userData);
+
+// 트리 내부 메모리 할당 함수 (실패 시 NULL 반환)
+typedef void* (*JAVLTreeAllocFunc)(size_t size, void *context);
+
+// 트리 내부 메모리 해제 함수 (pointer 가 NULL 이면 아무것도 하지 않아야 함)
+typedef void (*JAVLTreeFreeFunc)(void *pointer, void *context);
+
+// AVL Tree 가 노드, 키 저장 블록, 색인, 힙, 임시 배열 등 내부 메모리를 할당할 때 사용하는 할당자 구조체
+typedef struct _javltree_allocator_t {
+	// 할당 함수
+	JAVLTreeAllocFunc alloc;
+	// 해제 함수
+	JAVLTreeFreeFunc free;
+	// 할당, 해제 함수에 전달할 사용자 데이터 (메모리 풀, 아레나 등)
+	void *context;
+} JAVLTreeAllocator, *JAVLTreeAllocatorPtr;
+
+// AVL Tree 생성 옵션 구조체 (NewJAVLTreeEx 참고), 0 으로 채우면 NewJAVLTree 와 같음
+typedef struct _javltree_options_t {
+	// 점 검색 방식 (0 이면 LookupTree)
+	JAVLTreeLookup lookup;
+	// LookupHash 에서 해시 색인의 처음 칸 개수 (0 이면 기본값)
+	unsigned int hashCapacity;
+	// 균형 정책 (0 이면 BalanceAVL)
+	JAVLTreeBalance balance;
+	// 키 소유 방식 (0 이면 KeyOwnerCaller)
+	JAVLTreeKeyOwner keyOwner;
+	// 내부 메모리 할당자 (NULL 이면 malloc, free)
+	JAVLTreeAllocatorPtr allocator;
+} JAVLTreeOptions, *JAVLTreeOptionsPtr;
+
 // AVL Tree 구조체
 typedef struct _javltree_t {
 	// 키 데이터 유형
 	KeyType type;
+	// 균형 정책
+	JAVLTreeBalance balance;
+	// 키 소유 방식
+	JAVLTreeKeyOwner keyOwner;
+	// 내부 메모리 할당자 (함수가 NULL 이면 malloc, free)
+	JAVLTreeAllocator allocator;
 	// 루트 노드
 	JNodePtr root;
+	// 가장 작은 키를 가진 노드
+	JNodePtr min;
+	// 가장 큰 키를 가진 노드
+	JNodePtr max;
+	// 마지막으로 추가된 노드 (힌트 삽입 시 기본 시작 위치)
+	JNodePtr finger;
+	// 변경 기록 로그, 연결되어 있으면 추가, 삭제 성공 시 기록 (없으면 NULL)
+	struct _jwal_t *wal;
+	// 검색 전에 확인하는 Bloom Filter, 연결되어 있으면 추가, 삭제 시 함께 갱신 (없으면 NULL)
+	struct _jbloom_t *bloom;
+	// 검색 전에 확인하는 검색 캐시, 연결되어 있으면 추가, 삭제 시 해당 항목을 지움 (없으면 NULL)
+	struct _jlookup_cache_t *cache;
+	// 점 검색에 사용하는 해시 색인, 삭제 표시되지 않은 노드를 모두 가짐 (LookupHash 가 아니면 NULL, 트리가 소유)
+	struct _jhash_index_t *index;
+	// 만료 시각이 있는 노드의 최소 힙 (JAVLTreeEnableExpiry 로 설정, 없으면 NULL, 트리가 소유)
+	struct _jexpiry_heap_t *expiry;
+	// 트리가 소유하는 키 저장 블록 목록 (트리 삭제 시 함께 해제)
+	struct _jkey_block_t *keyBlocks;
+	// PopMin, PopMax 가 노드 안에 저장된 키를 옮겨서 반환하는 공간 (다음 PopMin, PopMax 까지 유효)
+	unsigned long long poppedKey[JAVLTREE_INLINE_KEY_SIZE / sizeof(unsigned long long)];
+	// 재배치한 노드 블록 목록 (블록의 노드가 모두 해제되면 블록도 해제)
+	struct _jnode_slab_t *nodeSlabs;
+	// JAVLTreeCompactStep 이 채우고 있는 노드 블록 (진행 중이 아니면 NULL)
+	struct _jnode_slab_t *compactSlab;
+	// JAVLTreeCompactStep 이 다음에 옮길 노드 (키 순서)
+	JNodePtr compactCursor;
+	// 트리에 연결된 노드 개수 (삭제 표시된 노드 포함)
+	int nodeCount;
+	// JAVLTreeInsertNode 로 연결된, 호출한 쪽이 할당한 노드 개수 (0 이 아니면 지연 삭제 모드를 켤 수 없음)
+	int externalCount;
+	// 지금까지 균형을 맞추기 위해 회전한 횟수 (이중 회전은 2 번)
+	unsigned long long rotationCount;
+	// 완화 균형 모드 여부, 1 이면 추가, 삭제 시 회전하지 않고 균형이 깨진 경로만 표시
+	int relaxed;
+	// 완화 균형 모드에서 추가, 삭제할 때마다 수행할 균형 작업량, 0 이면 JAVLTreeRebalanceStep 으로만 수행
+	int relaxStepBudget;
+	// 완화 균형 모드에서 다음 작업을 찾기 시작할 노드 (마지막으로 처리한 노드의 부모, 없으면 루트부터)
+	JNodePtr relaxCursor;
+	// 삭제 표시된 노드 개수
+	int tombstoneCount;
+	// 지연 삭제 모드에서 정리를 시작할 삭제 표시 노드 비율(%), 0 이면 바로 삭제
+	int tombstoneThreshold;
+	// 하위 트리 집계 값 정의 (aggregateSize 가 0 이면 사용하지 않음)
+	JAVLTreeAugment augment;
+	// CustomType 키 비교 함수
+	JAVLTreeCompareFunc compare;
+	// 비교 함수에 전달할 사용자 데이터
+	void *compareData;
 	// 사용자 데이터
 	void *data;
 } JAVLTree, *JAVLTreePtr, **JAVLTreePtrContainer;
@@ -69,23 +261,81 @@ JNodePtr NewJNode();
 DeleteResult DeleteJNode(JNodePtrContainer container);
 void* JNodeGetKey(const JNodePtr node);
 void* JNodeSetKey(JNodePtr node, void *key);
+JNodePtr JNodeGetNext(const JNodePtr node);
+JNodePtr JNodeGetPrev(const JNodePtr node);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JAVLTree
 ///////////////////////////////////////////////////////////////////////////////
 
 JAVLTreePtr NewJAVLTree(KeyType type);
+JAVLTreePtr NewJAVLTreeEx(KeyType type, const JAVLTreeOptionsPtr options);
 DeleteResult DeleteJAVLTree(JAVLTreePtrContainer container);
 
 void* JAVLTreeGetData(const JAVLTreePtr tree);
 void* JAVLTreeSetData(JAVLTreePtr tree, void *data);
+void* JAVLTreeAlloc(const JAVLTreePtr tree, size_t size);
+void JAVLTreeFree(const JAVLTreePtr tree, void *pointer);
+
+JAVLTreePtr JAVLTreeSetLazyDelete(JAVLTreePtr tree, int thresholdPercent);
+JAVLTreePtr JAVLTreePurgeTombstones(JAVLTreePtr tree);
+int JAVLTreeGetSize(const JAVLTreePtr tree);
+int JAVLTreeGetTombstoneCount(const JAVLTreePtr tree);
+unsigned long long JAVLTreeGetRotationCount(const JAVLTreePtr tree);
+JAVLTreePtr JAVLTreeSetRelaxed(JAVLTreePtr tree, int isRelaxed, int stepBudget);
+int JAVLTreeRebalanceStep(JAVLTreePtr tree, int budget);
+JAVLTreePtr JAVLTreeCompact(JAVLTreePtr tree, JAVLTreeLayout layout);
+int JAVLTreeCompactStep(JAVLTreePtr tree, int budget);
+
+JAVLTreePtr JAVLTreeAttachWAL(JAVLTreePtr tree, struct _jwal_t *wal);
+void* JAVLTreeStoreKey(JAVLTreePtr tree, const void *key);
+JAVLTreePtr JAVLTreeAttachBloomFilter(JAVLTreePtr tree, struct _jbloom_t *filter);
+JAVLTreePtr JAVLTreeAttachLookupCache(JAVLTreePtr tree, struct _jlookup_cache_t *cache);
+unsigned long long JAVLTreeHashKey(const void *key, KeyType type);
+
+JAVLTreePtr JAVLTreeSetAugment(JAVLTreePtr tree, const JAVLTreeAugmentPtr augment);
+const void* JAVLTreeGetAggregate(const JAVLTreePtr tree, const JNodePtr node);
+JAVLTreePtr JAVLTreeAggregateRange(const JAVLTreePtr tree, void *lowKey, void *highKey, void *result);
+
+JAVLTreePtr JAVLTreeSetCompare(JAVLTreePtr tree, JAVLTreeCompareFunc compare, void *userData);
+int JAVLTreeCompare(const JAVLTreePtr tree, const void *key1, const void *key2);
+
+JAVLTreePtr JAVLTreeEnableExpiry(JAVLTreePtr tree, JAVLTreeClockFunc clock, void *userData);
+JNodePtr JAVLTreeAddNodeExpire(JAVLTreePtr tree, void *key, long long expireAt);
+JNodePtr JAVLTreeSetExpire(JAVLTreePtr tree, JNodePtr node, long long expireAt);
+long long JAVLTreeGetExpire(const JAVLTreePtr tree, const JNodePtr node);
+int JAVLTreeExpire(JAVLTreePtr tree, long long now, int maxCount);
 
 JAVLTreePtr JAVLTreeAddNode(JAVLTreePtr tree, void *data);
+JNodePtr JAVLTreeAddNodeHint(JAVLTreePtr tree, JNodePtr hint, void *key);
 DeleteResult JAVLTreeDeleteNodeKey(JAVLTreePtr tree, void *key);
 
+JNodePtr JAVLTreeInsertNode(JAVLTreePtr tree, JNodePtr node);
+JNodePtr JAVLTreeExtractNode(JAVLTreePtr tree, JNodePtr node);
+JAVLTreePtr JAVLTreeClear(JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData);
+
+JNodePtr JAVLTreeFindNode(const JAVLTreePtr tree, void *key);
+int JAVLTreeFindBatch(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results);
+
+JNodePtr JAVLTreeGetMin(const JAVLTreePtr tree);
+JNodePtr JAVLTreeGetMax(const JAVLTreePtr tree);
+void* JAVLTreePopMin(JAVLTreePtr tree);
+void* JAVLTreePopMax(JAVLTreePtr tree);
+
 void JAVLTreePreorderTraverse(const JAVLTreePtr tree);
 void JAVLTreeInorderTraverse(const JAVLTreePtr tree);
 void JAVLTreePostorderTraverse(const JAVLTreePtr tree);
 
+JNodePtr JAVLTreeLowerBound(const JAVLTreePtr tree, void *key);
+JNodePtr JAVLTreeUpperBound(const JAVLTreePtr tree, void *key);
+JNodePtr JAVLTreeFloor(const JAVLTreePtr tree, void *key);
+JNodePtr JAVLTreeCeiling(const JAVLTreePtr tree, void *key);
+JNodePtr JAVLTreePredecessor(const JAVLTreePtr tree, void *key);
+JNodePtr JAVLTreeSuccessor(const JAVLTreePtr tree, void *key);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
 
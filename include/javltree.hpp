@@ -0,0 +1,383 @@
+#ifndef __JAVLTREE_HPP__
+#define __JAVLTREE_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "javltree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// C++ Wrapper (header only, C++11)
+///////////////////////////////////////////////////////////////////////////////
+
+namespace javl
+{
+
+/**
+ * @class tree
+ * @brief JAVLTree 를 사용하는 std::map 형태의 정렬된 키-값 컨테이너
+ * 키와 값은 노드와 함께 한 번에 할당되며(노드 하나 당 할당 한 번), 노드는 CustomType 트리에 직접 연결된다.
+ * 복사할 수 없고 이동만 가능하며, 소멸할 때 모든 노드를 해제한다.
+ * 비교 함수는 예외를 던지면 안 된다. (C 코드를 통과하지 않도록 예외가 나면 std::terminate 가 호출된다)
+ * native_handle() 로 얻은 트리에 JAVLTreeAddNode, JAVLTreeDeleteNodeKey, PopMin/PopMax 를 호출하면 안 된다.
+ */
+template <class K, class V, class Compare = std::less<K>, class Alloc = std::allocator<std::pair<const K, V> > >
+class tree
+{
+public:
+	typedef K key_type;
+	typedef V mapped_type;
+	typedef std::pair<const K, V> value_type;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef Compare key_compare;
+	typedef Alloc allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+
+private:
+	// JNode 뒤에 값을 저장하는 노드 구조체 (JNode 주소를 그대로 변환해서 값을 찾는다)
+	struct node : public JNode
+	{
+		typename std::aligned_storage<sizeof(value_type), std::alignment_of<value_type>::value>::type storage;
+
+		value_type* value() { return reinterpret_cast<value_type*>(&storage); }
+	};
+
+	typedef typename std::allocator_traits<Alloc>::template rebind_alloc<node> node_allocator;
+	typedef std::allocator_traits<node_allocator> node_traits;
+	typedef std::allocator_traits<Alloc> value_traits;
+
+	// 이동해도 주소가 바뀌지 않아야 하는 상태 (C 트리가 비교 함수의 사용자 데이터로 이 주소를 가진다)
+	struct impl
+	{
+		JAVLTreePtr handle;
+		Compare comp;
+		Alloc valueAlloc;
+		node_allocator nodeAlloc;
+
+		impl(const Compare &compare, const Alloc &alloc) : handle(NULL), comp(compare), valueAlloc(alloc), nodeAlloc(alloc) {}
+	};
+
+	template <bool IsConst>
+	class basic_iterator
+	{
+	public:
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef typename tree::value_type value_type;
+		typedef typename tree::difference_type difference_type;
+		typedef typename std::conditional<IsConst, const value_type*, value_type*>::type pointer;
+		typedef typename std::conditional<IsConst, const value_type&, value_type&>::type reference;
+
+		basic_iterator() : node_(NULL), handle_(NULL) {}
+		basic_iterator(JNodePtr position, JAVLTreePtr handle) : node_(position), handle_(handle) {}
+		// iterator 에서 const_iterator 로의 변환
+		template <bool OtherConst, class = typename std::enable_if<IsConst && !OtherConst>::type>
+		basic_iterator(const basic_iterator<OtherConst> &other) : node_(other.node_), handle_(other.handle_) {}
+
+		reference operator*() const { return *static_cast<node*>(node_)->value(); }
+		pointer operator->() const { return static_cast<node*>(node_)->value(); }
+
+		basic_iterator& operator++() { node_ = JNodeGetNext(node_); return *this; }
+		basic_iterator operator++(int) { basic_iterator previous = *this; ++(*this); return previous; }
+		// end() 에서 감소하면 가장 큰 키로 이동한다.
+		basic_iterator& operator--() { node_ = (node_ != NULL) ? JNodeGetPrev(node_) : JAVLTreeGetMax(handle_); return *this; }
+		basic_iterator operator--(int) { basic_iterator previous = *this; --(*this); return previous; }
+
+		bool operator==(const basic_iterator &other) const { return node_ == other.node_; }
+		bool operator!=(const basic_iterator &other) const { return node_ != other.node_; }
+
+	private:
+		friend class tree;
+		template <bool> friend class basic_iterator;
+
+		JNodePtr node_;
+		JAVLTreePtr handle_;
+	};
+
+public:
+	typedef basic_iterator<false> iterator;
+	typedef basic_iterator<true> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Construction
+	////////////////////////////////////////////////////////////////////////////
+
+	tree() : impl_(create_impl(Compare(), Alloc())) {}
+	explicit tree(const Compare &compare, const Alloc &alloc = Alloc()) : impl_(create_impl(compare, alloc)) {}
+	explicit tree(const Alloc &alloc) : impl_(create_impl(Compare(), alloc)) {}
+
+	// 이동한 뒤 원래 객체는 소멸하거나 다른 객체를 이동 대입하는 것만 가능하다.
+	tree(tree &&other) noexcept : impl_(std::move(other.impl_)) {}
+	tree& operator=(tree &&other) noexcept
+	{
+		if(this != &other)
+		{
+			destroy();
+			impl_ = std::move(other.impl_);
+		}
+		return *this;
+	}
+
+	tree(const tree&) = delete;
+	tree& operator=(const tree&) = delete;
+
+	~tree() { destroy(); }
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Iterators
+	////////////////////////////////////////////////////////////////////////////
+
+	iterator begin() noexcept { return make_iterator(impl_ ? JAVLTreeGetMin(impl_->handle) : NULL); }
+	const_iterator begin() const noexcept { return make_iterator(impl_ ? JAVLTreeGetMin(impl_->handle) : NULL); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	iterator end() noexcept { return make_iterator(NULL); }
+	const_iterator end() const noexcept { return make_iterator(NULL); }
+	const_iterator cend() const noexcept { return end(); }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+	reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Capacity
+	////////////////////////////////////////////////////////////////////////////
+
+	bool empty() const noexcept { return size() == 0; }
+	size_type size() const noexcept { return impl_ ? static_cast<size_type>(JAVLTreeGetSize(impl_->handle)) : 0; }
+	size_type max_size() const noexcept { return static_cast<size_type>(std::numeric_limits<int>::max()); }
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Modifiers
+	////////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * @fn std::pair<iterator, bool> emplace(Args&&... args)
+	 * @brief 노드 안에 값을 바로 생성해서 추가하는 함수
+	 * 같은 키가 이미 있으면 생성한 노드를 해제하고 기존 노드를 반환한다.
+	 * @param args value_type 생성자에 전달할 인자(입력)
+	 * @return 추가된(또는 기존) 값의 반복자와 추가 여부
+	 */
+	template <class... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		node *newNode = create_node(std::forward<Args>(args)...);
+		if(JAVLTreeInsertNode(impl_->handle, newNode) != NULL) return std::make_pair(make_iterator(newNode), true);
+
+		JNodePtr existingNode = JAVLTreeFindNode(impl_->handle, newNode->key);
+		destroy_node(newNode);
+		return std::make_pair(make_iterator(existingNode), false);
+	}
+
+	/**
+	 * @fn std::pair<iterator, bool> try_emplace(const K &key, Args&&... args)
+	 * @brief 키가 없을 때만 노드를 생성해서 추가하는 함수 (키가 있으면 할당하지 않음)
+	 * @param key 추가할 키(입력)
+	 * @param args mapped_type 생성자에 전달할 인자(입력)
+	 * @return 추가된(또는 기존) 값의 반복자와 추가 여부
+	 */
+	template <class... Args>
+	std::pair<iterator, bool> try_emplace(const K &key, Args&&... args)
+	{
+		JNodePtr existingNode = find_node(key);
+		if(existingNode != NULL) return std::make_pair(make_iterator(existingNode), false);
+		return emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	template <class... Args>
+	std::pair<iterator, bool> try_emplace(K &&key, Args&&... args)
+	{
+		JNodePtr existingNode = find_node(key);
+		if(existingNode != NULL) return std::make_pair(make_iterator(existingNode), false);
+		return emplace(std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	std::pair<iterator, bool> insert(const value_type &value) { return try_emplace(value.first, value.second); }
+	std::pair<iterator, bool> insert(value_type &&value) { return emplace(std::move(value)); }
+
+	/**
+	 * @fn iterator erase(const_iterator position)
+	 * @brief 반복자가 가리키는 값을 삭제하는 함수
+	 * 키로 다시 찾지 않고 노드를 바로 떼어낸다.
+	 * @param position 삭제할 값의 반복자, end() 가 아니어야 함(입력)
+	 * @return 삭제한 값의 다음 반복자
+	 */
+	iterator erase(const_iterator position)
+	{
+		JNodePtr nextNode = JNodeGetNext(position.node_);
+		if(JAVLTreeExtractNode(impl_->handle, position.node_) != NULL) destroy_node(static_cast<node*>(position.node_));
+		return make_iterator(nextNode);
+	}
+
+	iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		while(first != last) first = erase(first);
+		return make_iterator(last.node_);
+	}
+
+	size_type erase(const K &key)
+	{
+		JNodePtr selectedNode = find_node(key);
+		if(selectedNode == NULL) return 0;
+		erase(make_iterator(selectedNode));
+		return 1;
+	}
+
+	// 모든 노드를 후위 순회하며 값을 소멸시키고 해제한다.
+	void clear() noexcept
+	{
+		if(impl_) JAVLTreeClear(impl_->handle, release_node, impl_.get());
+	}
+
+	void swap(tree &other) noexcept { impl_.swap(other.impl_); }
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Lookup
+	////////////////////////////////////////////////////////////////////////////
+
+	V& operator[](const K &key) { return try_emplace(key).first->second; }
+	V& operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+	V& at(const K &key)
+	{
+		JNodePtr selectedNode = find_node(key);
+		if(selectedNode == NULL) throw std::out_of_range("javl::tree::at");
+		return static_cast<node*>(selectedNode)->value()->second;
+	}
+
+	const V& at(const K &key) const
+	{
+		JNodePtr selectedNode = find_node(key);
+		if(selectedNode == NULL) throw std::out_of_range("javl::tree::at");
+		return static_cast<node*>(selectedNode)->value()->second;
+	}
+
+	iterator find(const K &key) { return make_iterator(find_node(key)); }
+	const_iterator find(const K &key) const { return make_iterator(find_node(key)); }
+	size_type count(const K &key) const { return find_node(key) != NULL ? 1 : 0; }
+	bool contains(const K &key) const { return find_node(key) != NULL; }
+
+	iterator lower_bound(const K &key) { return make_iterator(impl_ ? JAVLTreeLowerBound(impl_->handle, key_address(key)) : NULL); }
+	const_iterator lower_bound(const K &key) const { return make_iterator(impl_ ? JAVLTreeLowerBound(impl_->handle, key_address(key)) : NULL); }
+	iterator upper_bound(const K &key) { return make_iterator(impl_ ? JAVLTreeUpperBound(impl_->handle, key_address(key)) : NULL); }
+	const_iterator upper_bound(const K &key) const { return make_iterator(impl_ ? JAVLTreeUpperBound(impl_->handle, key_address(key)) : NULL); }
+
+	std::pair<iterator, iterator> equal_range(const K &key) { return std::make_pair(lower_bound(key), upper_bound(key)); }
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return std::make_pair(lower_bound(key), upper_bound(key)); }
+
+	////////////////////////////////////////////////////////////////////////////
+	/// Observers
+	////////////////////////////////////////////////////////////////////////////
+
+	key_compare key_comp() const { return impl_->comp; }
+	allocator_type get_allocator() const { return impl_->valueAlloc; }
+	// 내부 C 트리 (조회, 경계 검색, 집계 등 읽기 전용 함수에만 사용)
+	JAVLTreePtr native_handle() const noexcept { return impl_ ? impl_->handle : NULL; }
+
+private:
+	/**
+	 * @fn static std::unique_ptr<impl> create_impl(const Compare &compare, const Alloc &alloc)
+	 * @brief CustomType 트리를 만들고 비교 함수를 연결하는 함수
+	 * @return 생성된 상태 객체, 실패 시 std::bad_alloc 예외
+	 */
+	static std::unique_ptr<impl> create_impl(const Compare &compare, const Alloc &alloc)
+	{
+		std::unique_ptr<impl> newImpl(new impl(compare, alloc));
+		newImpl->handle = NewJAVLTree(CustomType);
+		if(newImpl->handle == NULL) throw std::bad_alloc();
+		JAVLTreeSetCompare(newImpl->handle, compare_keys, newImpl.get());
+		return newImpl;
+	}
+
+	// 모든 노드와 C 트리를 해제한다.
+	void destroy() noexcept
+	{
+		if(!impl_) return;
+		clear();
+		DeleteJAVLTree(&(impl_->handle));
+		impl_.reset();
+	}
+
+	// Compare 로 두 키를 세 방향 비교한다. (작으면 음수, 같으면 0, 크면 양수)
+	static int compare_keys(const void *key1, const void *key2, void *userData) noexcept
+	{
+		Compare &comp = static_cast<impl*>(userData)->comp;
+		const K &left = *static_cast<const K*>(key1);
+		const K &right = *static_cast<const K*>(key2);
+
+		if(comp(left, right)) return -1;
+		return comp(right, left) ? 1 : 0;
+	}
+
+	template <class... Args>
+	node* create_node(Args&&... args)
+	{
+		node *newNode = node_traits::allocate(impl_->nodeAlloc, 1);
+		::new(static_cast<void*>(newNode)) node();
+		try
+		{
+			value_traits::construct(impl_->valueAlloc, newNode->value(), std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			node_traits::deallocate(impl_->nodeAlloc, newNode, 1);
+			throw;
+		}
+		newNode->key = key_address(newNode->value()->first);
+		return newNode;
+	}
+
+	void destroy_node(node *oldNode) noexcept
+	{
+		value_traits::destroy(impl_->valueAlloc, oldNode->value());
+		oldNode->~node();
+		node_traits::deallocate(impl_->nodeAlloc, oldNode, 1);
+	}
+
+	// JAVLTreeClear 가 노드마다 호출하는 해제 함수
+	static void release_node(JNodePtr oldNode, void *userData)
+	{
+		impl *state = static_cast<impl*>(userData);
+		node *typedNode = static_cast<node*>(oldNode);
+		value_traits::destroy(state->valueAlloc, typedNode->value());
+		typedNode->~node();
+		node_traits::deallocate(state->nodeAlloc, typedNode, 1);
+	}
+
+	JNodePtr find_node(const K &key) const
+	{
+		if(!impl_) return NULL;
+		return JAVLTreeFindNode(impl_->handle, key_address(key));
+	}
+
+	static void* key_address(const K &key) { return const_cast<void*>(static_cast<const void*>(&key)); }
+
+	iterator make_iterator(JNodePtr position) noexcept { return iterator(position, native_handle()); }
+	const_iterator make_iterator(JNodePtr position) const noexcept { return const_iterator(position, native_handle()); }
+
+	std::unique_ptr<impl> impl_;
+};
+
+template <class K, class V, class Compare, class Alloc>
+void swap(tree<K, V, Compare, Alloc> &left, tree<K, V, Compare, Alloc> &right) noexcept
+{
+	left.swap(right);
+}
+
+}
+
+#endif
+
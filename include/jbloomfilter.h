@@ -0,0 +1,77 @@
+#ifndef __JBLOOMFILTER_H__
+#define __JBLOOMFILTER_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Enums
+///////////////////////////////////////////////////////////////////////////////
+
+// Bloom Filter 종류 열거형
+typedef enum JBloomMode
+{
+	// 블록 당 비트 배열, 삭제를 반영하지 못함
+	BloomBlocked = 1,
+	// 블록 당 4 비트 카운터 배열, 삭제 지원 (같은 크기에서 칸 수는 1/4)
+	BloomCounting
+} JBloomMode;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 블록 하나의 크기 (캐시 라인 크기)
+#define JBLOOM_BLOCK_SIZE 64
+// 키 하나가 사용하는 최대 해시 함수 개수
+#define JBLOOM_MAX_HASH_COUNT 16
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 블록 단위 Bloom Filter 구조체, 키 하나는 한 블록(캐시 라인) 안에서만 검사한다.
+typedef struct _jbloom_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 종류
+	JBloomMode mode;
+	// 블록 배열 (JBLOOM_BLOCK_SIZE 바이트 정렬)
+	unsigned char *blocks;
+	// 블록 개수
+	unsigned int blockCount;
+	// 블록 하나의 칸 개수 (비트 또는 4 비트 카운터)
+	unsigned int slotsPerBlock;
+	// 키 하나 당 검사하는 칸 개수
+	int hashCount;
+	// 검사 횟수
+	unsigned long long queryCount;
+	// 없다고 확정한 횟수
+	unsigned long long negativeCount;
+	// 있을 수 있다고 했지만 실제로는 없었던 횟수
+	unsigned long long falsePositiveCount;
+} JBloomFilter, *JBloomFilterPtr, **JBloomFilterPtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JBloomFilter
+///////////////////////////////////////////////////////////////////////////////
+
+JBloomFilterPtr NewJBloomFilter(KeyType type, JBloomMode mode, unsigned int expectedKeyCount, int slotsPerKey);
+DeleteResult DeleteJBloomFilter(JBloomFilterPtrContainer container);
+
+void JBloomFilterClear(JBloomFilterPtr filter);
+void JBloomFilterAdd(JBloomFilterPtr filter, const void *key);
+void JBloomFilterRemove(JBloomFilterPtr filter, const void *key);
+FindResult JBloomFilterMayContain(const JBloomFilterPtr filter, const void *key);
+
+double JBloomFilterGetFalsePositiveRate(const JBloomFilterPtr filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
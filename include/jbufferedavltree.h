@@ -0,0 +1,83 @@
+#ifndef __JBUFFEREDAVLTREE_H__
+#define __JBUFFEREDAVLTREE_H__
+
+#include <pthread.h>
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 버퍼 크기를 지정하지 않았을 때 사용하는 버퍼 하나의 키 개수
+#define JINSERT_BUFFER_DEFAULT_CAPACITY 256
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+struct _jbuffered_avltree_t;
+
+// 스레드 하나가 키를 모아 두는 정렬된 삽입 버퍼 구조체
+typedef struct _jinsert_buffer_t {
+	// 버퍼가 속한 앞단 구조체
+	struct _jbuffered_avltree_t *owner;
+	// 트리의 키 순서로 정렬된 키 주소 배열
+	void **keys;
+	// 저장된 키 개수
+	int count;
+	// 최대 키 개수, 가득 차면 공유 트리로 합친다
+	int capacity;
+	// 버퍼 잠금 (소유 스레드와 검색, 전체 합치기만 사용하므로 보통 경쟁이 없다)
+	pthread_mutex_t lock;
+	// 앞단의 버퍼 목록에서 다음 버퍼
+	struct _jinsert_buffer_t *next;
+} JInsertBuffer, *JInsertBufferPtr, **JInsertBufferPtrContainer;
+
+// 스레드마다 삽입 버퍼를 두고 공유 AVL Tree 에는 한꺼번에 합치는 앞단 구조체
+// 합칠 때는 공유 트리에 먼저 추가하고 버퍼를 비우며, 검색은 버퍼를 먼저 보고 트리를 보므로 추가된 키는 항상 찾을 수 있다.
+typedef struct _jbuffered_avltree_t {
+	// 공유 AVL Tree (소유하지 않으므로 앞단보다 나중에 삭제해야 함)
+	JAVLTreePtr tree;
+	// 공유 트리 잠금
+	pthread_mutex_t treeLock;
+	// 버퍼 목록 잠금
+	pthread_mutex_t listLock;
+	// 버퍼 목록
+	JInsertBufferPtr buffers;
+	// 새 버퍼의 최대 키 개수
+	int bufferCapacity;
+	// 버퍼를 공유 트리로 합친 횟수 (공유 트리 잠금을 잡은 횟수)
+	unsigned long long mergeCount;
+} JBufferedAVLTree, *JBufferedAVLTreePtr, **JBufferedAVLTreePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JBufferedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+JBufferedAVLTreePtr NewJBufferedAVLTree(JAVLTreePtr tree, int bufferCapacity);
+DeleteResult DeleteJBufferedAVLTree(JBufferedAVLTreePtrContainer container);
+
+int JBufferedAVLTreeFlush(JBufferedAVLTreePtr front);
+void* JBufferedAVLTreeFindKey(JBufferedAVLTreePtr front, void *key);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JInsertBuffer
+///////////////////////////////////////////////////////////////////////////////
+
+JInsertBufferPtr NewJInsertBuffer(JBufferedAVLTreePtr front);
+DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container);
+
+JInsertBufferPtr JInsertBufferAddKey(JInsertBufferPtr buffer, void *key);
+int JInsertBufferFlush(JInsertBufferPtr buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,59 @@
+#ifndef __JCHARBITMAP_H__
+#define __JCHARBITMAP_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// char 키 256 개를 표시하는 64 비트 단어 개수
+#define JCHAR_BITMAP_WORD_COUNT 4
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// CharType 키 집합을 256 비트로 저장하는 구조체 (32 바이트)
+// 키마다 비트 하나를 쓰므로 추가, 삭제, 검색은 O(1) 이고, 순서 탐색과 순위는 단어 단위의 비트 세기로 구한다.
+// 비트 위치는 char 의 비교 순서와 같으므로 CharType AVL Tree 와 같은 순서로 순회한다.
+typedef struct _jchar_bitmap_t {
+	// 키 존재 비트 (작은 키부터 words[0] 의 최하위 비트)
+	unsigned long long words[JCHAR_BITMAP_WORD_COUNT];
+} JCharBitmap, *JCharBitmapPtr, **JCharBitmapPtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JCharBitmap
+///////////////////////////////////////////////////////////////////////////////
+
+JCharBitmapPtr NewJCharBitmap();
+DeleteResult DeleteJCharBitmap(JCharBitmapPtrContainer container);
+
+void JCharBitmapClear(JCharBitmapPtr bitmap);
+int JCharBitmapGetSize(const JCharBitmapPtr bitmap);
+
+JCharBitmapPtr JCharBitmapAddKey(JCharBitmapPtr bitmap, const void *key);
+DeleteResult JCharBitmapDeleteKey(JCharBitmapPtr bitmap, const void *key);
+FindResult JCharBitmapFindKey(const JCharBitmapPtr bitmap, const void *key);
+
+FindResult JCharBitmapGetMin(const JCharBitmapPtr bitmap, char *result);
+FindResult JCharBitmapGetMax(const JCharBitmapPtr bitmap, char *result);
+FindResult JCharBitmapCeiling(const JCharBitmapPtr bitmap, const void *key, char *result);
+FindResult JCharBitmapFloor(const JCharBitmapPtr bitmap, const void *key, char *result);
+FindResult JCharBitmapSuccessor(const JCharBitmapPtr bitmap, const void *key, char *result);
+FindResult JCharBitmapPredecessor(const JCharBitmapPtr bitmap, const void *key, char *result);
+
+int JCharBitmapRank(const JCharBitmapPtr bitmap, const void *key);
+int JCharBitmapCountRange(const JCharBitmapPtr bitmap, const void *lowKey, const void *highKey);
+
+void JCharBitmapInorderTraverse(const JCharBitmapPtr bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
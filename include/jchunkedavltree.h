@@ -0,0 +1,78 @@
+#ifndef __JCHUNKEDAVLTREE_H__
+#define __JCHUNKEDAVLTREE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 노드 하나에 저장하는 최대 키 개수 (8 ~ 32, 짝수)
+#ifndef JCHUNK_CAPACITY
+#define JCHUNK_CAPACITY 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 정렬된 키 배열을 가지는 노드 구조체
+// 왼쪽 하위 트리의 키는 모두 keys[0] 보다 작고, 오른쪽 하위 트리의 키는 모두 keys[count - 1] 보다 크다.
+typedef struct _jchunk_node_t {
+	// 왼쪽 자식 노드 주소
+	struct _jchunk_node_t *left;
+	// 오른쪽 자식 노드 주소
+	struct _jchunk_node_t *right;
+	// 이 노드를 루트로 하는 하위 트리의 높이
+	int height;
+	// 저장된 키 개수
+	int count;
+	// 키 순서를 유지하는 64 비트 값 배열 (정수는 값, 문자열은 앞 8 바이트)
+	unsigned long long ranks[JCHUNK_CAPACITY];
+	// 키 주소 배열
+	void *keys[JCHUNK_CAPACITY];
+} JChunkNode, *JChunkNodePtr;
+
+// 노드마다 여러 키를 저장하는 AVL Tree 구조체 (T-Tree)
+typedef struct _jchunked_avltree_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 루트 노드
+	JChunkNodePtr root;
+	// 저장된 키 개수
+	unsigned int size;
+	// 노드 개수
+	unsigned int nodeCount;
+	// 사용자 데이터
+	void *data;
+} JChunkedAVLTree, *JChunkedAVLTreePtr, **JChunkedAVLTreePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JChunkedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+JChunkedAVLTreePtr NewJChunkedAVLTree(KeyType type);
+DeleteResult DeleteJChunkedAVLTree(JChunkedAVLTreePtrContainer container);
+
+unsigned int JChunkedAVLTreeGetSize(const JChunkedAVLTreePtr tree);
+
+JChunkedAVLTreePtr JChunkedAVLTreeAddKey(JChunkedAVLTreePtr tree, void *key);
+DeleteResult JChunkedAVLTreeDeleteKey(JChunkedAVLTreePtr tree, const void *key);
+void* JChunkedAVLTreeFindKey(const JChunkedAVLTreePtr tree, const void *key);
+
+void* JChunkedAVLTreeGetMin(const JChunkedAVLTreePtr tree);
+void* JChunkedAVLTreeGetMax(const JChunkedAVLTreePtr tree);
+void* JChunkedAVLTreeLowerBound(const JChunkedAVLTreePtr tree, const void *key);
+
+void JChunkedAVLTreeInorderTraverse(const JChunkedAVLTreePtr tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
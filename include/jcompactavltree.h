@@ -0,0 +1,73 @@
+#ifndef __JCOMPACTAVLTREE_H__
+#define __JCOMPACTAVLTREE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 노드가 없음을 나타내는 인덱스 (0 번 노드는 빈 노드로 예약)
+#define JCOMPACT_NULL_INDEX 0U
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 배열에 저장되는 16 바이트 노드 구조체, 자식 노드는 32 비트 인덱스로 연결
+typedef struct _jcompact_node_t {
+	// 키 값 (포인터가 아닌 값을 직접 저장)
+	int key;
+	// 왼쪽 자식 노드 인덱스 (빈 슬롯일 때는 다음 빈 슬롯 인덱스)
+	unsigned int left;
+	// 오른쪽 자식 노드 인덱스
+	unsigned int right;
+	// 이 노드를 루트로 하는 하위 트리의 높이
+	int height;
+} JCompactNode, *JCompactNodePtr;
+
+// 노드들을 하나의 배열에 저장하는 AVL Tree 구조체
+typedef struct _jcompact_avltree_t {
+	// 키 데이터 유형 (IntType, CharType 만 가능)
+	KeyType type;
+	// 노드 배열
+	JCompactNodePtr nodes;
+	// 노드 배열의 크기
+	unsigned int capacity;
+	// 한 번이라도 사용된 노드 슬롯 개수 (0 번 포함)
+	unsigned int used;
+	// 저장된 키 개수
+	unsigned int size;
+	// 루트 노드 인덱스
+	unsigned int root;
+	// 삭제된 노드 슬롯 목록의 첫 번째 인덱스
+	unsigned int freeList;
+	// 사용자 데이터
+	void *data;
+} JCompactAVLTree, *JCompactAVLTreePtr, **JCompactAVLTreePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JCompactAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+JCompactAVLTreePtr NewJCompactAVLTree(KeyType type);
+DeleteResult DeleteJCompactAVLTree(JCompactAVLTreePtrContainer container);
+
+JCompactAVLTreePtr JCompactAVLTreeReserve(JCompactAVLTreePtr tree, unsigned int capacity);
+unsigned int JCompactAVLTreeGetSize(const JCompactAVLTreePtr tree);
+
+JCompactAVLTreePtr JCompactAVLTreeAddKey(JCompactAVLTreePtr tree, const void *key);
+DeleteResult JCompactAVLTreeDeleteKey(JCompactAVLTreePtr tree, const void *key);
+FindResult JCompactAVLTreeFindKey(const JCompactAVLTreePtr tree, const void *key);
+
+void JCompactAVLTreeInorderTraverse(const JCompactAVLTreePtr tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef __JHASHINDEX_H__
+#define __JHASHINDEX_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 칸 배열을 두 배로 늘리기 시작하는 사용 비율(%)
+#define JHASH_INDEX_MAX_LOAD_PERCENT 75
+// 처음 칸 개수를 지정하지 않았을 때 사용하는 칸 개수
+#define JHASH_INDEX_DEFAULT_CAPACITY 16
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 해시 색인 칸 구조체
+typedef struct _jhash_slot_t {
+	// 키의 해시 값 (빠르게 거르는 용도, 최종 확인은 노드의 키로 한다)
+	unsigned long long hash;
+	// 키를 가진 노드 주소 (비어 있으면 NULL)
+	JNodePtr node;
+} JHashSlot, *JHashSlotPtr;
+
+// 키에서 노드를 바로 찾는 열린 주소(선형 탐사) 해시 색인 구조체
+// 삭제할 때 뒤따르는 칸을 앞으로 당겨서 삭제 표시 칸을 남기지 않는다.
+typedef struct _jhash_index_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 칸 배열
+	JHashSlotPtr slots;
+	// 칸 개수 - 1 (칸 개수는 2 의 거듭제곱)
+	unsigned int mask;
+	// 저장된 노드 개수
+	unsigned int count;
+	// 칸 배열 할당자 (함수가 NULL 이면 malloc, free)
+	JAVLTreeAllocator allocator;
+} JHashIndex, *JHashIndexPtr, **JHashIndexPtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JHashIndex
+///////////////////////////////////////////////////////////////////////////////
+
+JHashIndexPtr NewJHashIndex(KeyType type, unsigned int capacity);
+JHashIndexPtr NewJHashIndexEx(KeyType type, unsigned int capacity, const JAVLTreeAllocatorPtr allocator);
+DeleteResult DeleteJHashIndex(JHashIndexPtrContainer container);
+
+void JHashIndexClear(JHashIndexPtr index);
+JHashIndexPtr JHashIndexAdd(JHashIndexPtr index, JNodePtr node);
+DeleteResult JHashIndexRemove(JHashIndexPtr index, const JNodePtr node);
+JNodePtr JHashIndexFind(const JHashIndexPtr index, const void *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
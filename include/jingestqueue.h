@@ -0,0 +1,104 @@
+#ifndef __JINGESTQUEUE_H__
+#define __JINGESTQUEUE_H__
+
+#include <pthread.h>
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Enums
+///////////////////////////////////////////////////////////////////////////////
+
+// 큐에 넣는 작업 종류 열거형
+typedef enum JIngestOperation
+{
+	// 키 추가 (JAVLTreeAddNode)
+	IngestInsert = 1,
+	// 키 삭제 (JAVLTreeDeleteNodeKey)
+	IngestDelete,
+	// 키 검색 (JAVLTreeFindNode), 쓰기 스레드에서 검색하므로 앞서 넣은 작업이 모두 반영된 결과를 받는다
+	IngestFind
+} JIngestOperation;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 큐 크기를 지정하지 않았을 때 사용하는 칸 개수
+#define JINGEST_QUEUE_DEFAULT_CAPACITY 4096
+// 한 번에 꺼내서 반영할 작업 개수를 지정하지 않았을 때 사용하는 값
+#define JINGEST_QUEUE_DEFAULT_BATCH_SIZE 256
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 작업 완료 함수 (쓰기 스레드에서 호출, result 는 성공 또는 찾았으면 1, 아니면 0)
+// IngestFind 가 성공하면 key 는 트리에 저장된 키의 주소이다.
+typedef void (*JIngestCallback)(JIngestOperation operation, void *key, int result, void *userData);
+
+// 링 버퍼 칸 구조체
+typedef struct _jingest_slot_t {
+	// 칸 순서 번호 (비어 있으면 넣을 위치, 채워져 있으면 넣은 위치 + 1)
+	unsigned long long sequence;
+	// 작업 종류
+	JIngestOperation operation;
+	// 작업할 키 주소
+	void *key;
+	// 작업 완료 함수 (없으면 NULL)
+	JIngestCallback callback;
+	// 작업 완료 함수에 전달할 사용자 데이터
+	void *userData;
+} JIngestSlot, *JIngestSlotPtr;
+
+// 여러 스레드가 잠금 없이 작업을 넣고, 전용 쓰기 스레드 하나가 꺼내서 AVL Tree 에 반영하는 큐 구조체
+// 칸마다 순서 번호를 두는 고정 크기 링 버퍼이므로 넣는 쪽은 CAS 한 번으로 자리를 잡는다.
+typedef struct _jingest_queue_t {
+	// 작업을 반영할 AVL Tree (소유하지 않으며, 큐가 살아 있는 동안 쓰기 스레드만 사용해야 함)
+	JAVLTreePtr tree;
+	// 칸 배열
+	JIngestSlotPtr slots;
+	// 칸 개수 - 1 (칸 개수는 2 의 거듭제곱)
+	unsigned long long mask;
+	// 다음에 넣을 위치 (넣는 스레드들이 CAS 로 증가)
+	unsigned long long tail;
+	// 다음에 꺼낼 위치 (쓰기 스레드만 사용)
+	unsigned long long head;
+	// 쓰기 스레드가 한 번에 꺼내서 반영할 최대 작업 개수
+	int batchSize;
+	// 반영을 마친 작업 개수
+	unsigned long long appliedCount;
+	// 쓰기 스레드가 기다리고 있으면 1 (넣는 쪽은 이때만 잠금을 잡고 깨운다)
+	int isSleeping;
+	// 1 이면 남은 작업을 반영하고 쓰기 스레드를 끝냄
+	int isStopping;
+	// 대기 잠금
+	pthread_mutex_t waitLock;
+	// 쓰기 스레드를 깨우는 조건 변수
+	pthread_cond_t wakeCond;
+	// 반영을 기다리는 스레드를 깨우는 조건 변수
+	pthread_cond_t doneCond;
+	// 쓰기 스레드
+	pthread_t writer;
+} JIngestQueue, *JIngestQueuePtr, **JIngestQueuePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JIngestQueue
+///////////////////////////////////////////////////////////////////////////////
+
+JIngestQueuePtr NewJIngestQueue(JAVLTreePtr tree, unsigned int capacity, int batchSize);
+DeleteResult DeleteJIngestQueue(JIngestQueuePtrContainer container);
+
+JIngestQueuePtr JIngestQueueSubmit(JIngestQueuePtr queue, JIngestOperation operation, void *key, JIngestCallback callback, void *userData);
+void JIngestQueueSync(JIngestQueuePtr queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
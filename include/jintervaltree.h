@@ -0,0 +1,44 @@
+#ifndef __JINTERVALTREE_H__
+#define __JINTERVALTREE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 구간 트리에서 지정한 범위와 겹치는 구간을 시작 값 순서로 하나씩 찾는 반복자 구조체
+typedef struct _jinterval_iterator_t {
+	// 검색할 구간 트리
+	JAVLTreePtr tree;
+	// 검색 범위 하한
+	int low;
+	// 검색 범위 상한
+	int high;
+	// 마지막으로 찾은 노드 (아직 찾지 않았으면 NULL)
+	JNodePtr node;
+	// 더 이상 겹치는 구간이 없으면 1
+	int isDone;
+} JIntervalIterator, *JIntervalIteratorPtr;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Interval Tree
+///////////////////////////////////////////////////////////////////////////////
+
+JAVLTreePtr NewJIntervalTree();
+int JIntervalTreeGetMaxEnd(const JAVLTreePtr tree, const JNodePtr node);
+
+JIntervalIteratorPtr JIntervalTreeStab(const JAVLTreePtr tree, int point, JIntervalIteratorPtr iterator);
+JIntervalIteratorPtr JIntervalTreeFindOverlap(const JAVLTreePtr tree, int low, int high, JIntervalIteratorPtr iterator);
+JNodePtr JIntervalIteratorNext(JIntervalIteratorPtr iterator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
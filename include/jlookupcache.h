@@ -0,0 +1,66 @@
+#ifndef __JLOOKUPCACHE_H__
+#define __JLOOKUPCACHE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 집합 하나에 들어가는 항목 개수 (2-way)
+#define JLOOKUP_CACHE_WAY_COUNT 2
+// 항목 배열 정렬 크기 (캐시 라인 크기)
+#define JLOOKUP_CACHE_ALIGNMENT 64
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 검색 캐시 항목 구조체
+typedef struct _jlookup_entry_t {
+	// 키의 해시 값 (빠르게 거르는 용도, 최종 확인은 노드의 키로 한다)
+	unsigned long long hash;
+	// 키를 가진 노드 주소 (비어 있으면 NULL)
+	JNodePtr node;
+} JLookupEntry, *JLookupEntryPtr;
+
+// 자주 찾는 키의 노드를 기억하는 2-way 집합 연관 검색 캐시 구조체
+// JLookupCacheFind 는 여러 스레드가 함께 호출할 수 있지만, 항목을 바꾸는 Fill, Invalidate, Clear 는 한 스레드만 호출해야 한다.
+// JAVLTreeFindNode 는 캐시에 없으면 Fill 을 호출하므로 쓰는 쪽이며, 다른 검색이나 변경과 동시에 호출하면 안 된다.
+typedef struct _jlookup_cache_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 항목 배열 (JLOOKUP_CACHE_ALIGNMENT 바이트 정렬, 집합마다 JLOOKUP_CACHE_WAY_COUNT 개)
+	JLookupEntryPtr entries;
+	// 집합 개수 - 1 (집합 개수는 2 의 거듭제곱)
+	unsigned int setMask;
+	// 캐시에서 찾은 횟수
+	unsigned long long hitCount;
+	// 캐시에 없어서 트리를 내려간 횟수
+	unsigned long long missCount;
+} JLookupCache, *JLookupCachePtr, **JLookupCachePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JLookupCache
+///////////////////////////////////////////////////////////////////////////////
+
+JLookupCachePtr NewJLookupCache(KeyType type, unsigned int entryCount);
+DeleteResult DeleteJLookupCache(JLookupCachePtrContainer container);
+
+void JLookupCacheClear(JLookupCachePtr cache);
+JNodePtr JLookupCacheFind(JLookupCachePtr cache, const void *key);
+void JLookupCacheFill(JLookupCachePtr cache, JNodePtr node);
+void JLookupCacheInvalidate(JLookupCachePtr cache, const void *key);
+
+double JLookupCacheGetHitRatio(const JLookupCachePtr cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,105 @@
+#ifndef __JMAPPEDAVLTREE_H__
+#define __JMAPPEDAVLTREE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Enums
+///////////////////////////////////////////////////////////////////////////////
+
+// 파일을 여는 방식 열거형
+typedef enum JMappedMode
+{
+	// 읽기, 쓰기 (파일이 없으면 생성)
+	MappedReadWrite = 1,
+	// 읽기 전용 (여러 프로세스가 같은 매핑을 공유)
+	MappedReadOnly
+} JMappedMode;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 노드가 없음을 나타내는 오프셋 (0 번 오프셋은 파일 헤더)
+#define JMAPPED_NULL_OFFSET 0ULL
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 파일에 저장되는 노드 구조체, 자식 노드는 파일 시작부터의 바이트 오프셋으로 연결
+typedef struct _jmapped_node_t {
+	// 키 값 (포인터가 아닌 값을 직접 저장)
+	int key;
+	// 이 노드를 루트로 하는 하위 트리의 높이 (빈 슬롯이면 0)
+	int height;
+	// 왼쪽 자식 노드 오프셋 (빈 슬롯일 때는 다음 빈 슬롯 오프셋)
+	unsigned long long left;
+	// 오른쪽 자식 노드 오프셋
+	unsigned long long right;
+} JMappedNode, *JMappedNodePtr;
+
+// 파일 맨 앞에 저장되는 64 바이트 헤더 구조체
+typedef struct _jmapped_header_t {
+	// 파일 식별자 "JMAV"
+	char magic[4];
+	// 파일 형식 버전
+	unsigned int version;
+	// 키 데이터 유형
+	int type;
+	// 노드 구조체 크기 (형식이 다른 파일을 여는 것을 막기 위해 저장)
+	unsigned int nodeSize;
+	// 루트 노드 오프셋
+	unsigned long long root;
+	// 삭제된 노드 슬롯 목록의 첫 번째 오프셋
+	unsigned long long freeList;
+	// 한 번도 사용되지 않은 첫 번째 노드 슬롯 오프셋
+	unsigned long long end;
+	// 저장된 키 개수
+	unsigned long long size;
+	// 예약 공간
+	unsigned long long reserved[2];
+} JMappedHeader, *JMappedHeaderPtr;
+
+// 노드들이 mmap 된 파일에 있는 AVL Tree 구조체
+typedef struct _jmapped_avltree_t {
+	// 파일 디스크립터
+	int fd;
+	// 파일을 연 방식
+	JMappedMode mode;
+	// 키 데이터 유형 (IntType, CharType 만 가능)
+	KeyType type;
+	// 매핑된 파일의 시작 주소 (파일이 커지면 바뀔 수 있음)
+	unsigned char *base;
+	// 매핑된 크기 (파일 크기)
+	size_t mappedSize;
+	// 사용자 데이터
+	void *data;
+} JMappedAVLTree, *JMappedAVLTreePtr, **JMappedAVLTreePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JMappedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+JMappedAVLTreePtr NewJMappedAVLTree(const char *path, KeyType type, JMappedMode mode);
+DeleteResult DeleteJMappedAVLTree(JMappedAVLTreePtrContainer container);
+
+JMappedAVLTreePtr JMappedAVLTreeSync(JMappedAVLTreePtr tree);
+unsigned long long JMappedAVLTreeGetSize(const JMappedAVLTreePtr tree);
+
+JMappedAVLTreePtr JMappedAVLTreeAddKey(JMappedAVLTreePtr tree, const void *key);
+DeleteResult JMappedAVLTreeDeleteKey(JMappedAVLTreePtr tree, const void *key);
+FindResult JMappedAVLTreeFindKey(const JMappedAVLTreePtr tree, const void *key);
+
+void JMappedAVLTreeInorderTraverse(const JMappedAVLTreePtr tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
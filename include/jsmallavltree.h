@@ -0,0 +1,64 @@
+#ifndef __JSMALLAVLTREE_H__
+#define __JSMALLAVLTREE_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 노드 없이 구조체 안의 정렬된 배열에 저장하는 최대 키 개수, 넘으면 노드 기반 AVL Tree 로 바꿈
+#ifndef JSMALL_CAPACITY
+#define JSMALL_CAPACITY 16
+#endif
+// 노드 기반 AVL Tree 에서 키가 이 개수 이하로 줄면 다시 배열로 바꿈 (경계에서 바꾸기를 반복하지 않도록 절반으로 둠)
+#define JSMALL_DEMOTE_SIZE (JSMALL_CAPACITY / 2)
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 키가 적을 때는 정렬된 키 주소 배열로, 많아지면 노드 기반 AVL Tree 로 저장하는 구조체
+// 배열 모드에서는 구조체 하나만 할당하므로 작은 트리를 많이 만들 때 노드 할당과 트리 헤더 비용이 없다.
+typedef struct _jsmall_avltree_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 저장된 키 개수
+	unsigned int size;
+	// 노드 기반 AVL Tree (배열 모드이면 NULL)
+	JAVLTreePtr tree;
+	// 키 순서로 정렬된 키 주소 배열 (배열 모드에서만 사용)
+	void *keys[JSMALL_CAPACITY];
+	// 사용자 데이터
+	void *data;
+} JSmallAVLTree, *JSmallAVLTreePtr, **JSmallAVLTreePtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JSmallAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+JSmallAVLTreePtr NewJSmallAVLTree(KeyType type);
+DeleteResult DeleteJSmallAVLTree(JSmallAVLTreePtrContainer container);
+
+unsigned int JSmallAVLTreeGetSize(const JSmallAVLTreePtr tree);
+int JSmallAVLTreeIsPromoted(const JSmallAVLTreePtr tree);
+
+JSmallAVLTreePtr JSmallAVLTreeAddKey(JSmallAVLTreePtr tree, void *key);
+DeleteResult JSmallAVLTreeDeleteKey(JSmallAVLTreePtr tree, void *key);
+void* JSmallAVLTreeFindKey(const JSmallAVLTreePtr tree, void *key);
+
+void* JSmallAVLTreeGetMin(const JSmallAVLTreePtr tree);
+void* JSmallAVLTreeGetMax(const JSmallAVLTreePtr tree);
+void* JSmallAVLTreeLowerBound(const JSmallAVLTreePtr tree, void *key);
+
+void JSmallAVLTreeInorderTraverse(const JSmallAVLTreePtr tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef __JWAL_H__
+#define __JWAL_H__
+
+#include "javltree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// Enums
+///////////////////////////////////////////////////////////////////////////////
+
+// 로그 기록 종류 열거형
+typedef enum WALOperation
+{
+	// 노드 추가
+	WALAddNode = 1,
+	// 노드 삭제
+	WALDeleteNode
+} WALOperation;
+
+// 로그 처리 결과 열거형
+typedef enum WALResult
+{
+	// 실패 (이번 기록은 로그에 남지 않음)
+	WALFail = -1,
+	// 기록은 했지만 디스크에 남았는지 알 수 없음 (로그가 실패 상태가 되며, 복구 시 이 기록이 적용될 수 있음)
+	WALNotDurable = 0,
+	// 성공
+	WALSuccess = 1
+} WALResult;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macro
+///////////////////////////////////////////////////////////////////////////////
+
+// 디스크에 쓰기 전에 기록을 모아두는 버퍼의 기본 크기
+#define JWAL_BUFFER_SIZE 65536
+
+///////////////////////////////////////////////////////////////////////////////
+/// Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// 그룹 커밋 정책 구조체, 둘 중 하나라도 만족하면 fsync 한다.
+typedef struct _jwal_policy_t {
+	// 이 개수만큼 기록이 쌓이면 fsync (1 이면 기록마다 fsync)
+	int batchSize;
+	// 마지막 fsync 이후 이 시간(마이크로초)이 지나면 다음 기록에서 fsync (0 이면 사용하지 않음)
+	long long windowMicros;
+} JWALPolicy;
+
+// 추가 전용 변경 기록 로그(Write-Ahead Log) 구조체
+typedef struct _jwal_t {
+	// 로그 파일 디스크립터
+	int fd;
+	// 기록할 키 데이터 유형
+	KeyType type;
+	// 그룹 커밋 정책
+	JWALPolicy policy;
+	// 아직 파일에 쓰지 않은 기록 버퍼
+	unsigned char *buffer;
+	// 버퍼에 쌓인 바이트 수
+	size_t bufferLength;
+	// 버퍼 크기
+	size_t bufferCapacity;
+	// 아직 fsync 되지 않은 기록 개수
+	int pendingCount;
+	// 마지막 fsync 시각 (마이크로초, 단조 시계)
+	long long lastSyncMicros;
+	// 지금까지 추가된 기록 개수
+	unsigned long long recordCount;
+	// 지금까지 수행한 fsync 횟수
+	unsigned long long syncCount;
+	// 파일에 쓴 길이
+	long long fileLength;
+	// 마지막 fsync 까지 디스크에 남은 파일 길이 (쓰기 실패 시 여기까지 잘라낸다)
+	long long syncedLength;
+	// 쓰기 또는 fsync 에 실패했으면 1 (이후의 기록과 fsync 는 모두 거절)
+	int isFailed;
+} JWAL, *JWALPtr, **JWALPtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JWAL
+///////////////////////////////////////////////////////////////////////////////
+
+JWALPtr NewJWAL(const char *path, KeyType type, JWALPolicy policy);
+DeleteResult DeleteJWAL(JWALPtrContainer container);
+
+WALResult JWALAppend(JWALPtr wal, WALOperation operation, const void *key);
+WALResult JWALSync(JWALPtr wal);
+WALResult JWALCheckpoint(JWALPtr wal, const JAVLTreePtr tree, const char *snapshotPath);
+
+WALResult JWALSaveSnapshot(const JAVLTreePtr tree, const char *snapshotPath);
+JAVLTreePtr JWALRecover(KeyType type, const char *snapshotPath, const char *walPath);
+JAVLTreePtr JWALRecoverEx(KeyType type, const JAVLTreeOptionsPtr options, const char *snapshotPath, const char *walPath);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -1,8 +1,110 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
 
 #include "../include/javltree.h"
+#include "../include/jwal.h"
+#include "../include/jbloomfilter.h"
+#include "../include/jlookupcache.h"
+#include "../include/jhashindex.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 일괄 검색 시 동시에 내려가는 키 개수
+#define JAVLTREE_BATCH_GROUP_SIZE 16
+// 트리가 소유하는 키 저장 블록 하나의 최소 크기
+#define JAVLTREE_KEY_BLOCK_SIZE 4096
+// 노드 뒤에 붙는 집계 값의 시작 위치 (16 바이트 정렬)
+#define JAVLTREE_AGGREGATE_OFFSET ((sizeof(JNode) + 15) & ~(size_t)15)
+// 범위 집계 시 할당 없이 사용하는 임시 집계 값 하나의 최대 크기
+#define JAVLTREE_AGGREGATE_INLINE_SIZE 64
+// Red-Black 균형 정책에서 JNode.height 에 저장하는 노드 색 (없는 노드는 검은색)
+#define JAVLTREE_RB_BLACK 0
+#define JAVLTREE_RB_RED 1
+
+// 다음에 읽을 메모리를 미리 캐시로 가져오도록 요청
+#if defined(__GNUC__)
+#define JAVLTREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define JAVLTREE_PREFETCH(address)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Enums
+////////////////////////////////////////////////////////////////////////////////
+
+// 탐색 경계 조건 열거형
+typedef enum JNodeBound
+{
+	// 키보다 크거나 같은 노드 중 가장 작은 노드
+	BoundGreaterEqual = 1,
+	// 키보다 큰 노드 중 가장 작은 노드
+	BoundGreater,
+	// 키보다 작거나 같은 노드 중 가장 큰 노드
+	BoundLessEqual,
+	// 키보다 작은 노드 중 가장 큰 노드
+	BoundLess
+} JNodeBound;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 트리가 소유하는 키를 연속해서 저장하는 블록 구조체
+typedef struct _jkey_block_t {
+	// 다음 블록 주소
+	struct _jkey_block_t *next;
+	// 사용한 바이트 수
+	size_t used;
+	// 저장할 수 있는 바이트 수
+	size_t capacity;
+	// 키 저장 공간
+	unsigned char bytes[];
+} JKeyBlock, *JKeyBlockPtr;
+
+// 만료 시각 최소 힙 항목 구조체
+typedef struct _jexpiry_entry_t {
+	// 만료 시각
+	long long expireAt;
+	// 만료될 노드 주소
+	JNodePtr node;
+} JExpiryEntry, *JExpiryEntryPtr;
+
+// 만료 시각 순서로 노드를 꺼내는 최소 힙 구조체
+// 노드 뒤에 힙에서의 위치를 저장해서, 만료 전에 삭제되거나 만료 시각이 바뀐 노드를 O(log n) 에 찾아 고친다.
+typedef struct _jexpiry_heap_t {
+	// 항목 배열 (entries[0] 이 가장 먼저 만료)
+	JExpiryEntryPtr entries;
+	// 저장된 항목 개수
+	int count;
+	// 항목 배열 크기
+	int capacity;
+	// 검색 시 만료된 노드를 없는 것으로 볼 때 사용하는 현재 시각 함수 (NULL 이면 검사하지 않음)
+	JAVLTreeClockFunc clock;
+	// 현재 시각 함수에 전달할 사용자 데이터
+	void *clockData;
+} JExpiryHeap, *JExpiryHeapPtr;
+
+// JAVLTreeCompact 로 재배치한 노드를 연속해서 저장하는 블록 구조체
+// 블록 헤더와 노드 공간을 한 번에 할당하며, 블록 안의 노드가 모두 해제되면 블록도 해제한다.
+typedef struct _jnode_slab_t {
+	// 다음 블록 주소
+	struct _jnode_slab_t *next;
+	// 노드 공간 시작 주소 (16 바이트 정렬)
+	unsigned char *nodes;
+	// 노드 하나가 차지하는 바이트 수
+	size_t stride;
+	// 저장할 수 있는 노드 개수
+	int capacity;
+	// 채운 노드 개수
+	int used;
+	// 아직 해제되지 않은 노드 개수
+	int liveCount;
+} JNodeSlab, *JNodeSlabPtr;
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of JNode Static Functions
@@ -14,25 +116,89 @@ static JNodePtr JNodeRotateRR(const JNodePtr node);
 static JNodePtr JNodeRotateRL(const JNodePtr node);
 static int JNodeGetHeight(const JNodePtr node);
 static int JNodeGetHeightDiff(const JNodePtr node);
-static void JNodeDeleteChilds(JNodePtr node);
-static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type);
+static void JNodeUpdateHeight(JNodePtr node);
+static JNodePtr JNodeRebalance(JNodePtr node);
+static void JNodeDeleteChilds(JNodePtr node, const JAVLTreePtr tree);
+static JNodePtr JNodeFind(JNodePtr node, void *key, const JAVLTreePtr tree);
 static void JNodePreorderTraverse(const JNodePtr node, KeyType type);
 static void JNodeInorderTraverse(const JNodePtr node, KeyType type);
 static void JNodePostorderTraverse(const JNodePtr node, KeyType type);
 static void JNodePrintKey(const JNodePtr node, KeyType type);
+static JNodePtr JNodeFindBound(JNodePtr node, void *key, const JAVLTreePtr tree, JNodeBound bound);
+static JNodePtr JNodeFindBoundInt(JNodePtr node, int key, JNodeBound bound);
+static JNodePtr JNodeFindBoundChar(JNodePtr node, char key, JNodeBound bound);
+static JNodePtr JNodeFindBoundString(JNodePtr node, const char *key, JNodeBound bound);
+static JNodePtr JNodeFindBoundInterval(JNodePtr node, const JInterval *key, JNodeBound bound);
+static JNodePtr JNodeFindBoundCustom(JNodePtr node, const void *key, const JAVLTreePtr tree, JNodeBound bound);
+static void JNodeReleaseChilds(JNodePtr node, const JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData);
+static JNodePtr JNodeGetNextNode(const JNodePtr node);
+static JNodePtr JNodeGetPrevNode(const JNodePtr node);
+static JNodePtr JNodeBuildBalanced(JNodePtrContainer nodes, int count, JNodePtr parentNode);
+static void JNodeColorBalanced(JNodePtr node, int depth, int redDepth);
+static int JNodeIsRed(const JNodePtr node);
+static int JNodeGetDepth(const JNodePtr node);
+static int JNodeLayoutVEB(JNodePtr node, int height, JNodePtrContainer nodes, int count);
+static int JNodeLayoutVEBBottom(JNodePtr node, int depth, int topHeight, int bottomHeight, JNodePtrContainer nodes, int count);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of JAVLTree Static Function
 ////////////////////////////////////////////////////////////////////////////////
 
-static JAVLTreePtr JAVLTreeRebalance(JAVLTreePtr tree);
+static void JAVLTreeRebalance(JAVLTreePtr tree, JNodePtr node);
+static JNodePtr JAVLTreeRotate(JAVLTreePtr tree, JNodePtr node, int toLeft);
+static void JAVLTreeFixInsert(JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node, int removedHeight);
+static void JAVLTreeWAVLFixInsert(JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeWAVLFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node);
+static void JAVLTreeRedBlackFixInsert(JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeRedBlackFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node);
+static void JAVLTreeMarkUnbalanced(JAVLTreePtr tree, JNodePtr node);
+static int JAVLTreeFixUnbalanced(JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeReplaceChild(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr oldNode, JNodePtr newNode);
+static void JAVLTreeUnlinkNode(JAVLTreePtr tree, JNodePtr node);
+static JNodePtr JAVLTreeInsertFrom(JAVLTreePtr tree, JNodePtr startNode, void *key, int *isRevived, JNodePtr newNode);
+static JNodePtr JAVLTreeClimbFromHint(const JAVLTreePtr tree, JNodePtr hint, void *key);
+static int JAVLTreeFindGroup(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results);
+static int JAVLTreeLogOperation(JAVLTreePtr tree, WALOperation operation, const void *key);
+static JNodePtr JAVLTreeCommitInsert(JAVLTreePtr tree, JNodePtr node, void *key, int isRevived);
+static void JAVLTreeOnInsert(JAVLTreePtr tree, const JNodePtr node);
+static void JAVLTreeOnDelete(JAVLTreePtr tree, const JNodePtr node);
+static JNodePtr JAVLTreeCheckFound(const JAVLTreePtr tree, JNodePtr node);
+static JNodePtr JAVLTreeNewNode(const JAVLTreePtr tree);
+static size_t JAVLTreeGetNodeSize(const JAVLTreePtr tree);
+static JNodeSlabPtr JAVLTreeNewSlab(JAVLTreePtr tree, int capacity);
+static void JAVLTreeDeleteSlab(JAVLTreePtr tree, JNodeSlabPtr slab);
+static int JAVLTreeReleaseSlabNode(JAVLTreePtr tree, const void *pointer);
+static JNodePtr JAVLTreeMoveNode(JAVLTreePtr tree, JNodePtr node, JNodeSlabPtr slab);
+static void JAVLTreeEndCompact(JAVLTreePtr tree);
+static void* JAVLTreeGetNodeAggregate(const JAVLTreePtr tree, const JNodePtr node);
+static void JAVLTreeUpdateAggregate(const JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeUpdateAggregatePath(const JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeUpdateAggregateAll(const JAVLTreePtr tree, JNodePtr node);
+static void JAVLTreeLiftNode(const JAVLTreePtr tree, const JNodePtr node, void *aggregate);
+static int JAVLTreeCompareKey(const JAVLTreePtr tree, const void *key1, const void *key2);
+static DeleteResult JAVLTreeDeleteNode(JAVLTreePtr tree, JNodePtr node);
+static size_t JAVLTreeGetExpiryOffset(const JAVLTreePtr tree);
+static int* JAVLTreeGetNodeHeapIndex(const JAVLTreePtr tree, const JNodePtr node);
+static size_t JAVLTreeGetInlineKeyOffset(const JAVLTreePtr tree);
+static void* JAVLTreeOwnKey(JAVLTreePtr tree, JNodePtr node, const void *key);
+static int JAVLTreeIsInlineKey(const JAVLTreePtr tree, const JNodePtr node);
+static JNodePtr JAVLTreeCheckExpired(const JAVLTreePtr tree, JNodePtr node);
+static void JExpiryHeapMove(const JAVLTreePtr tree, int position, JExpiryEntry entry);
+static void JExpiryHeapSiftUp(const JAVLTreePtr tree, int position);
+static void JExpiryHeapSiftDown(const JAVLTreePtr tree, int position);
+static void JExpiryHeapRemove(const JAVLTreePtr tree, const JNodePtr node);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of Util Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
 static KeyType _CheckKeyType(KeyType type);
-static int _GetCompareLength(const char *s1, const char *s2);
+static int _CompareKey(const void *key1, const void *key2, KeyType type);
+static int _IsBoundCandidate(int compareResult, JNodeBound bound);
+static size_t _GetKeySize(const void *key, KeyType type);
+static void* _AllocMemory(const JAVLTreeAllocator *allocator, size_t size);
+static void _FreeMemory(const JAVLTreeAllocator *allocator, void *pointer);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JNode
@@ -54,7 +220,10 @@ JNodePtr NewJNode()
 
 	newNode->left = NULL;
 	newNode->right = NULL;
+	newNode->parent = NULL;
 	newNode->key = NULL;
+	newNode->height = 1;
+	newNode->flags = 0;
 
 	return newNode;
 }
@@ -99,6 +268,34 @@ void* JNodeSetKey(JNodePtr node, void *key)
 	return node->key;
 }
 
+/**
+ * @fn JNodePtr JNodeGetNext(const JNodePtr node)
+ * @brief 중위 순회 순서에서 지정한 노드의 다음 노드를 찾는 함수
+ * 지연 삭제 모드에서 삭제 표시된 노드는 건너뛴다.
+ * @param node 기준 노드의 주소(입력, 읽기 전용)
+ * @return 성공 시 다음 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JNodeGetNext(const JNodePtr node)
+{
+	JNodePtr nextNode = JNodeGetNextNode(node);
+	while(nextNode != NULL && (nextNode->flags & JNODE_FLAG_TOMBSTONE)) nextNode = JNodeGetNextNode(nextNode);
+	return nextNode;
+}
+
+/**
+ * @fn JNodePtr JNodeGetPrev(const JNodePtr node)
+ * @brief 중위 순회 순서에서 지정한 노드의 이전 노드를 찾는 함수
+ * 지연 삭제 모드에서 삭제 표시된 노드는 건너뛴다.
+ * @param node 기준 노드의 주소(입력, 읽기 전용)
+ * @return 성공 시 이전 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JNodeGetPrev(const JNodePtr node)
+{
+	JNodePtr prevNode = JNodeGetPrevNode(node);
+	while(prevNode != NULL && (prevNode->flags & JNODE_FLAG_TOMBSTONE)) prevNode = JNodeGetPrevNode(prevNode);
+	return prevNode;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JAVLTree
 ///////////////////////////////////////////////////////////////////////////////
@@ -110,18 +307,91 @@ void* JNodeSetKey(JNodePtr node, void *key)
  * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
  */
 JAVLTreePtr NewJAVLTree(KeyType type)
+{
+	return NewJAVLTreeEx(type, NULL);
+}
+
+/**
+ * @fn JAVLTreePtr NewJAVLTreeEx(KeyType type, const JAVLTreeOptionsPtr options)
+ * @brief 생성 옵션을 지정해서 새로운 AVL Tree 구조체 객체를 생성하는 함수
+ * LookupHash 를 지정하면 해시 색인을 함께 만들어서 점 검색(JAVLTreeFindNode, JAVLTreeFindBatch, JAVLTreeDeleteNodeKey)에 사용한다.
+ * CustomType 은 해시 값을 구할 수 없으므로 LookupHash 를 사용할 수 없다.
+ * 균형 정책은 트리를 만든 뒤에는 바꿀 수 없다.
+ * KeyOwnerTree 를 지정하면 추가할 때 키를 복사하므로 호출한 쪽은 키 메모리를 유지하지 않아도 된다.
+ * 크기를 알 수 없는 CustomType 은 KeyOwnerTree 를 사용할 수 없다.
+ * 할당자를 지정하면 트리 구조체를 포함한 모든 내부 메모리를 그 할당자로 할당, 해제한다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @param options 생성 옵션, NULL 이면 기본값(입력, 읽기 전용)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr NewJAVLTreeEx(KeyType type, const JAVLTreeOptionsPtr options)
 {
 	if(_CheckKeyType(type) == Unknown) return NULL;
 
-	JAVLTreePtr newTree = (JAVLTreePtr)malloc(sizeof(JAVLTree));
+	JAVLTreeLookup lookup = (options != NULL && options->lookup != 0) ? options->lookup : LookupTree;
+	if(lookup != LookupTree && lookup != LookupHash) return NULL;
+
+	JAVLTreeBalance balance = (options != NULL && options->balance != 0) ? options->balance : BalanceAVL;
+	if(balance != BalanceAVL && balance != BalanceWAVL && balance != BalanceRedBlack) return NULL;
+
+	JAVLTreeKeyOwner keyOwner = (options != NULL && options->keyOwner != 0) ? options->keyOwner : KeyOwnerCaller;
+	if(keyOwner != KeyOwnerCaller && keyOwner != KeyOwnerTree) return NULL;
+	if(keyOwner == KeyOwnerTree && type == CustomType) return NULL;
+
+	JAVLTreeAllocator allocator;
+	memset(&allocator, 0, sizeof(JAVLTreeAllocator));
+	if(options != NULL && options->allocator != NULL)
+	{
+		// 할당, 해제 함수는 함께 지정해야 한다.
+		if(options->allocator->alloc == NULL || options->allocator->free == NULL) return NULL;
+		allocator = *(options->allocator);
+	}
+
+	JAVLTreePtr newTree = (JAVLTreePtr)_AllocMemory(&allocator, sizeof(JAVLTree));
 	if(newTree == NULL)
 	{
 		return NULL;
 	}
 
+	newTree->allocator = allocator;
 	newTree->type = type;
+	newTree->balance = balance;
+	newTree->keyOwner = keyOwner;
 	newTree->root = NULL;
+	newTree->min = NULL;
+	newTree->max = NULL;
+	newTree->finger = NULL;
+	newTree->wal = NULL;
+	newTree->bloom = NULL;
+	newTree->cache = NULL;
+	newTree->keyBlocks = NULL;
+	newTree->nodeSlabs = NULL;
+	newTree->compactSlab = NULL;
+	newTree->compactCursor = NULL;
+	newTree->nodeCount = 0;
+	newTree->externalCount = 0;
+	newTree->rotationCount = 0;
+	newTree->relaxed = 0;
+	newTree->relaxStepBudget = 0;
+	newTree->relaxCursor = NULL;
+	newTree->tombstoneCount = 0;
+	newTree->tombstoneThreshold = 0;
+	memset(&(newTree->augment), 0, sizeof(JAVLTreeAugment));
+	newTree->compare = NULL;
+	newTree->compareData = NULL;
 	newTree->data = NULL;
+	newTree->index = NULL;
+	newTree->expiry = NULL;
+
+	if(lookup == LookupHash)
+	{
+		newTree->index = NewJHashIndexEx(type, options->hashCapacity, &allocator);
+		if(newTree->index == NULL)
+		{
+			_FreeMemory(&allocator, newTree);
+			return NULL;
+		}
+	}
 
 	return newTree;
 }
@@ -139,11 +409,32 @@ DeleteResult DeleteJAVLTree(JAVLTreePtrContainer container)
 	JNodePtr rootNode = (*container)->root;
 	if(rootNode != NULL)
 	{
-		JNodeDeleteChilds(rootNode);
-		free(rootNode);
+		JNodeDeleteChilds(rootNode, *container);
+		JAVLTreeFree(*container, rootNode);
 	}
 
-	free(*container);
+	// 검색 캐시는 트리가 소유하지 않지만, 해제된 노드 주소가 남지 않도록 비운다.
+	JLookupCacheClear((*container)->cache);
+	DeleteJHashIndex(&((*container)->index));
+	if((*container)->expiry != NULL)
+	{
+		JAVLTreeFree(*container, (*container)->expiry->entries);
+		JAVLTreeFree(*container, (*container)->expiry);
+	}
+
+	JKeyBlockPtr keyBlock = (*container)->keyBlocks;
+	while(keyBlock != NULL)
+	{
+		JKeyBlockPtr nextBlock = keyBlock->next;
+		JAVLTreeFree(*container, keyBlock);
+		keyBlock = nextBlock;
+	}
+
+	// JAVLTreeClear 의 release 로 넘긴 노드가 남아 있던 블록도 여기서 해제한다.
+	while((*container)->nodeSlabs != NULL) JAVLTreeDeleteSlab(*container, (*container)->nodeSlabs);
+
+	JAVLTreeAllocator allocator = (*container)->allocator;
+	_FreeMemory(&allocator, *container);
 	*container = NULL;
 
 	return DeleteSuccess;
@@ -176,453 +467,3122 @@ void* JAVLTreeSetData(JAVLTreePtr tree, void *data)
 }
 
 /**
- * @fn JAVLTreePtr JAVLTreeAddNode(JAVLTreePtr tree, void *key)
- * @brief AVL Tree에 새로운 노드를 추가하는 함수
- * 중복 허용하지 않음
- * @param tree AVL Tree 구조체 객체의 주소(출력)
- * @param key 저장할 노드의 키 주소(입력)
- * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ * @fn void* JAVLTreeAlloc(const JAVLTreePtr tree, size_t size)
+ * @brief AVL Tree 의 할당자로 메모리를 할당하는 함수
+ * 트리와 함께 쓰는 구조(로그 스냅샷 버퍼 등)가 트리와 같은 메모리를 사용하도록 할 때 사용한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param size 할당할 바이트 수(입력)
+ * @return 성공 시 할당된 메모리의 주소, 실패 시 NULL 반환
  */
-JAVLTreePtr JAVLTreeAddNode(JAVLTreePtr tree, void *key)
+void* JAVLTreeAlloc(const JAVLTreePtr tree, size_t size)
 {
-	if((tree == NULL || key == NULL)) return NULL;
-
-	JNodePtr parentNode = NULL;
-	JNodePtr currentNode = tree->root;
-
-	while(currentNode != NULL)
-	{
-		if(key == currentNode->key) return NULL;
-
-		parentNode = currentNode;
-		currentNode = JNodeMove(currentNode, key, tree->type);
-	}
-
-	JNodePtr newNode = NewJNode();
-	if(JNodeSetKey(newNode, key) == NULL) return NULL;
+	if(tree == NULL || size == 0) return NULL;
+	return _AllocMemory(&(tree->allocator), size);
+}
 
-	if(parentNode != NULL)
-	{
-		switch(tree->type)
-		{
-			case IntType:
-				if(*((int*)(parentNode->key)) > *((int*)(key))) parentNode->left = newNode;
-				else parentNode->right = newNode;
-				break;
-			case CharType:
-				if(*((char*)(parentNode->key)) > *((char*)(key))) parentNode->left = newNode;
-				else parentNode->right = newNode;
-				break;
-			case StringType:
-				if(strncmp((char*)(parentNode->key), (char*)(key), _GetCompareLength((char*)(parentNode->key), (char*)(key))) < 0) parentNode->left = newNode;
-				else parentNode->right = newNode;
-				break;
-			default:
-				DeleteJNode(&newNode);
-				return NULL;
-		}
-	}
-	else tree->root = newNode;
+/**
+ * @fn void JAVLTreeFree(const JAVLTreePtr tree, void *pointer)
+ * @brief AVL Tree 의 할당자로 할당한 메모리를 해제하는 함수
+ * JAVLTreeExtractNode 로 떼어낸 노드도 이 함수로 해제해야 한다.
+ * JAVLTreeCompact 로 재배치한 노드는 블록의 남은 노드 수만 줄이고, 마지막 노드가 해제될 때 블록을 해제한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param pointer 해제할 메모리의 주소, NULL 이면 무시(입력)
+ * @return 반환값 없음
+ */
+void JAVLTreeFree(const JAVLTreePtr tree, void *pointer)
+{
+	if(tree == NULL || pointer == NULL) return;
+	if(tree->nodeSlabs != NULL && JAVLTreeReleaseSlabNode(tree, pointer) == 1) return;
+	_FreeMemory(&(tree->allocator), pointer);
+}
 
-	if(JAVLTreeRebalance(tree) == NULL)
-	{
-		if(parentNode != NULL)
-		{
-			if(parentNode->left == newNode) parentNode->left = NULL;
-			else parentNode->right = NULL;
-		}
-		else tree->root = NULL;
-		DeleteJNode(&newNode);
-		return NULL;
-	}
+/**
+ * @fn JAVLTreePtr JAVLTreeSetLazyDelete(JAVLTreePtr tree, int thresholdPercent)
+ * @brief 지연 삭제 모드를 켜거나 끄는 함수
+ * 지연 삭제 모드에서는 삭제 시 노드에 삭제 표시만 하고, 검색과 순회에서 그 노드를 건너뛴다.
+ * 삭제 표시된 노드 비율이 임계값 이상이 되면 한 번에 트리를 다시 만든다.
+ * 삭제 표시된 노드는 키를 비교하는 데 계속 쓰이므로, 삭제된 키의 메모리는
+ * 정리될 때까지(JAVLTreeGetTombstoneCount 가 0 이 될 때까지) 유지해야 한다.
+ * 정리할 때 노드를 트리의 할당자로 해제하므로, JAVLTreeInsertNode 로 연결한 노드가 남아 있으면 켤 수 없다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param thresholdPercent 정리를 시작할 삭제 표시 노드 비율(1 ~ 100), 0 이면 끄고 바로 정리(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeSetLazyDelete(JAVLTreePtr tree, int thresholdPercent)
+{
+	if(tree == NULL || thresholdPercent < 0 || thresholdPercent > 100) return NULL;
+	if(thresholdPercent > 0 && tree->externalCount > 0) return NULL;
 
+	tree->tombstoneThreshold = thresholdPercent;
+	if(thresholdPercent == 0) return JAVLTreePurgeTombstones(tree);
 	return tree;
 }
 
 /**
- * @fn DeleteResult JAVLTreeDeleteNodeKey(JAVLTreePtr tree, void *key)
- * @brief AVL Tree에 지정한 키를 가진 노드를 삭제하는 함수
- * @param tree AVL Tree 구조체 객체의 주소(츨력)
- * @param key 삭제할 키의 주소(입력)
- * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ * @fn JAVLTreePtr JAVLTreePurgeTombstones(JAVLTreePtr tree)
+ * @brief 삭제 표시된 노드들을 해제하고 남은 노드들로 트리를 다시 만드는 함수
+ * 중위 순회로 남은 노드를 모은 다음 가운데 노드부터 연결하므로 O(n) 이고,
+ * 결과는 높이 균형이 완전한 트리가 된다. 남은 노드의 주소는 바뀌지 않는다.
+ * 바쁘지 않은 시점에 직접 호출해서 삭제 시 정리 비용이 생기지 않도록 할 수도 있다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
  */
-DeleteResult JAVLTreeDeleteNodeKey(JAVLTreePtr tree, void *key)
+JAVLTreePtr JAVLTreePurgeTombstones(JAVLTreePtr tree)
 {
-	if(tree == NULL || key == NULL) return DeleteFail;
-
-	DeleteResult result = DeleteSuccess;
-
-	JNodePtr dummyNode = NewJNode();
-	if(dummyNode == NULL) return DeleteFail;
-	dummyNode->right = tree->root;
-
-	JNodePtr parentNode = dummyNode;
-	JNodePtr currentNode = tree->root;
-	JNodePtr selectedNode = NULL;
+	if(tree == NULL) return NULL;
+	if(tree->tombstoneCount == 0) return tree;
 
-	while((currentNode != NULL) && (key != currentNode->key))
-	{
-		parentNode = currentNode;
-		currentNode = JNodeMove(currentNode, key, tree->type);
-	}
+	// 트리 모양이 새로 만들어지므로 진행 중인 재배치는 여기서 끝낸다.
+	JAVLTreeEndCompact(tree);
 
-	if(currentNode == NULL)
-	{
-		DeleteJNode(&dummyNode);
-		return DeleteFail;
-	}
-	selectedNode = currentNode;
+	// 남은 노드는 앞에서부터, 삭제 표시된 노드는 뒤에서부터 채운다.
+	JNodePtr *nodes = (JNodePtr*)JAVLTreeAlloc(tree, sizeof(JNodePtr) * (size_t)tree->nodeCount);
+	if(nodes == NULL) return NULL;
 
-	// 자식 노드가 없는 경우(최하위 노드)
-	if((selectedNode->left == NULL) && (selectedNode->right == NULL))
+	int liveCount = 0;
+	int tombstoneIndex = tree->nodeCount;
+	JNodePtr node = tree->min;
+	for(; node != NULL; node = JNodeGetNextNode(node))
 	{
-		if(parentNode->left == currentNode) parentNode->left = NULL;
-		else parentNode->right = NULL;
+		node->flags &= ~JNODE_FLAG_UNBALANCED;
+		if(node->flags & JNODE_FLAG_TOMBSTONE) nodes[--tombstoneIndex] = node;
+		else nodes[liveCount++] = node;
 	}
-	// 자식 노드가 하나밖에 없는 경우
-	else if((selectedNode->left == NULL) || (selectedNode->right == NULL))
-	{
-		// child node of selected node
-		JNodePtr scNode = NULL;
 
-		if(selectedNode->left != NULL) scNode = selectedNode->left;
-		else scNode = selectedNode->right;
+	for(; tombstoneIndex < tree->nodeCount; tombstoneIndex++) JAVLTreeFree(tree, nodes[tombstoneIndex]);
 
-		if(parentNode->left == selectedNode) parentNode->left = scNode;
-		else parentNode->right = scNode;
-	}
-	// 자식 노드가 두 개 다 있는 경우
-	else if((selectedNode->left != NULL) && (selectedNode->right != NULL))
+	tree->root = JNodeBuildBalanced(nodes, liveCount, NULL);
+	if(tree->balance == BalanceRedBlack)
 	{
-		// child node of selected node
-		JNodePtr scNode = selectedNode->right;
-		// parent node of child node of selected node
-		JNodePtr spNode = selectedNode;
-
-		while(scNode->left != NULL)
-		{
-			spNode = scNode;
-			scNode = scNode->left;
-		}
-
-		void *tempKey = scNode->key;
-
-		if(spNode->left == scNode) spNode->left = scNode->right;
-		else spNode->right = scNode->right;
-
-		JNodeSetKey(selectedNode, tempKey);
-		selectedNode = scNode;
+		// 가득 찬 레벨 아래에 남는 노드만 빨간색으로 칠하면 모든 경로의 검은 노드 수가 같다.
+		int redDepth = 0;
+		while(((long long)2 << redDepth) - 1 <= liveCount) redDepth++;
+		JNodeColorBalanced(tree->root, 0, redDepth);
 	}
-
-	// 루트 노드 삭제 시 변경된 다른 노드로 바꾼다.
-	if(dummyNode->right != tree->root) tree->root = dummyNode->right;
-
-	DeleteJNode(&selectedNode);
-	DeleteJNode(&dummyNode);
-
-	if(JAVLTreeRebalance(tree) == NULL) result = DeleteFail;
-	return result;
+	JAVLTreeUpdateAggregateAll(tree, tree->root);
+	tree->min = (liveCount > 0) ? nodes[0] : NULL;
+	tree->max = (liveCount > 0) ? nodes[liveCount - 1] : NULL;
+	tree->finger = NULL;
+	tree->relaxCursor = NULL;
+	tree->nodeCount = liveCount;
+	tree->tombstoneCount = 0;
+
+	JAVLTreeFree(tree, nodes);
+	return tree;
 }
 
 /**
- * @fn void JAVLTreePreorderTraverse(const JAVLTreePtr tree)
- * @brief AVL Tree 를 전위 순회하며 노드의 키를 출력하는 함수
- * @param tree 순회할 AVL Tree (입력, 읽기 전용)
- * @return 반환값 없음
+ * @fn int JAVLTreeGetSize(const JAVLTreePtr tree)
+ * @brief AVL Tree 에 저장된 키 개수를 반환하는 함수 (삭제 표시된 노드 제외)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
  */
-void JAVLTreePreorderTraverse(const JAVLTreePtr tree)
+int JAVLTreeGetSize(const JAVLTreePtr tree)
 {
-	if(tree == NULL) return;
-	JNodePreorderTraverse(tree->root, tree->type);
-	printf("\n");
+	if(tree == NULL) return 0;
+	return tree->nodeCount - tree->tombstoneCount;
 }
 
 /**
- * @fn void JAVLTreeInorderTraverse(const JAVLTreePtr tree)
- * @brief AVL Tree 를 중위 순회하며 노드의 키를 출력하는 함수
- * @param tree 순회할 AVL Tree (입력, 읽기 전용)
- * @return 반환값 없음
+ * @fn int JAVLTreeGetTombstoneCount(const JAVLTreePtr tree)
+ * @brief AVL Tree 에서 삭제 표시만 되고 아직 정리되지 않은 노드 개수를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 삭제 표시된 노드 개수, 실패 시 0 반환
  */
-void JAVLTreeInorderTraverse(const JAVLTreePtr tree)
+int JAVLTreeGetTombstoneCount(const JAVLTreePtr tree)
 {
-	if(tree == NULL) return;
-	JNodeInorderTraverse(tree->root, tree->type);
-	printf("\n");
+	if(tree == NULL) return 0;
+	return tree->tombstoneCount;
 }
 
 /**
- * @fn void JAVLTreePostorderTraverse(const JAVLTreePtr tree)
- * @brief AVL Tree 를 후위 순회하며 노드의 키를 출력하는 함수
- * @param tree 순회할 AVL Tree (입력, 읽기 전용)
- * @return 반환값 없음
+ * @fn unsigned long long JAVLTreeGetRotationCount(const JAVLTreePtr tree)
+ * @brief AVL Tree 가 지금까지 균형을 맞추기 위해 회전한 횟수를 반환하는 함수 (이중 회전은 2 번)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 회전 횟수, 실패 시 0 반환
  */
-void JAVLTreePostorderTraverse(const JAVLTreePtr tree)
+unsigned long long JAVLTreeGetRotationCount(const JAVLTreePtr tree)
 {
-	if(tree == NULL) return;
-	JNodePostorderTraverse(tree->root, tree->type);
-	printf("\n");
+	if(tree == NULL) return 0;
+	return tree->rotationCount;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// JNode Static Functions
-////////////////////////////////////////////////////////////////////////////////
-
 /**
- * @fn static JNodePtr JNodeRotateLL(JNodePtr node)
- * @brief 지정한 노드를 기준으로 하위 노드들에 대해 LL 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ * @fn JAVLTreePtr JAVLTreeSetRelaxed(JAVLTreePtr tree, int isRelaxed, int stepBudget)
+ * @brief 완화 균형 모드를 켜거나 끄는 함수 (BalanceAVL 만 가능)
+ * 완화 균형 모드에서는 추가, 삭제 시 회전하지 않고 높이만 갱신하며, 균형이 깨진 하위 트리를
+ * 루트까지의 경로에 JNODE_FLAG_UNBALANCED 로 표시해 둔다. 표시된 작업은 추가, 삭제할 때마다
+ * stepBudget 만큼, 또는 JAVLTreeRebalanceStep 을 호출할 때 조금씩 처리하며, 모두 처리하면 다시 AVL 조건을 만족한다.
+ * 처리하기 전까지는 트리가 높아질 수 있으므로, 쓰기가 몰리는 동안만 켜 두는 것이 좋다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param isRelaxed 1 이면 켜고, 0 이면 남은 작업을 모두 처리하고 끔(입력)
+ * @param stepBudget 추가, 삭제할 때마다 수행할 작업량(JAVLTreeRebalanceStep 참고), 0 이면 자동으로 수행하지 않음(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
  */
-static JNodePtr JNodeRotateLL(const JNodePtr node)
+JAVLTreePtr JAVLTreeSetRelaxed(JAVLTreePtr tree, int isRelaxed, int stepBudget)
 {
-	if(node == NULL) return NULL;
-
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->left;
+	if(tree == NULL || tree->balance != BalanceAVL || stepBudget < 0) return NULL;
+	if(isRelaxed != 0 && isRelaxed != 1) return NULL;
 
-	parentNode->left = currentNode->right;
-	currentNode->right = parentNode;
+	if(isRelaxed == 0)
+	{
+		while(JAVLTreeRebalanceStep(tree, INT_MAX) == 1);
+	}
 
-	return currentNode;
+	tree->relaxed = isRelaxed;
+	tree->relaxStepBudget = stepBudget;
+	return tree;
 }
 
 /**
- * @fn static JNodePtr JNodeRotateLR(const JNodePtr node)
- * @brief 지정한 노드를 기준으로 하위 노드들에 대해 LR 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ * @fn int JAVLTreeRebalanceStep(JAVLTreePtr tree, int budget)
+ * @brief 완화 균형 모드에서 미뤄 둔 균형 작업을 정해진 양만큼 처리하는 함수
+ * 표시된 노드 중 가장 아래에 있는 노드부터 처리하므로, 처리하는 노드의 두 하위 트리는 이미 AVL 조건을 만족한다.
+ * 표시된 노드의 상위 노드는 모두 표시되어 있으므로, 다음 작업은 마지막으로 처리한 노드의 부모부터 찾는다.
+ * 높이 차이가 큰 노드는 낮은 쪽 하위 트리와 함께 높은 쪽 하위 트리의 가장자리에 다시 붙이고 경로를 따라 회전한다.
+ * 작업량은 방문한 노드 수와 회전 수의 합이며, 노드 하나의 처리는 나누지 않으므로 budget 을 조금 넘을 수 있다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param budget 처리할 최대 작업량(입력)
+ * @return 남은 작업이 있으면 1, 모두 처리했으면 0 반환
  */
-static JNodePtr JNodeRotateLR(const JNodePtr node)
+int JAVLTreeRebalanceStep(JAVLTreePtr tree, int budget)
 {
-	if(node == NULL) return NULL;
+	if(tree == NULL) return 0;
 
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->left;
+	while(budget > 0 && tree->root != NULL && (tree->root->flags & JNODE_FLAG_UNBALANCED))
+	{
+		JNodePtr node = tree->root;
+		if(tree->relaxCursor != NULL && (tree->relaxCursor->flags & JNODE_FLAG_UNBALANCED)) node = tree->relaxCursor;
+		while(1)
+		{
+			budget--;
+			if(node->left != NULL && (node->left->flags & JNODE_FLAG_UNBALANCED)) node = node->left;
+			else if(node->right != NULL && (node->right->flags & JNODE_FLAG_UNBALANCED)) node = node->right;
+			else break;
+		}
 
-	parentNode->left = JNodeRotateRR(currentNode);
-	return JNodeRotateLL(parentNode);
+		tree->relaxCursor = node->parent;
+		budget -= JAVLTreeFixUnbalanced(tree, node);
+	}
+
+	return (tree->root != NULL && (tree->root->flags & JNODE_FLAG_UNBALANCED)) ? 1 : 0;
 }
 
 /**
- * @fn static JNodePtr JNodeRotateRR(const JNodePtr node)
- * @brief 지정한 노드를 기준으로 하위 노드들에 대해 RR 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ * @fn JAVLTreePtr JAVLTreeCompact(JAVLTreePtr tree, JAVLTreeLayout layout)
+ * @brief AVL Tree 의 모든 노드를 연속된 블록 하나로 옮겨 지정한 순서로 배치하는 함수
+ * 추가, 삭제가 반복되어 흩어진 노드를 모아서 순회와 검색이 읽는 캐시 라인, 페이지 수를 줄인다.
+ * 트리 모양과 키는 그대로이며, 이후에도 추가, 삭제할 수 있다. (새 노드는 블록 밖에 할당)
+ * 노드 주소와 노드 안에 저장된 키의 주소가 바뀌므로, 이전에 얻은 JNodePtr 는 더 이상 사용할 수 없다.
+ * JNODE_FLAG_EXTERNAL 노드는 옮기지 않으며, 옮긴 노드를 JAVLTreeClear 의 release 로 받으면 JAVLTreeFree 로 해제해야 한다.
+ * 진행 중인 JAVLTreeCompactStep 재배치가 있으면 끝내고 처음부터 다시 배치한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param layout 배치 순서(입력, JAVLTreeLayout 열거형 참고)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환 (실패하면 트리는 바뀌지 않음)
  */
-static JNodePtr JNodeRotateRR(const JNodePtr node)
+JAVLTreePtr JAVLTreeCompact(JAVLTreePtr tree, JAVLTreeLayout layout)
 {
-	if(node == NULL) return NULL;
+	if(tree == NULL) return NULL;
+	if(layout != LayoutInOrder && layout != LayoutVanEmdeBoas) return NULL;
 
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->right;
+	JAVLTreeEndCompact(tree);
+	if(tree->nodeCount == 0) return tree;
 
-	parentNode->right = currentNode->left;
-	currentNode->left = parentNode;
+	JNodePtr *nodes = (JNodePtr*)JAVLTreeAlloc(tree, sizeof(JNodePtr) * (size_t)tree->nodeCount);
+	if(nodes == NULL) return NULL;
 
-	return currentNode;
-}
+	int count = 0;
+	if(layout == LayoutInOrder)
+	{
+		JNodePtr node = tree->min;
+		for(; node != NULL; node = JNodeGetNextNode(node))
+		{
+			if((node->flags & JNODE_FLAG_EXTERNAL) == 0) nodes[count++] = node;
+		}
+	}
+	else count = JNodeLayoutVEB(tree->root, JNodeGetDepth(tree->root), nodes, 0);
 
-/**
- * @fn static JNodePtr JNodeRotateRL(const JNodePtr node)
- * @brief 지정한 노드를 기준으로 하위 노드들에 대해 RL 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
- */
-static JNodePtr JNodeRotateRL(const JNodePtr node)
-{
-	if(node == NULL) return NULL;
+	JNodeSlabPtr slab = (count > 0) ? JAVLTreeNewSlab(tree, count) : NULL;
+	if(count > 0 && slab == NULL)
+	{
+		JAVLTreeFree(tree, nodes);
+		return NULL;
+	}
 
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->right;
+	// 아직 옮기지 않은 노드의 주소는 바뀌지 않으므로 배열 순서대로 옮기면 된다.
+	int index = 0;
+	for(; index < count; index++) JAVLTreeMoveNode(tree, nodes[index], slab);
 
-	parentNode->right = JNodeRotateLL(currentNode);
-	return JNodeRotateRR(parentNode);
+	JAVLTreeFree(tree, nodes);
+	return tree;
 }
 
 /**
- * @fn static int JNodeGetHeight(const JNodePtr node)
- * @brief AVL Tree 에서 지정한 노드의 높이를 구하는 함수(재귀)
- * 루트 노드는 1, 이하 자식 노드 레벨(높이)부터 1 씩 증가
- * @param node 높이를 구하기 위한 노드(입력, 읽기 전용) 
- * @return 성공 시 0 이상의 높이, 실패 시 0 반환
+ * @fn int JAVLTreeCompactStep(JAVLTreePtr tree, int budget)
+ * @brief AVL Tree 의 노드를 키 순서로 연속된 블록에 옮기는 작업을 정해진 노드 수만큼 처리하는 함수
+ * 처음 호출하면 현재 노드 수만큼의 블록을 할당하고 최소 노드부터 옮기며, 이후 호출은 다음 키의 노드부터 이어서 옮긴다.
+ * 호출 사이에 추가, 삭제해도 되며, 그 사이 추가된 노드가 블록을 넘으면 블록이 가득 찬 곳에서 끝낸다.
+ * 옮긴 노드의 주소가 바뀌는 점은 JAVLTreeCompact 와 같다. van Emde Boas 순서는 트리 전체 모양이 필요하므로 JAVLTreeCompact 로만 배치한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param budget 이번 호출에서 옮길 최대 노드 수(입력)
+ * @return 남은 작업이 있으면 1, 모두 처리했거나 실패했으면 0 반환
  */
-static int JNodeGetHeight(const JNodePtr node)
+int JAVLTreeCompactStep(JAVLTreePtr tree, int budget)
 {
-	if(node == NULL) return 0;
+	if(tree == NULL || budget <= 0) return 0;
 
-	int leftHeight = JNodeGetHeight(node->left);
-	int rightHeight = JNodeGetHeight(node->right);
+	if(tree->compactSlab == NULL)
+	{
+		if(tree->nodeCount == 0) return 0;
+		tree->compactSlab = JAVLTreeNewSlab(tree, tree->nodeCount);
+		if(tree->compactSlab == NULL) return 0;
+		tree->compactCursor = tree->min;
+	}
+
+	JNodeSlabPtr slab = tree->compactSlab;
+	while(budget > 0 && tree->compactCursor != NULL && slab->used < slab->capacity)
+	{
+		JNodePtr node = tree->compactCursor;
+		const unsigned char *address = (const unsigned char*)node;
+		int isMoved = (address >= slab->nodes && address < slab->nodes + slab->stride * (size_t)slab->capacity);
+		if(isMoved == 0 && (node->flags & JNODE_FLAG_EXTERNAL) == 0)
+		{
+			node = JAVLTreeMoveNode(tree, node, slab);
+			budget--;
+		}
+		tree->compactCursor = JNodeGetNextNode(node);
+	}
 
-	if(leftHeight > rightHeight) return leftHeight + 1;
-	else return rightHeight + 1;
+	if(tree->compactCursor != NULL && slab->used < slab->capacity) return 1;
+	JAVLTreeEndCompact(tree);
+	return 0;
 }
 
 /**
- * @fn static int JNodeGetHeightDiff(const JNodePtr node)
- * @brief AVL Tree 에서 지정한 노드의 자식노드들의 높이 차이를 구하는 함수(재귀)
- * @param node 높이의 차이를 구하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 자식 노드들의 높이 차이, 실패 시 0 반환
+ * @fn JAVLTreePtr JAVLTreeAttachWAL(JAVLTreePtr tree, struct _jwal_t *wal)
+ * @brief AVL Tree 에 변경 기록 로그를 연결하는 함수
+ * 연결된 뒤에는 노드 추가, 삭제가 성공할 때마다 로그에 기록이 추가된다.
+ * 로그 기록에 실패하면 변경을 되돌리고 실패를 반환한다.
+ * 로그는 트리가 소유하지 않으므로 트리보다 나중에 삭제해야 한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param wal 연결할 로그의 주소, NULL 이면 연결 해제(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
  */
-static int JNodeGetHeightDiff(const JNodePtr node)
+JAVLTreePtr JAVLTreeAttachWAL(JAVLTreePtr tree, struct _jwal_t *wal)
 {
-	if(node == NULL) return 0;
-	return JNodeGetHeight(node->left) - JNodeGetHeight(node->right);
+	if(tree == NULL) return NULL;
+	if(wal != NULL && wal->type != tree->type) return NULL;
+	tree->wal = wal;
+	return tree;
 }
 
 /**
- * @fn static void JNodeDeleteChilds(JNodePtr node)
- * @brief AVL Tree 에 저장된 노드들을 모두 삭제하는 함수(재귀)
- * @param node 자식 노드들을 삭제하기 위한 기준 노드(입력)
- * @return 반환값 없음
+ * @fn void* JAVLTreeStoreKey(JAVLTreePtr tree, const void *key)
+ * @brief 키를 복사해서 AVL Tree 가 소유하는 저장 공간에 저장하는 함수
+ * 저장된 키는 노드가 삭제되어도 남아 있다가 트리를 삭제할 때 한꺼번에 해제된다.
+ * 로그 복구처럼 키의 원래 주소가 없을 때 사용하며, KeyOwnerTree 트리는 노드 안에 들어가지 않는 키를 여기에 저장한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 복사할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 복사된 키의 주소, 실패 시 NULL 반환
  */
-static void JNodeDeleteChilds(JNodePtr node)
+void* JAVLTreeStoreKey(JAVLTreePtr tree, const void *key)
 {
-	if(node == NULL) return;
-	
-	if(node->left != NULL)
-	{
-		JNodeDeleteChilds(node->left);
-		free(node->left);
-		node->left = NULL;
-	}
+	if(tree == NULL || key == NULL) return NULL;
+
+	size_t keySize = _GetKeySize(key, tree->type);
+	if(keySize == 0) return NULL;
+	// 다음 키도 정렬된 주소에서 시작하도록 포인터 크기의 배수로 올린다.
+	size_t alignedSize = (keySize + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+	JKeyBlockPtr keyBlock = tree->keyBlocks;
+	if(keyBlock == NULL || keyBlock->capacity - keyBlock->used < alignedSize)
+	{
+		size_t capacity = JAVLTREE_KEY_BLOCK_SIZE;
+		if(capacity < alignedSize) capacity = alignedSize;
+
+		keyBlock = (JKeyBlockPtr)JAVLTreeAlloc(tree, sizeof(JKeyBlock) + capacity);
+		if(keyBlock == NULL) return NULL;
+
+		keyBlock->used = 0;
+		keyBlock->capacity = capacity;
+		keyBlock->next = tree->keyBlocks;
+		tree->keyBlocks = keyBlock;
+	}
+
+	void *storedKey = keyBlock->bytes + keyBlock->used;
+	memcpy(storedKey, key, keySize);
+	keyBlock->used += alignedSize;
+	return storedKey;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeAttachBloomFilter(JAVLTreePtr tree, struct _jbloom_t *filter)
+ * @brief AVL Tree 에 Bloom Filter 를 연결하는 함수
+ * 연결할 때 Bloom Filter 를 비우고 트리에 있는 키를 모두 추가한다.
+ * 연결된 뒤에는 검색 전에 Bloom Filter 를 먼저 확인해서, 없는 키는 트리를 내려가지 않고 실패한다.
+ * Bloom Filter 는 트리가 소유하지 않으므로 트리보다 나중에 삭제해야 한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param filter 연결할 Bloom Filter 의 주소, NULL 이면 연결 해제(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeAttachBloomFilter(JAVLTreePtr tree, struct _jbloom_t *filter)
+{
+	if(tree == NULL) return NULL;
+	if(filter != NULL && filter->type != tree->type) return NULL;
+
+	tree->bloom = filter;
+	if(filter == NULL) return tree;
+
+	JBloomFilterClear(filter);
+	JNodePtr node = JAVLTreeGetMin(tree);
+	for(; node != NULL; node = JNodeGetNext(node)) JBloomFilterAdd(filter, node->key);
+	return tree;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeAttachLookupCache(JAVLTreePtr tree, struct _jlookup_cache_t *cache)
+ * @brief AVL Tree 에 검색 캐시를 연결하는 함수
+ * 연결된 뒤에는 JAVLTreeFindNode 가 검색 캐시를 먼저 확인하고, 있으면 트리를 내려가지 않는다.
+ * 트리에서 찾은 노드는 검색 캐시에 기억하고, 추가, 삭제된 키의 항목은 지운다.
+ * 검색 캐시는 트리가 소유하지 않으므로 트리보다 나중에 삭제해야 한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param cache 연결할 검색 캐시의 주소, NULL 이면 연결 해제(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeAttachLookupCache(JAVLTreePtr tree, struct _jlookup_cache_t *cache)
+{
+	if(tree == NULL) return NULL;
+	if(cache != NULL && cache->type != tree->type) return NULL;
+
+	JLookupCacheClear(cache);
+	tree->cache = cache;
+	return tree;
+}
+
+/**
+ * @fn unsigned long long JAVLTreeHashKey(const void *key, KeyType type)
+ * @brief 키의 64 비트 해시 값을 구하는 함수
+ * 문자열은 FNV-1a 로 줄인 다음, 모든 유형을 같은 방식으로 한 번 더 섞어서
+ * 비슷한 키도 모든 비트가 고르게 달라지도록 한다.
+ * @param key 해시 값을 구할 키의 주소(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 성공 시 해시 값, 실패 시 0 반환
+ */
+unsigned long long JAVLTreeHashKey(const void *key, KeyType type)
+{
+	if(key == NULL) return 0;
+
+	unsigned long long hash = 0;
+	switch(type)
+	{
+		case IntType:
+			hash = (unsigned long long)(unsigned int)*((const int*)key);
+			break;
+		case CharType:
+			hash = (unsigned long long)(unsigned char)*((const char*)key);
+			break;
+		case StringType:
+		{
+			const unsigned char *bytes = (const unsigned char*)key;
+			hash = 0xcbf29ce484222325ULL;
+			for(; *bytes != '\0'; bytes++)
+			{
+				hash ^= *bytes;
+				hash *= 0x100000001b3ULL;
+			}
+			break;
+		}
+		case IntervalType:
+			hash = ((unsigned long long)(unsigned int)((const JInterval*)key)->start << 32) | (unsigned int)((const JInterval*)key)->end;
+			break;
+		default:
+			return 0;
+	}
+
+	hash ^= hash >> 30;
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	hash ^= hash >> 27;
+	hash *= 0x94d049bb133111ebULL;
+	hash ^= hash >> 31;
+	return hash;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeSetAugment(JAVLTreePtr tree, const JAVLTreeAugmentPtr augment)
+ * @brief AVL Tree 의 노드마다 하위 트리 집계 값을 저장하도록 설정하는 함수
+ * 집계 값은 노드 뒤에 함께 할당되며, 삽입, 삭제, 회전 시 바뀐 노드부터 루트까지 다시 계산한다.
+ * 노드 크기가 바뀌므로 빈 트리에서만 설정할 수 있다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param augment 집계 값 정의, NULL 이면 사용하지 않음(입력, 읽기 전용)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeSetAugment(JAVLTreePtr tree, const JAVLTreeAugmentPtr augment)
+{
+	if(tree == NULL || tree->nodeCount > 0) return NULL;
+
+	if(augment == NULL)
+	{
+		memset(&(tree->augment), 0, sizeof(JAVLTreeAugment));
+		return tree;
+	}
+
+	if(augment->aggregateSize == 0 || augment->identity == NULL || augment->lift == NULL || augment->combine == NULL) return NULL;
+	tree->augment = *augment;
+	return tree;
+}
+
+/**
+ * @fn const void* JAVLTreeGetAggregate(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 집계 값을 반환하는 함수
+ * 루트 노드의 집계 값은 트리 전체의 집계 값이다. (삭제 표시된 노드는 항등원으로 계산)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 집계 값을 구할 노드(입력, 읽기 전용)
+ * @return 성공 시 집계 값의 주소, 실패 시 NULL 반환
+ */
+const void* JAVLTreeGetAggregate(const JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree == NULL || node == NULL) return NULL;
+	return JAVLTreeGetNodeAggregate(tree, node);
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeAggregateRange(const JAVLTreePtr tree, void *lowKey, void *highKey, void *result)
+ * @brief AVL Tree 에서 lowKey 이상 highKey 이하인 키들을 순서대로 결합한 집계 값을 구하는 함수
+ * 두 키의 경로가 갈라지는 노드에서부터 양쪽 경계를 따라 내려가며,
+ * 범위 안에 완전히 들어가는 하위 트리는 저장된 집계 값을 그대로 사용하므로 O(log n) 이다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lowKey 범위의 하한 키 주소(입력)
+ * @param highKey 범위의 상한 키 주소(입력)
+ * @param result 집계 값을 저장할 주소, augment.aggregateSize 바이트 이상(출력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeAggregateRange(const JAVLTreePtr tree, void *lowKey, void *highKey, void *result)
+{
+	if(tree == NULL || lowKey == NULL || highKey == NULL || result == NULL) return NULL;
+	if(tree->augment.aggregateSize == 0) return NULL;
+
+	const JAVLTreeAugment *augment = &(tree->augment);
+	size_t aggregateSize = augment->aggregateSize;
+	unsigned long long inlineBuffer[JAVLTREE_AGGREGATE_INLINE_SIZE * 2 / sizeof(unsigned long long)];
+	unsigned char *buffer = (unsigned char*)inlineBuffer;
+
+	if(aggregateSize > JAVLTREE_AGGREGATE_INLINE_SIZE)
+	{
+		buffer = (unsigned char*)JAVLTreeAlloc(tree, aggregateSize * 2);
+		if(buffer == NULL) return NULL;
+	}
+
+	void *rightResult = buffer;
+	void *nodeResult = buffer + ((aggregateSize + 15) & ~(size_t)15);
+	JNodePtr splitNode = tree->root;
+
+	augment->identity(result, augment->userData);
+	if(JAVLTreeCompareKey(tree, lowKey, highKey) > 0) splitNode = NULL;
+
+	// 두 경계 키의 경로가 갈라지는 노드(범위 안의 가장 높은 노드)를 찾는다.
+	while(splitNode != NULL)
+	{
+		if(JAVLTreeCompareKey(tree, splitNode->key, lowKey) < 0) splitNode = splitNode->right;
+		else if(JAVLTreeCompareKey(tree, splitNode->key, highKey) > 0) splitNode = splitNode->left;
+		else break;
+	}
+
+	if(splitNode != NULL)
+	{
+		// 왼쪽 경계: 하한 이상인 노드는 자신과 오른쪽 하위 트리 전체가 범위 안이다.
+		JNodePtr node = splitNode->left;
+		while(node != NULL)
+		{
+			if(JAVLTreeCompareKey(tree, node->key, lowKey) >= 0)
+			{
+				JAVLTreeLiftNode(tree, node, nodeResult);
+				if(node->right != NULL) augment->combine(nodeResult, nodeResult, JAVLTreeGetNodeAggregate(tree, node->right), augment->userData);
+				augment->combine(result, nodeResult, result, augment->userData);
+				node = node->left;
+			}
+			else node = node->right;
+		}
+
+		JAVLTreeLiftNode(tree, splitNode, nodeResult);
+		augment->combine(result, result, nodeResult, augment->userData);
+
+		// 오른쪽 경계: 상한 이하인 노드는 자신과 왼쪽 하위 트리 전체가 범위 안이다.
+		augment->identity(rightResult, augment->userData);
+		node = splitNode->right;
+		while(node != NULL)
+		{
+			if(JAVLTreeCompareKey(tree, node->key, highKey) <= 0)
+			{
+				if(node->left != NULL) augment->combine(rightResult, rightResult, JAVLTreeGetNodeAggregate(tree, node->left), augment->userData);
+				JAVLTreeLiftNode(tree, node, nodeResult);
+				augment->combine(rightResult, rightResult, nodeResult, augment->userData);
+				node = node->right;
+			}
+			else node = node->left;
+		}
+
+		augment->combine(result, result, rightResult, augment->userData);
+	}
+
+	if(buffer != (unsigned char*)inlineBuffer) JAVLTreeFree(tree, buffer);
+	return tree;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeSetCompare(JAVLTreePtr tree, JAVLTreeCompareFunc compare, void *userData)
+ * @brief CustomType AVL Tree 의 키 비교 함수를 설정하는 함수
+ * 키 순서가 바뀌면 트리가 깨지므로 빈 트리에서만 설정할 수 있다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param compare 키 비교 함수(입력)
+ * @param userData 비교 함수에 전달할 사용자 데이터(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeSetCompare(JAVLTreePtr tree, JAVLTreeCompareFunc compare, void *userData)
+{
+	if(tree == NULL || compare == NULL || tree->type != CustomType || tree->nodeCount > 0) return NULL;
+
+	tree->compare = compare;
+	tree->compareData = userData;
+	return tree;
+}
+
+/**
+ * @fn int JAVLTreeCompare(const JAVLTreePtr tree, const void *key1, const void *key2)
+ * @brief AVL Tree 의 키 순서대로 두 키를 비교하는 함수 (트리 밖에서 키를 정렬할 때 사용)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @return key1 이 작으면 음수, 같으면 0, 크면 양수 반환 (비교할 수 없으면 0)
+ */
+int JAVLTreeCompare(const JAVLTreePtr tree, const void *key1, const void *key2)
+{
+	if(tree == NULL || key1 == NULL || key2 == NULL) return 0;
+	if(tree->type == CustomType && tree->compare == NULL) return 0;
+	return JAVLTreeCompareKey(tree, key1, key2);
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeEnableExpiry(JAVLTreePtr tree, JAVLTreeClockFunc clock, void *userData)
+ * @brief AVL Tree 의 노드마다 만료 시각을 지정할 수 있도록 설정하는 함수
+ * 만료 시각이 있는 노드는 최소 힙으로 관리하므로, JAVLTreeExpire 가 전체를 훑지 않고 만료된 노드만 삭제한다.
+ * 힙에서의 위치가 노드 뒤에 함께 할당되므로 처음 설정은 빈 트리에서만 할 수 있고, 이미 설정된 트리는 시각 함수만 바꾼다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param clock 현재 시각 함수, 지정하면 JAVLTreeFindNode, JAVLTreeFindBatch 가 삭제 전이라도 만료된 노드를 찾지 않음(입력)
+ * @param userData 현재 시각 함수에 전달할 사용자 데이터(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeEnableExpiry(JAVLTreePtr tree, JAVLTreeClockFunc clock, void *userData)
+{
+	if(tree == NULL) return NULL;
+
+	if(tree->expiry == NULL)
+	{
+		if(tree->nodeCount > 0) return NULL;
+
+		tree->expiry = (JExpiryHeapPtr)JAVLTreeAlloc(tree, sizeof(JExpiryHeap));
+		if(tree->expiry == NULL) return NULL;
+
+		tree->expiry->entries = NULL;
+		tree->expiry->count = 0;
+		tree->expiry->capacity = 0;
+	}
+
+	tree->expiry->clock = clock;
+	tree->expiry->clockData = userData;
+	return tree;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeAddNodeExpire(JAVLTreePtr tree, void *key, long long expireAt)
+ * @brief AVL Tree 에 만료 시각을 가진 새로운 노드를 추가하는 함수
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @param expireAt 만료 시각, JAVLTREE_NO_EXPIRE 이면 만료되지 않음(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeAddNodeExpire(JAVLTreePtr tree, void *key, long long expireAt)
+{
+	if(tree == NULL || key == NULL || tree->expiry == NULL) return NULL;
+
+	int isRevived = 0;
+	JNodePtr newNode = JAVLTreeInsertFrom(tree, tree->root, key, &isRevived, NULL);
+	if(JAVLTreeCommitInsert(tree, newNode, key, isRevived) == NULL) return NULL;
+
+	if(JAVLTreeSetExpire(tree, newNode, expireAt) == NULL)
+	{
+		JAVLTreeDeleteNode(tree, newNode);
+		return NULL;
+	}
+	return newNode;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeSetExpire(JAVLTreePtr tree, JNodePtr node, long long expireAt)
+ * @brief 트리에 있는 노드의 만료 시각을 지정하거나 바꾸는 함수 (O(log n))
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 만료 시각을 지정할 노드, JAVLTreeFindNode 등으로 찾은 노드(입력)
+ * @param expireAt 만료 시각, JAVLTREE_NO_EXPIRE 이면 만료 시각을 지움(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeSetExpire(JAVLTreePtr tree, JNodePtr node, long long expireAt)
+{
+	if(tree == NULL || node == NULL || tree->expiry == NULL) return NULL;
+	if(node->flags & JNODE_FLAG_TOMBSTONE) return NULL;
+
+	JExpiryHeapPtr heap = tree->expiry;
+	int position = *JAVLTreeGetNodeHeapIndex(tree, node);
+
+	if(expireAt == JAVLTREE_NO_EXPIRE)
+	{
+		JExpiryHeapRemove(tree, node);
+		return node;
+	}
+
+	if(position < 0)
+	{
+		if(heap->count == heap->capacity)
+		{
+			int newCapacity = (heap->capacity > 0) ? heap->capacity * 2 : 16;
+			// 할당자에는 크기 변경 함수가 없으므로 새로 할당해서 옮긴다.
+			JExpiryEntryPtr newEntries = (JExpiryEntryPtr)JAVLTreeAlloc(tree, sizeof(JExpiryEntry) * (size_t)newCapacity);
+			if(newEntries == NULL) return NULL;
+			if(heap->count > 0) memcpy(newEntries, heap->entries, sizeof(JExpiryEntry) * (size_t)heap->count);
+			JAVLTreeFree(tree, heap->entries);
+			heap->entries = newEntries;
+			heap->capacity = newCapacity;
+		}
+		position = heap->count++;
+	}
+
+	JExpiryEntry entry;
+	entry.expireAt = expireAt;
+	entry.node = node;
+	JExpiryHeapMove(tree, position, entry);
+	JExpiryHeapSiftUp(tree, position);
+	JExpiryHeapSiftDown(tree, *JAVLTreeGetNodeHeapIndex(tree, node));
+	return node;
+}
+
+/**
+ * @fn long long JAVLTreeGetExpire(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드의 만료 시각을 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 노드의 주소(입력, 읽기 전용)
+ * @return 만료 시각, 만료 시각이 없거나 실패 시 JAVLTREE_NO_EXPIRE 반환
+ */
+long long JAVLTreeGetExpire(const JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree == NULL || node == NULL || tree->expiry == NULL) return JAVLTREE_NO_EXPIRE;
+
+	int position = *JAVLTreeGetNodeHeapIndex(tree, node);
+	if(position < 0) return JAVLTREE_NO_EXPIRE;
+	return tree->expiry->entries[position].expireAt;
+}
+
+/**
+ * @fn int JAVLTreeExpire(JAVLTreePtr tree, long long now, int maxCount)
+ * @brief 만료 시각이 now 이하인 노드를 만료 시각 순서로 삭제하는 함수
+ * 힙의 맨 앞만 확인하므로 k 개를 삭제하는 데 O(k log n) 이 걸리고, 만료된 노드가 없으면 O(1) 이다.
+ * maxCount 로 한 번에 삭제할 개수를 제한하면 남은 노드는 다음 호출에서 이어서 삭제한다.
+ * 삭제는 JAVLTreeDeleteNodeKey 와 같으므로 로그 기록, 지연 삭제 모드를 따른다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param now 현재 시각(입력)
+ * @param maxCount 한 번에 삭제할 최대 개수, 0 이하이면 제한 없음(입력)
+ * @return 삭제한 노드 개수, 실패 시 -1 반환
+ */
+int JAVLTreeExpire(JAVLTreePtr tree, long long now, int maxCount)
+{
+	if(tree == NULL || tree->expiry == NULL) return -1;
+
+	JExpiryHeapPtr heap = tree->expiry;
+	int removedCount = 0;
+
+	while(heap->count > 0 && heap->entries[0].expireAt <= now)
+	{
+		if(maxCount > 0 && removedCount >= maxCount) break;
+		if(JAVLTreeDeleteNode(tree, heap->entries[0].node) == DeleteFail) break;
+		removedCount++;
+	}
+
+	return removedCount;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeAddNode(JAVLTreePtr tree, void *key)
+ * @brief AVL Tree에 새로운 노드를 추가하는 함수
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeAddNode(JAVLTreePtr tree, void *key)
+{
+	if((tree == NULL || key == NULL)) return NULL;
+
+	int isRevived = 0;
+	JNodePtr newNode = JAVLTreeInsertFrom(tree, tree->root, key, &isRevived, NULL);
+	if(JAVLTreeCommitInsert(tree, newNode, key, isRevived) == NULL) return NULL;
+	return tree;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeAddNodeHint(JAVLTreePtr tree, JNodePtr hint, void *key)
+ * @brief 지정한 위치(힌트)에서부터 탐색을 시작해서 AVL Tree에 새로운 노드를 추가하는 함수
+ * 힌트 노드에서 새로운 키를 포함하는 하위 트리가 나올 때까지만 올라갔다가 내려가므로,
+ * 힌트와 새로운 키 사이의 거리가 d 이면 O(log d) 만큼 탐색한다.
+ * 힌트가 NULL 이면 마지막으로 추가된 노드를 힌트로 사용한다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param hint 탐색을 시작할 노드의 주소, 이전 삽입 결과나 순회 중인 노드(입력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeAddNodeHint(JAVLTreePtr tree, JNodePtr hint, void *key)
+{
+	if((tree == NULL || key == NULL)) return NULL;
+
+	if(hint == NULL) hint = tree->finger;
+
+	JNodePtr startNode = tree->root;
+	if(hint != NULL) startNode = JAVLTreeClimbFromHint(tree, hint, key);
+
+	int isRevived = 0;
+	JNodePtr newNode = JAVLTreeInsertFrom(tree, startNode, key, &isRevived, NULL);
+	return JAVLTreeCommitInsert(tree, newNode, key, isRevived);
+}
+
+/**
+ * @fn DeleteResult JAVLTreeDeleteNodeKey(JAVLTreePtr tree, void *key)
+ * @brief AVL Tree에 지정한 키를 가진 노드를 삭제하는 함수
+ * 지연 삭제 모드에서는 회전 없이 노드에 삭제 표시만 하고(O(log n)),
+ * 삭제 표시된 노드 비율이 임계값 이상이 되면 JAVLTreePurgeTombstones 로 트리를 다시 만든다.
+ * @param tree AVL Tree 구조체 객체의 주소(츨력)
+ * @param key 삭제할 키의 주소(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JAVLTreeDeleteNodeKey(JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return DeleteFail;
+
+	JNodePtr selectedNode = (tree->index != NULL) ? JHashIndexFind(tree->index, key) : JNodeFind(tree->root, key, tree);
+	if(selectedNode == NULL || (selectedNode->flags & JNODE_FLAG_TOMBSTONE)) return DeleteFail;
+	return JAVLTreeDeleteNode(tree, selectedNode);
+}
+
+/**
+ * @fn JNodePtr JAVLTreeInsertNode(JAVLTreePtr tree, JNodePtr node)
+ * @brief 호출한 쪽이 할당하고 키를 설정한 노드를 AVL Tree 에 연결하는 함수
+ * 노드와 값을 한 번에 할당하는 경우처럼 노드 메모리를 직접 관리할 때 사용하며,
+ * 연결된 노드는 JAVLTreeExtractNode 나 JAVLTreeClear 로 떼어낸 뒤 호출한 쪽이 해제한다.
+ * 노드 뒤에 집계 값이나 만료 정보, 키를 두는 트리와 지연 삭제 모드에서는 사용할 수 없다.
+ * 연결된 노드는 JNODE_FLAG_EXTERNAL 로 표시되며 JAVLTreeCompact 가 옮기지 않는다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 연결할 노드, 키가 설정되어 있어야 함(입력)
+ * @return 성공 시 연결된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeInsertNode(JAVLTreePtr tree, JNodePtr node)
+{
+	if(tree == NULL || node == NULL || node->key == NULL) return NULL;
+	if(tree->augment.aggregateSize > 0 || tree->tombstoneThreshold > 0 || tree->expiry != NULL) return NULL;
+	if(tree->keyOwner == KeyOwnerTree) return NULL;
+
+	int isRevived = 0;
+	if(JAVLTreeInsertFrom(tree, tree->root, node->key, &isRevived, node) != node) return NULL;
+
+	if(JAVLTreeLogOperation(tree, WALAddNode, node->key) == 0)
+	{
+		JAVLTreeUnlinkNode(tree, node);
+		return NULL;
+	}
+	JAVLTreeOnInsert(tree, node);
+	node->flags |= JNODE_FLAG_EXTERNAL;
+	tree->externalCount++;
+	return node;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeExtractNode(JAVLTreePtr tree, JNodePtr node)
+ * @brief AVL Tree 에서 지정한 노드를 떼어내고 해제하지 않고 반환하는 함수
+ * 키로 다시 찾지 않으므로, 순회 중인 노드를 삭제할 때 탐색 없이 균형만 맞춘다.
+ * 트리가 할당한 노드는 JAVLTreeFree 로 해제한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 떼어낼 노드, 반드시 이 트리에 연결된 노드(입력)
+ * @return 성공 시 떼어낸 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeExtractNode(JAVLTreePtr tree, JNodePtr node)
+{
+	if(tree == NULL || node == NULL || tree->root == NULL) return NULL;
+
+	if((node->flags & JNODE_FLAG_TOMBSTONE) == 0)
+	{
+		if(JAVLTreeLogOperation(tree, WALDeleteNode, node->key) == 0) return NULL;
+		JAVLTreeOnDelete(tree, node);
+	}
+
+	JAVLTreeUnlinkNode(tree, node);
+	return node;
+}
+
+/**
+ * @fn JAVLTreePtr JAVLTreeClear(JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData)
+ * @brief AVL Tree 의 모든 노드를 떼어내서 빈 트리로 만드는 함수
+ * 노드마다 release 를 후위 순회 순서로 호출하므로, 호출된 노드의 자식은 이미 처리된 상태이다.
+ * 로그에는 기록하지 않으므로 로그가 연결된 트리는 비울 수 없다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param release 노드를 해제하는 함수, NULL 이면 트리의 할당자로 해제(입력)
+ * @param userData release 에 전달할 사용자 데이터(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JAVLTreeClear(JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData)
+{
+	if(tree == NULL || tree->wal != NULL) return NULL;
+
+	JAVLTreeEndCompact(tree);
+	JNodeReleaseChilds(tree->root, tree, release, userData);
+	tree->root = NULL;
+	tree->min = NULL;
+	tree->max = NULL;
+	tree->finger = NULL;
+	tree->relaxCursor = NULL;
+	tree->nodeCount = 0;
+	tree->externalCount = 0;
+	tree->tombstoneCount = 0;
+
+	JLookupCacheClear(tree->cache);
+	JBloomFilterClear(tree->bloom);
+	JHashIndexClear(tree->index);
+	if(tree->expiry != NULL) tree->expiry->count = 0;
+	return tree;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeFindNode(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키를 가진 노드를 찾는 함수
+ * 해시 색인이 있으면(LookupHash) 트리를 내려가지 않고 해시 색인에서 찾는다.
+ * 검색 캐시가 연결되어 있으면 최근에 찾은 키는 트리를 내려가지 않고 바로 반환한다.
+ * 이때 캐시에 없던 키는 찾은 노드를 캐시에 채우므로, 캐시가 연결된 트리에서는 이 함수도 다른 검색과 동시에 호출할 수 없다.
+ * Bloom Filter 가 연결되어 있으면 없는 키는 대부분 트리를 내려가지 않고 실패한다.
+ * 만료 시각과 현재 시각 함수가 설정되어 있으면 만료된 노드는 삭제 전이라도 찾지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeFindNode(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	if(tree->index != NULL) return JAVLTreeCheckExpired(tree, JHashIndexFind(tree->index, key));
+
+	JNodePtr node = NULL;
+	if(tree->cache != NULL)
+	{
+		node = JLookupCacheFind(tree->cache, key);
+		if(node != NULL) return JAVLTreeCheckExpired(tree, node);
+	}
+	if(tree->bloom != NULL && JBloomFilterMayContain(tree->bloom, key) == FindFail) return NULL;
+
+	node = JAVLTreeCheckFound(tree, JNodeFind(tree->root, key, tree));
+	if(node != NULL && tree->cache != NULL) JLookupCacheFill(tree->cache, node);
+	return JAVLTreeCheckExpired(tree, node);
+}
+
+/**
+ * @fn int JAVLTreeFindBatch(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results)
+ * @brief AVL Tree 에서 여러 키를 한꺼번에 찾는 함수
+ * 키들을 JAVLTREE_BATCH_GROUP_SIZE 개씩 묶어서 한 단계씩 번갈아 내려가고,
+ * 각 키가 다음에 읽을 노드를 미리 가져오도록(prefetch) 해서 캐시 미스가 겹치도록 한다.
+ * 만료된 노드는 JAVLTreeFindNode 와 같은 방법으로 걸러낸다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param keys 찾을 키들의 주소 배열(입력)
+ * @param count 찾을 키 개수(입력)
+ * @param results 키마다 찾은 노드의 주소를 저장할 배열, 없으면 NULL 저장(출력)
+ * @return 성공 시 찾은 키 개수, 실패 시 -1 반환
+ */
+int JAVLTreeFindBatch(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results)
+{
+	if(tree == NULL || keys == NULL || results == NULL || count < 0) return -1;
+
+	int foundCount = 0;
+	int offset = 0;
+
+	if(tree->index != NULL)
+	{
+		for(; offset < count; offset++)
+		{
+			results[offset] = JHashIndexFind(tree->index, keys[offset]);
+			if(results[offset] != NULL) foundCount++;
+		}
+	}
+	else
+	{
+		for(; offset < count; offset += JAVLTREE_BATCH_GROUP_SIZE)
+		{
+			int groupCount = count - offset;
+			if(groupCount > JAVLTREE_BATCH_GROUP_SIZE) groupCount = JAVLTREE_BATCH_GROUP_SIZE;
+			foundCount += JAVLTreeFindGroup(tree, keys + offset, groupCount, results + offset);
+		}
+	}
+
+	if(tree->expiry != NULL && tree->expiry->clock != NULL)
+	{
+		for(offset = 0; offset < count; offset++)
+		{
+			if(results[offset] != NULL && JAVLTreeCheckExpired(tree, results[offset]) == NULL)
+			{
+				results[offset] = NULL;
+				foundCount--;
+			}
+		}
+	}
+
+	return foundCount;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeGetMin(const JAVLTreePtr tree)
+ * @brief AVL Tree 에서 가장 작은 키를 가진 노드를 반환하는 함수
+ * 삽입, 삭제 시 갱신되는 노드를 반환하므로 트리를 내려가지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 작은 키를 가진 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeGetMin(const JAVLTreePtr tree)
+{
+	if(tree == NULL || tree->min == NULL) return NULL;
+	if(tree->min->flags & JNODE_FLAG_TOMBSTONE) return JNodeGetNext(tree->min);
+	return tree->min;
+}
+
+/**
+ * @fn JNodePtr JAVLTreeGetMax(const JAVLTreePtr tree)
+ * @brief AVL Tree 에서 가장 큰 키를 가진 노드를 반환하는 함수
+ * 삽입, 삭제 시 갱신되는 노드를 반환하므로 트리를 내려가지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 큰 키를 가진 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeGetMax(const JAVLTreePtr tree)
+{
+	if(tree == NULL || tree->max == NULL) return NULL;
+	if(tree->max->flags & JNODE_FLAG_TOMBSTONE) return JNodeGetPrev(tree->max);
+	return tree->max;
+}
+
+/**
+ * @fn void* JAVLTreePopMin(JAVLTreePtr tree)
+ * @brief AVL Tree 에서 가장 작은 키를 가진 노드를 삭제하고 그 키를 반환하는 함수
+ * 최소 노드는 왼쪽 자식이 없으므로 왼쪽 가장자리 경로만 따라 올라가며 균형을 맞춘다.
+ * 노드 안에 저장된 키는 노드와 함께 해제되므로 트리의 poppedKey 로 옮겨서 반환하며,
+ * 이 주소는 다음 PopMin, PopMax 호출까지만 유효하다. (키 저장 블록을 늘리지 않으므로 반복해도 메모리가 늘지 않음)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 노드의 키 주소, 실패 시 NULL 반환
+ */
+void* JAVLTreePopMin(JAVLTreePtr tree)
+{
+	if(tree == NULL) return NULL;
+
+	// 가장자리의 삭제 표시된 노드는 여기서 실제로 삭제한다.
+	while(tree->min != NULL && (tree->min->flags & JNODE_FLAG_TOMBSTONE))
+	{
+		JNodePtr tombstoneNode = tree->min;
+		JAVLTreeUnlinkNode(tree, tombstoneNode);
+		JAVLTreeFree(tree, tombstoneNode);
+	}
+	if(tree->min == NULL) return NULL;
+
+	JNodePtr minNode = tree->min;
+	void *key = minNode->key;
+	if(JAVLTreeLogOperation(tree, WALDeleteNode, key) == 0) return NULL;
+	JAVLTreeOnDelete(tree, minNode);
+
+	JAVLTreeUnlinkNode(tree, minNode);
+	if(JAVLTreeIsInlineKey(tree, minNode) == 1)
+	{
+		memcpy(tree->poppedKey, key, JAVLTREE_INLINE_KEY_SIZE);
+		key = tree->poppedKey;
+	}
+	JAVLTreeFree(tree, minNode);
+	return key;
+}
+
+/**
+ * @fn void* JAVLTreePopMax(JAVLTreePtr tree)
+ * @brief AVL Tree 에서 가장 큰 키를 가진 노드를 삭제하고 그 키를 반환하는 함수
+ * 최대 노드는 오른쪽 자식이 없으므로 오른쪽 가장자리 경로만 따라 올라가며 균형을 맞춘다.
+ * 노드 안에 저장된 키는 노드와 함께 해제되므로 트리의 poppedKey 로 옮겨서 반환하며,
+ * 이 주소는 다음 PopMin, PopMax 호출까지만 유효하다. (키 저장 블록을 늘리지 않으므로 반복해도 메모리가 늘지 않음)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 노드의 키 주소, 실패 시 NULL 반환
+ */
+void* JAVLTreePopMax(JAVLTreePtr tree)
+{
+	if(tree == NULL) return NULL;
+
+	// 가장자리의 삭제 표시된 노드는 여기서 실제로 삭제한다.
+	while(tree->max != NULL && (tree->max->flags & JNODE_FLAG_TOMBSTONE))
+	{
+		JNodePtr tombstoneNode = tree->max;
+		JAVLTreeUnlinkNode(tree, tombstoneNode);
+		JAVLTreeFree(tree, tombstoneNode);
+	}
+	if(tree->max == NULL) return NULL;
+
+	JNodePtr maxNode = tree->max;
+	void *key = maxNode->key;
+	if(JAVLTreeLogOperation(tree, WALDeleteNode, key) == 0) return NULL;
+	JAVLTreeOnDelete(tree, maxNode);
+
+	JAVLTreeUnlinkNode(tree, maxNode);
+	if(JAVLTreeIsInlineKey(tree, maxNode) == 1)
+	{
+		memcpy(tree->poppedKey, key, JAVLTREE_INLINE_KEY_SIZE);
+		key = tree->poppedKey;
+	}
+	JAVLTreeFree(tree, maxNode);
+	return key;
+}
+
+/**
+ * @fn void JAVLTreePreorderTraverse(const JAVLTreePtr tree)
+ * @brief AVL Tree 를 전위 순회하며 노드의 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JAVLTreePreorderTraverse(const JAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JNodePreorderTraverse(tree->root, tree->type);
+	printf("\n");
+}
+
+/**
+ * @fn void JAVLTreeInorderTraverse(const JAVLTreePtr tree)
+ * @brief AVL Tree 를 중위 순회하며 노드의 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JAVLTreeInorderTraverse(const JAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JNodeInorderTraverse(tree->root, tree->type);
+	printf("\n");
+}
+
+/**
+ * @fn void JAVLTreePostorderTraverse(const JAVLTreePtr tree)
+ * @brief AVL Tree 를 후위 순회하며 노드의 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JAVLTreePostorderTraverse(const JAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JNodePostorderTraverse(tree->root, tree->type);
+	printf("\n");
+}
+
+/**
+ * @fn JNodePtr JAVLTreeLowerBound(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 크거나 같은 키 중 가장 작은 키를 가진 노드를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeLowerBound(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundGreaterEqual);
+}
+
+/**
+ * @fn JNodePtr JAVLTreeUpperBound(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 큰 키 중 가장 작은 키를 가진 노드를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeUpperBound(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundGreater);
+}
+
+/**
+ * @fn JNodePtr JAVLTreeFloor(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 작거나 같은 키 중 가장 큰 키를 가진 노드를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeFloor(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundLessEqual);
+}
+
+/**
+ * @fn JNodePtr JAVLTreeCeiling(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 크거나 같은 키 중 가장 작은 키를 가진 노드를 찾는 함수
+ * JAVLTreeFloor 와 짝을 이루는 이름으로, JAVLTreeLowerBound 와 같은 노드를 반환
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeCeiling(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundGreaterEqual);
+}
+
+/**
+ * @fn JNodePtr JAVLTreePredecessor(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 작은 키 중 가장 큰 키를 가진 노드(이전 노드)를 찾는 함수
+ * 지정한 키가 AVL Tree 에 없어도 된다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreePredecessor(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundLess);
+}
+
+/**
+ * @fn JNodePtr JAVLTreeSuccessor(const JAVLTreePtr tree, void *key)
+ * @brief AVL Tree 에서 지정한 키보다 큰 키 중 가장 작은 키를 가진 노드(다음 노드)를 찾는 함수
+ * 지정한 키가 AVL Tree 에 없어도 된다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JAVLTreeSuccessor(const JAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	return JNodeFindBound(tree->root, key, tree, BoundGreater);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JNode Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JNodePtr JNodeRotateLL(JNodePtr node)
+ * @brief 지정한 노드를 기준으로 하위 노드들에 대해 LL 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
+ * 회전된 노드들의 부모 노드와 높이를 갱신하며, 상위 노드의 자식 연결은 호출한 쪽에서 바꾼다.
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRotateLL(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->left;
+
+	parentNode->left = currentNode->right;
+	if(currentNode->right != NULL) currentNode->right->parent = parentNode;
+	currentNode->right = parentNode;
+
+	currentNode->parent = parentNode->parent;
+	parentNode->parent = currentNode;
+
+	JNodeUpdateHeight(parentNode);
+	JNodeUpdateHeight(currentNode);
+	return currentNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeRotateLR(const JNodePtr node)
+ * @brief 지정한 노드를 기준으로 하위 노드들에 대해 LR 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRotateLR(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->left;
+
+	parentNode->left = JNodeRotateRR(currentNode);
+	return JNodeRotateLL(parentNode);
+}
+
+/**
+ * @fn static JNodePtr JNodeRotateRR(const JNodePtr node)
+ * @brief 지정한 노드를 기준으로 하위 노드들에 대해 RR 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
+ * 회전된 노드들의 부모 노드와 높이를 갱신하며, 상위 노드의 자식 연결은 호출한 쪽에서 바꾼다.
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRotateRR(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->right;
+
+	parentNode->right = currentNode->left;
+	if(currentNode->left != NULL) currentNode->left->parent = parentNode;
+	currentNode->left = parentNode;
+
+	currentNode->parent = parentNode->parent;
+	parentNode->parent = currentNode;
+
+	JNodeUpdateHeight(parentNode);
+	JNodeUpdateHeight(currentNode);
+	return currentNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeRotateRL(const JNodePtr node)
+ * @brief 지정한 노드를 기준으로 하위 노드들에 대해 RL 인 상황에서 AVL Tree 를 균형있게 회전하는 함수
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRotateRL(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->right;
+
+	parentNode->right = JNodeRotateLL(currentNode);
+	return JNodeRotateRR(parentNode);
+}
+
+/**
+ * @fn static int JNodeGetHeight(const JNodePtr node)
+ * @brief AVL Tree 에서 지정한 노드의 높이를 구하는 함수
+ * 최하위 노드는 1, 이하 부모 노드 레벨(높이)부터 1 씩 증가
+ * 노드에 저장된 높이를 반환하므로 하위 노드들을 순회하지 않는다.
+ * @param node 높이를 구하기 위한 노드(입력, 읽기 전용) 
+ * @return 성공 시 0 이상의 높이, 실패 시 0 반환
+ */
+static int JNodeGetHeight(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+	return node->height;
+}
+
+/**
+ * @fn static int JNodeGetHeightDiff(const JNodePtr node)
+ * @brief AVL Tree 에서 지정한 노드의 자식노드들의 높이 차이를 구하는 함수
+ * @param node 높이의 차이를 구하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 자식 노드들의 높이 차이, 실패 시 0 반환
+ */
+static int JNodeGetHeightDiff(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+	return JNodeGetHeight(node->left) - JNodeGetHeight(node->right);
+}
+
+/**
+ * @fn static void JNodeUpdateHeight(JNodePtr node)
+ * @brief 자식 노드들의 높이로 지정한 노드의 높이를 다시 계산하는 함수
+ * @param node 높이를 갱신할 노드(출력)
+ * @return 반환값 없음
+ */
+static void JNodeUpdateHeight(JNodePtr node)
+{
+	if(node == NULL) return;
+
+	int leftHeight = JNodeGetHeight(node->left);
+	int rightHeight = JNodeGetHeight(node->right);
+
+	if(leftHeight > rightHeight) node->height = leftHeight + 1;
+	else node->height = rightHeight + 1;
+}
+
+/**
+ * @fn static JNodePtr JNodeRebalance(JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이 균형을 맞추는 함수
+ * 자식 노드들은 이미 균형이 맞고 높이가 갱신되어 있어야 한다.
+ * @param node 균형을 맞출 하위 트리의 루트 노드(입력)
+ * @return 성공 시 하위 트리의 새로운 루트 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRebalance(JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodeUpdateHeight(node);
+	int heightDiff = JNodeGetHeightDiff(node);
+
+	if(heightDiff > 1)
+	{
+		if(JNodeGetHeightDiff(node->left) >= 0) return JNodeRotateLL(node);
+		else return JNodeRotateLR(node);
+	}
+
+	if(heightDiff < -1)
+	{
+		if(JNodeGetHeightDiff(node->right) <= 0) return JNodeRotateRR(node);
+		else return JNodeRotateRL(node);
+	}
+
+	return node;
+}
+
+/**
+ * @fn static void JNodeDeleteChilds(JNodePtr node, const JAVLTreePtr tree)
+ * @brief AVL Tree 에 저장된 노드들을 모두 삭제하는 함수(재귀)
+ * @param node 자식 노드들을 삭제하기 위한 기준 노드(입력)
+ * @param tree 노드를 할당한 AVL Tree(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JNodeDeleteChilds(JNodePtr node, const JAVLTreePtr tree)
+{
+	if(node == NULL) return;
+	
+	if(node->left != NULL)
+	{
+		JNodeDeleteChilds(node->left, tree);
+		JAVLTreeFree(tree, node->left);
+		node->left = NULL;
+	}
 
 	if(node->right != NULL)
 	{
-		JNodeDeleteChilds(node->right);
-		free(node->right);
-		node->right = NULL;
+		JNodeDeleteChilds(node->right, tree);
+		JAVLTreeFree(tree, node->right);
+		node->right = NULL;
+	}
+}
+
+/**
+ * @fn static JNodePtr JNodeFind(JNodePtr node, void *key, const JAVLTreePtr tree)
+ * @brief 지정한 노드부터 내려가면서 전달받은 키와 같은 키를 가진 노드를 찾는 함수
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 찾을 키의 주소(입력)
+ * @param tree 키 비교 방법을 가진 AVL Tree 의 주소(입력, 읽기 전용)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFind(JNodePtr node, void *key, const JAVLTreePtr tree)
+{
+	while(node != NULL)
+	{
+		int compareResult = JAVLTreeCompareKey(tree, node->key, key);
+		if(compareResult == 0) break;
+
+		if(compareResult > 0) node = node->left;
+		else node = node->right;
+	}
+	return node;
+}
+
+/**
+ * @fn static void JNodePreorderTraverse(const JNodePtr node, KeyType type)
+ * @brief 지정한 노드를 기준으로 전위 순회하며 키를 출력하는 함수(재귀)
+ * @param node 순회할 기준 노드의 주소(입력)
+ * @param type 출력할 키의 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JNodePreorderTraverse(const JNodePtr node, KeyType type)
+{
+	if(node == NULL) return;
+	JNodePrintKey(node, type);
+	JNodePreorderTraverse(node->left, type);
+	JNodePreorderTraverse(node->right, type);
+}
+
+/**
+ * @fn static void JNodeInorderTraverse(const JNodePtr node, KeyType type)
+ * @brief 지정한 노드를 기준으로 중위 순회하며 키를 출력하는 함수(재귀)
+ * @param node 순회할 기준 노드의 주소(입력)
+ * @param type 출력할 키의 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JNodeInorderTraverse(const JNodePtr node, KeyType type)
+{
+	if(node == NULL) return;
+	JNodeInorderTraverse(node->left, type);
+	JNodePrintKey(node, type);
+	JNodeInorderTraverse(node->right, type);
+}
+
+/**
+ * @fn static void JNodePostorderTraverse(const JNodePtr node, KeyType type)
+ * @brief 지정한 노드를 기준으로 후위 순회하며 키를 출력하는 함수(재귀)
+ * @param node 순회할 기준 노드의 주소(입력)
+ * @param type 출력할 키의 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JNodePostorderTraverse(const JNodePtr node, KeyType type)
+{
+	if(node == NULL) return;
+	JNodePostorderTraverse(node->left, type);
+	JNodePostorderTraverse(node->right, type);
+	JNodePrintKey(node, type);
+}
+
+/**
+ * @fn static void JNodePrintKey(const JNodePtr node, KeyType type)
+ * @brief 지정한 노드의 키를 출력하는 함수
+ * @param node 출력할 노드의 주소(입력, 읽기 전용)
+ * @param type 출력할 키의 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JNodePrintKey(const JNodePtr node, KeyType type)
+{
+	if(node->flags & JNODE_FLAG_TOMBSTONE) return;
+
+	switch(type)
+	{
+		case IntType:
+			printf("%d ", *((int*)(node->key)));
+			break;
+		case CharType:
+			printf("%c ", *((char*)(node->key)));
+			break;
+		case StringType:
+			printf("%s ", (char*)(node->key));
+			break;
+		case IntervalType:
+			printf("[%d, %d] ", ((JInterval*)(node->key))->start, ((JInterval*)(node->key))->end);
+			break;
+		default: return;
+	}
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBound(JNodePtr node, void *key, const JAVLTreePtr tree, JNodeBound bound)
+ * @brief 지정한 노드부터 한 번 내려가면서 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * 키 데이터 유형별로 특화된 함수를 호출해서 노드마다 유형을 검사하지 않도록 한다.
+ * 찾은 노드가 삭제 표시되어 있으면 조건 방향의 다음(또는 이전) 노드를 반환한다.
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키의 주소(입력)
+ * @param tree 키 데이터 유형과 비교 방법을 가진 AVL Tree 의 주소(입력, 읽기 전용)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBound(JNodePtr node, void *key, const JAVLTreePtr tree, JNodeBound bound)
+{
+	JNodePtr boundNode = NULL;
+
+	switch(tree->type)
+	{
+		case IntType:
+			boundNode = JNodeFindBoundInt(node, *((int*)key), bound);
+			break;
+		case CharType:
+			boundNode = JNodeFindBoundChar(node, *((char*)key), bound);
+			break;
+		case StringType:
+			boundNode = JNodeFindBoundString(node, (char*)key, bound);
+			break;
+		case IntervalType:
+			boundNode = JNodeFindBoundInterval(node, (JInterval*)key, bound);
+			break;
+		case CustomType:
+			boundNode = JNodeFindBoundCustom(node, key, tree, bound);
+			break;
+		default:
+			return NULL;
+	}
+
+	// 삭제 표시된 노드이면 같은 방향으로 가장 가까운 노드로 옮긴다.
+	if(boundNode == NULL || (boundNode->flags & JNODE_FLAG_TOMBSTONE) == 0) return boundNode;
+	if(bound == BoundGreaterEqual || bound == BoundGreater) return JNodeGetNext(boundNode);
+	return JNodeGetPrev(boundNode);
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBoundInt(JNodePtr node, int key, JNodeBound bound)
+ * @brief 정수 키에 대해 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * 조건을 만족하는 노드를 후보로 기억하고, 더 가까운 후보가 있는 방향으로 내려간다.
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키(입력)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBoundInt(JNodePtr node, int key, JNodeBound bound)
+{
+	JNodePtr candidateNode = NULL;
+	int isLowerBound = (bound == BoundGreaterEqual) || (bound == BoundGreater);
+
+	while(node != NULL)
+	{
+		int nodeKey = *((int*)(node->key));
+		int isCandidate = _IsBoundCandidate((nodeKey > key) - (nodeKey < key), bound);
+
+		if(isCandidate) candidateNode = node;
+		if(isCandidate == isLowerBound) node = node->left;
+		else node = node->right;
+	}
+
+	return candidateNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBoundChar(JNodePtr node, char key, JNodeBound bound)
+ * @brief 문자 키에 대해 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키(입력)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBoundChar(JNodePtr node, char key, JNodeBound bound)
+{
+	JNodePtr candidateNode = NULL;
+	int isLowerBound = (bound == BoundGreaterEqual) || (bound == BoundGreater);
+
+	while(node != NULL)
+	{
+		char nodeKey = *((char*)(node->key));
+		int isCandidate = _IsBoundCandidate((nodeKey > key) - (nodeKey < key), bound);
+
+		if(isCandidate) candidateNode = node;
+		if(isCandidate == isLowerBound) node = node->left;
+		else node = node->right;
+	}
+
+	return candidateNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBoundString(JNodePtr node, const char *key, JNodeBound bound)
+ * @brief 문자열 키에 대해 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키(입력, 읽기 전용)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBoundString(JNodePtr node, const char *key, JNodeBound bound)
+{
+	JNodePtr candidateNode = NULL;
+	int isLowerBound = (bound == BoundGreaterEqual) || (bound == BoundGreater);
+
+	while(node != NULL)
+	{
+		int isCandidate = _IsBoundCandidate(strcmp((char*)(node->key), key), bound);
+
+		if(isCandidate) candidateNode = node;
+		if(isCandidate == isLowerBound) node = node->left;
+		else node = node->right;
+	}
+
+	return candidateNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBoundInterval(JNodePtr node, const JInterval *key, JNodeBound bound)
+ * @brief 구간 키에 대해 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키(입력, 읽기 전용)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBoundInterval(JNodePtr node, const JInterval *key, JNodeBound bound)
+{
+	JNodePtr candidateNode = NULL;
+	int isLowerBound = (bound == BoundGreaterEqual) || (bound == BoundGreater);
+
+	while(node != NULL)
+	{
+		int isCandidate = _IsBoundCandidate(_CompareKey(node->key, key, IntervalType), bound);
+
+		if(isCandidate) candidateNode = node;
+		if(isCandidate == isLowerBound) node = node->left;
+		else node = node->right;
+	}
+
+	return candidateNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeFindBoundCustom(JNodePtr node, const void *key, const JAVLTreePtr tree, JNodeBound bound)
+ * @brief 사용자 정의 키에 대해 탐색 경계 조건을 만족하는 노드를 찾는 함수
+ * @param node 탐색을 시작할 노드의 주소(입력)
+ * @param key 기준 키(입력, 읽기 전용)
+ * @param tree 비교 함수를 가진 AVL Tree 의 주소(입력, 읽기 전용)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeFindBoundCustom(JNodePtr node, const void *key, const JAVLTreePtr tree, JNodeBound bound)
+{
+	JNodePtr candidateNode = NULL;
+	int isLowerBound = (bound == BoundGreaterEqual) || (bound == BoundGreater);
+
+	while(node != NULL)
+	{
+		int isCandidate = _IsBoundCandidate(JAVLTreeCompareKey(tree, node->key, key), bound);
+
+		if(isCandidate) candidateNode = node;
+		if(isCandidate == isLowerBound) node = node->left;
+		else node = node->right;
+	}
+
+	return candidateNode;
+}
+
+/**
+ * @fn static void JNodeReleaseChilds(JNodePtr node, const JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 노드들을 후위 순회하며 해제하는 함수(재귀)
+ * @param node 하위 트리의 루트 노드(입력)
+ * @param tree 노드가 연결된 AVL Tree(입력, 읽기 전용)
+ * @param release 노드를 해제하는 함수, NULL 이면 트리의 할당자로 해제(입력)
+ * @param userData release 에 전달할 사용자 데이터(입력)
+ * @return 반환값 없음
+ */
+static void JNodeReleaseChilds(JNodePtr node, const JAVLTreePtr tree, void (*release)(JNodePtr node, void *userData), void *userData)
+{
+	if(node == NULL) return;
+
+	JNodeReleaseChilds(node->left, tree, release, userData);
+	JNodeReleaseChilds(node->right, tree, release, userData);
+
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = NULL;
+	if(release != NULL) release(node, userData);
+	else JAVLTreeFree(tree, node);
+}
+
+/**
+ * @fn static JNodePtr JNodeGetNextNode(const JNodePtr node)
+ * @brief 중위 순회 순서에서 지정한 노드의 다음 노드를 찾는 함수 (삭제 표시된 노드 포함)
+ * @param node 기준 노드의 주소(입력, 읽기 전용)
+ * @return 성공 시 다음 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeGetNextNode(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr currentNode = node;
+	if(currentNode->right != NULL)
+	{
+		currentNode = currentNode->right;
+		while(currentNode->left != NULL) currentNode = currentNode->left;
+		return currentNode;
+	}
+
+	while(currentNode->parent != NULL && currentNode->parent->right == currentNode) currentNode = currentNode->parent;
+	return currentNode->parent;
+}
+
+/**
+ * @fn static JNodePtr JNodeGetPrevNode(const JNodePtr node)
+ * @brief 중위 순회 순서에서 지정한 노드의 이전 노드를 찾는 함수 (삭제 표시된 노드 포함)
+ * @param node 기준 노드의 주소(입력, 읽기 전용)
+ * @return 성공 시 이전 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeGetPrevNode(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr currentNode = node;
+	if(currentNode->left != NULL)
+	{
+		currentNode = currentNode->left;
+		while(currentNode->right != NULL) currentNode = currentNode->right;
+		return currentNode;
+	}
+
+	while(currentNode->parent != NULL && currentNode->parent->left == currentNode) currentNode = currentNode->parent;
+	return currentNode->parent;
+}
+
+/**
+ * @fn static JNodePtr JNodeBuildBalanced(JNodePtrContainer nodes, int count, JNodePtr parentNode)
+ * @brief 정렬된 노드 배열로 높이 균형이 완전한 하위 트리를 만드는 함수(재귀)
+ * 가운데 노드를 루트로 하고 양쪽 절반으로 자식 하위 트리를 만들므로 O(n) 이다.
+ * @param nodes 키 순서로 정렬된 노드 배열(입력)
+ * @param count 노드 개수(입력)
+ * @param parentNode 만들어진 하위 트리의 부모 노드(입력)
+ * @return 만들어진 하위 트리의 루트 노드, 노드가 없으면 NULL 반환
+ */
+static JNodePtr JNodeBuildBalanced(JNodePtrContainer nodes, int count, JNodePtr parentNode)
+{
+	if(count <= 0) return NULL;
+
+	int middle = count / 2;
+	JNodePtr rootNode = nodes[middle];
+	rootNode->parent = parentNode;
+	rootNode->left = JNodeBuildBalanced(nodes, middle, rootNode);
+	rootNode->right = JNodeBuildBalanced(nodes + middle + 1, count - middle - 1, rootNode);
+	JNodeUpdateHeight(rootNode);
+	return rootNode;
+}
+
+/**
+ * @fn static void JNodeColorBalanced(JNodePtr node, int depth, int redDepth)
+ * @brief JNodeBuildBalanced 로 만든 하위 트리를 Red-Black 조건에 맞게 칠하는 함수(재귀)
+ * 가운데 노드로 나눈 트리는 빈 자식의 깊이가 두 가지뿐이므로, 더 깊은 레벨의 노드만 빨간색으로 칠한다.
+ * @param node 칠할 하위 트리의 루트 노드(출력)
+ * @param depth 노드의 깊이, 루트는 0(입력)
+ * @param redDepth 빨간색으로 칠할 깊이(입력)
+ * @return 반환값 없음
+ */
+static void JNodeColorBalanced(JNodePtr node, int depth, int redDepth)
+{
+	if(node == NULL) return;
+
+	node->height = (depth == redDepth) ? JAVLTREE_RB_RED : JAVLTREE_RB_BLACK;
+	JNodeColorBalanced(node->left, depth + 1, redDepth);
+	JNodeColorBalanced(node->right, depth + 1, redDepth);
+}
+
+/**
+ * @fn static int JNodeIsRed(const JNodePtr node)
+ * @brief Red-Black 균형 정책에서 노드가 빨간색인지 검사하는 함수 (없는 노드는 검은색)
+ * @param node 검사할 노드(입력, 읽기 전용)
+ * @return 빨간색이면 1, 아니면 0 반환
+ */
+static int JNodeIsRed(const JNodePtr node)
+{
+	return (node != NULL && node->height == JAVLTREE_RB_RED);
+}
+
+/**
+ * @fn static int JNodeGetDepth(const JNodePtr node)
+ * @brief 하위 트리의 레벨 수를 세는 함수(재귀)
+ * 균형 정책마다 height 필드의 의미(높이, 랭크, 색)가 다르므로 직접 센다.
+ * @param node 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @return 레벨 수, 노드가 없으면 0 반환
+ */
+static int JNodeGetDepth(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+
+	int leftDepth = JNodeGetDepth(node->left);
+	int rightDepth = JNodeGetDepth(node->right);
+	return ((leftDepth > rightDepth) ? leftDepth : rightDepth) + 1;
+}
+
+/**
+ * @fn static int JNodeLayoutVEB(JNodePtr node, int height, JNodePtrContainer nodes, int count)
+ * @brief 하위 트리의 위쪽 height 레벨을 van Emde Boas 순서로 배열에 채우는 함수(재귀)
+ * 위쪽 절반 레벨을 먼저 같은 방법으로 채우고, 그 아래에 매달린 하위 트리들을 왼쪽부터 차례로 채운다.
+ * JNODE_FLAG_EXTERNAL 노드는 순서를 정할 때만 지나가고 배열에 넣지 않는다.
+ * @param node 하위 트리의 루트 노드(입력)
+ * @param height 채울 레벨 수(입력)
+ * @param nodes 노드를 채울 배열(출력)
+ * @param count 배열에 이미 채운 노드 개수(입력)
+ * @return 채운 뒤의 노드 개수
+ */
+static int JNodeLayoutVEB(JNodePtr node, int height, JNodePtrContainer nodes, int count)
+{
+	if(node == NULL || height <= 0) return count;
+
+	if(height == 1)
+	{
+		if((node->flags & JNODE_FLAG_EXTERNAL) == 0) nodes[count++] = node;
+		return count;
+	}
+
+	int bottomHeight = height / 2;
+	int topHeight = height - bottomHeight;
+	count = JNodeLayoutVEB(node, topHeight, nodes, count);
+	return JNodeLayoutVEBBottom(node, 0, topHeight, bottomHeight, nodes, count);
+}
+
+/**
+ * @fn static int JNodeLayoutVEBBottom(JNodePtr node, int depth, int topHeight, int bottomHeight, JNodePtrContainer nodes, int count)
+ * @brief 위쪽 topHeight 레벨 아래에 매달린 하위 트리들을 왼쪽부터 van Emde Boas 순서로 채우는 함수(재귀)
+ * @param node 현재 노드(입력)
+ * @param depth 위쪽 트리의 루트로부터 현재 노드의 깊이(입력)
+ * @param topHeight 위쪽 트리의 레벨 수(입력)
+ * @param bottomHeight 아래쪽 하위 트리의 레벨 수(입력)
+ * @param nodes 노드를 채울 배열(출력)
+ * @param count 배열에 이미 채운 노드 개수(입력)
+ * @return 채운 뒤의 노드 개수
+ */
+static int JNodeLayoutVEBBottom(JNodePtr node, int depth, int topHeight, int bottomHeight, JNodePtrContainer nodes, int count)
+{
+	if(node == NULL) return count;
+	if(depth == topHeight) return JNodeLayoutVEB(node, bottomHeight, nodes, count);
+
+	count = JNodeLayoutVEBBottom(node->left, depth + 1, topHeight, bottomHeight, nodes, count);
+	return JNodeLayoutVEBBottom(node->right, depth + 1, topHeight, bottomHeight, nodes, count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JAVLTree Static Function
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JAVLTreeRebalance(JAVLTreePtr tree, JNodePtr node)
+ * @brief 지정한 노드부터 루트 노드까지 올라가며 높이를 갱신하고 균형을 맞추는 함수
+ * 하위 트리의 높이가 바뀌지 않으면 상위 노드들은 영향을 받지 않으므로 중간에 멈춘다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 삽입 또는 삭제로 자식 노드가 바뀐 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeRebalance(JAVLTreePtr tree, JNodePtr node)
+{
+	if(tree == NULL) return;
+
+	while(node != NULL)
+	{
+		JNodePtr parentNode = node->parent;
+		JNodePtr leftNode = node->left;
+		JNodePtr rightNode = node->right;
+		int oldHeight = node->height;
+
+		JNodePtr subRootNode = JNodeRebalance(node);
+		if(subRootNode != node)
+		{
+			tree->rotationCount += (subRootNode == leftNode || subRootNode == rightNode) ? 1 : 2;
+			JAVLTreeReplaceChild(tree, parentNode, node, subRootNode);
+			JAVLTreeUpdateAggregate(tree, subRootNode->left);
+			JAVLTreeUpdateAggregate(tree, subRootNode->right);
+		}
+		JAVLTreeUpdateAggregate(tree, subRootNode);
+
+		if(subRootNode->height == oldHeight)
+		{
+			// 높이가 그대로여도 상위 노드들의 집계 값은 바뀌므로 루트까지 다시 계산한다.
+			JAVLTreeUpdateAggregatePath(tree, parentNode);
+			break;
+		}
+
+		node = parentNode;
+	}
+}
+
+/**
+ * @fn static void JAVLTreeReplaceChild(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr oldNode, JNodePtr newNode)
+ * @brief 부모 노드의 자식 연결을 다른 노드로 바꾸는 함수
+ * 부모 노드가 없으면 AVL Tree 의 루트 노드를 바꾼다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param parentNode 자식 연결을 바꿀 부모 노드(출력)
+ * @param oldNode 기존 자식 노드(입력)
+ * @param newNode 새로운 자식 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeReplaceChild(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr oldNode, JNodePtr newNode)
+{
+	if(parentNode == NULL) tree->root = newNode;
+	else if(parentNode->left == oldNode) parentNode->left = newNode;
+	else parentNode->right = newNode;
+
+	if(newNode != NULL) newNode->parent = parentNode;
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeRotate(JAVLTreePtr tree, JNodePtr node, int toLeft)
+ * @brief 균형 정보(높이, 랭크, 색)를 바꾸지 않고 지정한 노드를 기준으로 한 번 회전하는 함수
+ * WAVL, Red-Black 균형 정책에서 사용하며, 균형 정보는 호출한 쪽에서 고친다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 회전하기 위한 기준 노드(입력)
+ * @param toLeft 1 이면 오른쪽 자식을, 0 이면 왼쪽 자식을 기준 노드 자리로 올림(입력)
+ * @return 기준 노드 자리로 올라간 노드
+ */
+static JNodePtr JAVLTreeRotate(JAVLTreePtr tree, JNodePtr node, int toLeft)
+{
+	JNodePtr parentNode = node->parent;
+	JNodePtr childNode = NULL;
+
+	if(toLeft == 1)
+	{
+		childNode = node->right;
+		node->right = childNode->left;
+		if(childNode->left != NULL) childNode->left->parent = node;
+		childNode->left = node;
+	}
+	else
+	{
+		childNode = node->left;
+		node->left = childNode->right;
+		if(childNode->right != NULL) childNode->right->parent = node;
+		childNode->right = node;
+	}
+
+	node->parent = childNode;
+	JAVLTreeReplaceChild(tree, parentNode, node, childNode);
+	JAVLTreeUpdateAggregate(tree, node);
+	JAVLTreeUpdateAggregate(tree, childNode);
+	tree->rotationCount++;
+	return childNode;
+}
+
+/**
+ * @fn static void JAVLTreeFixInsert(JAVLTreePtr tree, JNodePtr node)
+ * @brief 새로 연결된 노드부터 균형 정책에 맞게 균형을 맞추는 함수
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 새로 연결된 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeFixInsert(JAVLTreePtr tree, JNodePtr node)
+{
+	switch(tree->balance)
+	{
+		case BalanceWAVL:
+			JAVLTreeWAVLFixInsert(tree, node);
+			break;
+		case BalanceRedBlack:
+			JAVLTreeRedBlackFixInsert(tree, node);
+			break;
+		default:
+			if(tree->relaxed == 1)
+			{
+				JAVLTreeMarkUnbalanced(tree, node->parent);
+				break;
+			}
+			JAVLTreeRebalance(tree, node->parent);
+			return;
+	}
+	JAVLTreeUpdateAggregatePath(tree, node->parent);
+	if(tree->relaxed == 1 && tree->relaxStepBudget > 0) JAVLTreeRebalanceStep(tree, tree->relaxStepBudget);
+}
+
+/**
+ * @fn static void JAVLTreeFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node, int removedHeight)
+ * @brief 노드가 빠진 자리부터 균형 정책에 맞게 균형을 맞추는 함수
+ * @param tree AVL Tree 의 주소(출력)
+ * @param parentNode 빠진 자리의 부모 노드, 루트 자리였으면 NULL(입력)
+ * @param node 빠진 자리를 대신한 노드, 없으면 NULL(입력)
+ * @param removedHeight 빠진 자리에 있던 노드의 균형 정보(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node, int removedHeight)
+{
+	switch(tree->balance)
+	{
+		case BalanceWAVL:
+			JAVLTreeWAVLFixDelete(tree, parentNode, node);
+			break;
+		case BalanceRedBlack:
+			// 빨간 노드가 빠지면 검은 노드 수가 그대로이다.
+			if(removedHeight == JAVLTREE_RB_BLACK) JAVLTreeRedBlackFixDelete(tree, parentNode, node);
+			break;
+		default:
+			if(tree->relaxed == 1)
+			{
+				JAVLTreeMarkUnbalanced(tree, parentNode);
+				break;
+			}
+			JAVLTreeRebalance(tree, parentNode);
+			return;
+	}
+	JAVLTreeUpdateAggregatePath(tree, parentNode);
+	if(tree->relaxed == 1 && tree->relaxStepBudget > 0) JAVLTreeRebalanceStep(tree, tree->relaxStepBudget);
+}
+
+/**
+ * @fn static void JAVLTreeWAVLFixInsert(JAVLTreePtr tree, JNodePtr node)
+ * @brief WAVL 균형 정책에서 새로 연결된 노드부터 올라가며 랭크 조건을 맞추는 함수
+ * 랭크 차이가 0 인 자식이 생기면 부모를 올리고(promote), 형제의 랭크 차이가 2 이면 회전하고 멈춘다.
+ * 없는 노드의 랭크는 0, 새 노드의 랭크는 1 이다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 새로 연결된 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeWAVLFixInsert(JAVLTreePtr tree, JNodePtr node)
+{
+	JNodePtr parentNode = node->parent;
+
+	while(parentNode != NULL && parentNode->height == node->height)
+	{
+		int isLeft = (parentNode->left == node);
+		JNodePtr siblingNode = isLeft ? parentNode->right : parentNode->left;
+
+		if(parentNode->height - JNodeGetHeight(siblingNode) == 1)
+		{
+			parentNode->height++;
+			node = parentNode;
+			parentNode = node->parent;
+			continue;
+		}
+
+		JNodePtr innerNode = isLeft ? node->right : node->left;
+		if(node->height - JNodeGetHeight(innerNode) == 2)
+		{
+			JAVLTreeRotate(tree, parentNode, !isLeft);
+			parentNode->height--;
+		}
+		else
+		{
+			JAVLTreeRotate(tree, node, isLeft);
+			JAVLTreeRotate(tree, parentNode, !isLeft);
+			innerNode->height++;
+			node->height--;
+			parentNode->height--;
+		}
+		break;
+	}
+}
+
+/**
+ * @fn static void JAVLTreeWAVLFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node)
+ * @brief WAVL 균형 정책에서 노드가 빠진 자리부터 올라가며 랭크 조건을 맞추는 함수
+ * 랭크 차이가 3 인 자식이 생기면 부모를 내리고(demote) 올라가며, 회전이 필요하면 최대 2 번 회전하고 멈춘다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param parentNode 빠진 자리의 부모 노드(입력)
+ * @param node 빠진 자리를 대신한 노드, 없으면 NULL(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeWAVLFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node)
+{
+	if(parentNode == NULL) return;
+
+	// 자식이 없어진 노드는 랭크가 1 이어야 한다.
+	if(parentNode->left == NULL && parentNode->right == NULL)
+	{
+		if(parentNode->height == 1) return;
+		parentNode->height = 1;
+		node = parentNode;
+		parentNode = node->parent;
+	}
+
+	while(parentNode != NULL && parentNode->height - JNodeGetHeight(node) == 3)
+	{
+		int isLeft = (parentNode->left == node);
+		JNodePtr siblingNode = isLeft ? parentNode->right : parentNode->left;
+
+		if(parentNode->height - siblingNode->height == 2)
+		{
+			parentNode->height--;
+		}
+		else if(siblingNode->height - JNodeGetHeight(siblingNode->left) == 2 && siblingNode->height - JNodeGetHeight(siblingNode->right) == 2)
+		{
+			parentNode->height--;
+			siblingNode->height--;
+		}
+		else
+		{
+			JNodePtr outerNode = isLeft ? siblingNode->right : siblingNode->left;
+			JNodePtr innerNode = isLeft ? siblingNode->left : siblingNode->right;
+
+			if(siblingNode->height - JNodeGetHeight(outerNode) == 1)
+			{
+				JAVLTreeRotate(tree, parentNode, isLeft);
+				siblingNode->height++;
+				parentNode->height--;
+				if(parentNode->left == NULL && parentNode->right == NULL) parentNode->height--;
+			}
+			else
+			{
+				JAVLTreeRotate(tree, siblingNode, !isLeft);
+				JAVLTreeRotate(tree, parentNode, isLeft);
+				innerNode->height += 2;
+				siblingNode->height--;
+				parentNode->height -= 2;
+			}
+			break;
+		}
+
+		node = parentNode;
+		parentNode = node->parent;
+	}
+}
+
+/**
+ * @fn static void JAVLTreeRedBlackFixInsert(JAVLTreePtr tree, JNodePtr node)
+ * @brief Red-Black 균형 정책에서 새로 연결된 빨간 노드부터 올라가며 색 조건을 맞추는 함수
+ * 삼촌 노드가 빨간색이면 색만 바꾸고 올라가며, 아니면 최대 2 번 회전하고 멈춘다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 새로 연결된 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeRedBlackFixInsert(JAVLTreePtr tree, JNodePtr node)
+{
+	node->height = JAVLTREE_RB_RED;
+
+	while(JNodeIsRed(node->parent))
+	{
+		// 빨간 노드는 루트가 아니므로 조부모 노드가 있다.
+		JNodePtr parentNode = node->parent;
+		JNodePtr grandNode = parentNode->parent;
+		int isLeft = (grandNode->left == parentNode);
+		JNodePtr uncleNode = isLeft ? grandNode->right : grandNode->left;
+
+		if(JNodeIsRed(uncleNode))
+		{
+			parentNode->height = JAVLTREE_RB_BLACK;
+			uncleNode->height = JAVLTREE_RB_BLACK;
+			grandNode->height = JAVLTREE_RB_RED;
+			node = grandNode;
+			continue;
+		}
+
+		if(node == (isLeft ? parentNode->right : parentNode->left))
+		{
+			JAVLTreeRotate(tree, parentNode, isLeft);
+			parentNode = node;
+		}
+		parentNode->height = JAVLTREE_RB_BLACK;
+		grandNode->height = JAVLTREE_RB_RED;
+		JAVLTreeRotate(tree, grandNode, !isLeft);
+		break;
+	}
+
+	tree->root->height = JAVLTREE_RB_BLACK;
+}
+
+/**
+ * @fn static void JAVLTreeRedBlackFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node)
+ * @brief Red-Black 균형 정책에서 검은 노드가 빠진 자리부터 올라가며 색 조건을 맞추는 함수
+ * 형제 노드 쪽에 빨간 노드가 있으면 최대 3 번 회전하고 멈추고, 없으면 형제를 빨간색으로 바꾸고 올라간다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param parentNode 빠진 자리의 부모 노드, 루트 자리였으면 NULL(입력)
+ * @param node 빠진 자리를 대신한 노드, 없으면 NULL(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeRedBlackFixDelete(JAVLTreePtr tree, JNodePtr parentNode, JNodePtr node)
+{
+	while(parentNode != NULL && JNodeIsRed(node) == 0)
+	{
+		// 검은 노드가 빠졌으므로 형제 노드는 항상 있다.
+		int isLeft = (parentNode->left == node);
+		JNodePtr siblingNode = isLeft ? parentNode->right : parentNode->left;
+
+		if(JNodeIsRed(siblingNode))
+		{
+			siblingNode->height = JAVLTREE_RB_BLACK;
+			parentNode->height = JAVLTREE_RB_RED;
+			JAVLTreeRotate(tree, parentNode, isLeft);
+			siblingNode = isLeft ? parentNode->right : parentNode->left;
+		}
+
+		JNodePtr outerNode = isLeft ? siblingNode->right : siblingNode->left;
+		JNodePtr innerNode = isLeft ? siblingNode->left : siblingNode->right;
+		if(JNodeIsRed(outerNode) == 0 && JNodeIsRed(innerNode) == 0)
+		{
+			siblingNode->height = JAVLTREE_RB_RED;
+			node = parentNode;
+			parentNode = node->parent;
+			continue;
+		}
+
+		if(JNodeIsRed(outerNode) == 0)
+		{
+			innerNode->height = JAVLTREE_RB_BLACK;
+			siblingNode->height = JAVLTREE_RB_RED;
+			JAVLTreeRotate(tree, siblingNode, !isLeft);
+			outerNode = siblingNode;
+			siblingNode = innerNode;
+		}
+
+		siblingNode->height = parentNode->height;
+		parentNode->height = JAVLTREE_RB_BLACK;
+		outerNode->height = JAVLTREE_RB_BLACK;
+		JAVLTreeRotate(tree, parentNode, isLeft);
+		node = tree->root;
+		break;
+	}
+
+	if(node != NULL) node->height = JAVLTREE_RB_BLACK;
+}
+
+/**
+ * @fn static void JAVLTreeMarkUnbalanced(JAVLTreePtr tree, JNodePtr node)
+ * @brief 완화 균형 모드에서 지정한 노드부터 올라가며 높이를 갱신하고 균형이 깨진 경로를 표시하는 함수
+ * 높이 차이가 2 이상이거나 표시된 자식이 있는 노드를 표시하므로, 표시되지 않은 노드의 하위 트리는 항상 AVL 조건을 만족한다.
+ * 높이가 그대로이고 새로 표시하지 않았으면 상위 노드들은 영향을 받지 않으므로 중간에 멈춘다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 삽입 또는 삭제로 자식 노드가 바뀐 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeMarkUnbalanced(JAVLTreePtr tree, JNodePtr node)
+{
+	if(tree == NULL) return;
+
+	for(; node != NULL; node = node->parent)
+	{
+		int oldHeight = node->height;
+		int oldFlags = node->flags;
+		int heightDiff = 0;
+
+		JNodeUpdateHeight(node);
+		heightDiff = JNodeGetHeightDiff(node);
+		if(heightDiff > 1 || heightDiff < -1
+			|| (node->left != NULL && (node->left->flags & JNODE_FLAG_UNBALANCED))
+			|| (node->right != NULL && (node->right->flags & JNODE_FLAG_UNBALANCED)))
+		{
+			node->flags |= JNODE_FLAG_UNBALANCED;
+		}
+
+		if(node->height == oldHeight && node->flags == oldFlags) break;
+	}
+}
+
+/**
+ * @fn static int JAVLTreeFixUnbalanced(JAVLTreePtr tree, JNodePtr node)
+ * @brief 두 하위 트리가 AVL 조건을 만족하는 표시된 노드의 균형을 맞추고 표시를 지우는 함수
+ * 높이 차이가 2 이상이면 노드를 떼어서 높은 쪽 하위 트리의 가장자리를 따라 낮은 쪽 하위 트리와 높이가 비슷한 곳까지 내려가
+ * 낮은 쪽 하위 트리와 함께 다시 붙이고, 붙인 곳부터 원래 자리까지 올라가며 균형을 맞춘다. (AVL join)
+ * 하위 트리의 키 집합은 그대로이므로 상위 노드들은 높이만 다시 계산한다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 균형을 맞출 표시된 노드(입력)
+ * @return 수행한 작업량 (방문한 노드 수와 회전 수의 합)
+ */
+static int JAVLTreeFixUnbalanced(JAVLTreePtr tree, JNodePtr node)
+{
+	JNodePtr parentNode = node->parent;
+	JNodePtr subRootNode = node;
+	int heightDiff = JNodeGetHeightDiff(node);
+	int work = 1;
+
+	node->flags &= ~JNODE_FLAG_UNBALANCED;
+	if(heightDiff > 1 || heightDiff < -1)
+	{
+		int toRight = (heightDiff > 1) ? 1 : 0;
+		JNodePtr tallNode = (toRight == 1) ? node->left : node->right;
+		JNodePtr shortNode = (toRight == 1) ? node->right : node->left;
+		int shortHeight = JNodeGetHeight(shortNode);
+		JNodePtr edgeParentNode = tallNode;
+		JNodePtr edgeNode = (toRight == 1) ? tallNode->right : tallNode->left;
+
+		// 높은 쪽 하위 트리를 노드 자리로 올리고, 가장자리를 따라 낮은 쪽과 높이 차이가 1 이하인 곳을 찾는다.
+		JAVLTreeReplaceChild(tree, parentNode, node, tallNode);
+		for(; JNodeGetHeight(edgeNode) > shortHeight + 1; work++)
+		{
+			edgeParentNode = edgeNode;
+			edgeNode = (toRight == 1) ? edgeNode->right : edgeNode->left;
+		}
+
+		if(toRight == 1)
+		{
+			node->left = edgeNode;
+			edgeParentNode->right = node;
+		}
+		else
+		{
+			node->right = edgeNode;
+			edgeParentNode->left = node;
+		}
+		if(edgeNode != NULL) edgeNode->parent = node;
+		node->parent = edgeParentNode;
+		JNodeUpdateHeight(node);
+		JAVLTreeUpdateAggregate(tree, node);
+
+		// 붙인 곳부터 원래 자리까지는 키가 늘었으므로 높이가 그대로여도 끝까지 올라간다.
+		JNodePtr currentNode = edgeParentNode;
+		while(currentNode != parentNode)
+		{
+			JNodePtr upperNode = currentNode->parent;
+			JNodePtr leftNode = currentNode->left;
+			JNodePtr rightNode = currentNode->right;
+
+			subRootNode = JNodeRebalance(currentNode);
+			if(subRootNode != currentNode)
+			{
+				int rotationCount = (subRootNode == leftNode || subRootNode == rightNode) ? 1 : 2;
+				tree->rotationCount += (unsigned long long)rotationCount;
+				work += rotationCount;
+				JAVLTreeReplaceChild(tree, upperNode, currentNode, subRootNode);
+				JAVLTreeUpdateAggregate(tree, subRootNode->left);
+				JAVLTreeUpdateAggregate(tree, subRootNode->right);
+			}
+			JAVLTreeUpdateAggregate(tree, subRootNode);
+			currentNode = upperNode;
+			work++;
+		}
+	}
+
+	for(; parentNode != NULL; parentNode = parentNode->parent, work++)
+	{
+		int oldHeight = parentNode->height;
+		JNodeUpdateHeight(parentNode);
+		if(parentNode->height == oldHeight) break;
+	}
+
+	return work;
+}
+
+/**
+ * @fn static void JAVLTreeUnlinkNode(JAVLTreePtr tree, JNodePtr node)
+ * @brief AVL Tree 에서 지정한 노드를 떼어내고 균형을 맞추는 함수
+ * 노드의 메모리는 해제하지 않으며, 키를 옮기지 않고 노드 자체를 옮겨서 다른 노드의 주소가 유지되도록 한다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param node 떼어낼 노드(입력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeUnlinkNode(JAVLTreePtr tree, JNodePtr node)
+{
+	JNodePtr rebalanceNode = NULL;
+	JNodePtr replacedNode = NULL;
+	int removedHeight = node->height;
+
+	if(tree->min == node) tree->min = JNodeGetNextNode(node);
+	if(tree->max == node) tree->max = JNodeGetPrevNode(node);
+	if(tree->finger == node) tree->finger = node->parent;
+	if(tree->relaxCursor == node) tree->relaxCursor = node->parent;
+	if(tree->compactCursor == node) tree->compactCursor = JNodeGetNextNode(node);
+	if(node->flags & JNODE_FLAG_TOMBSTONE) tree->tombstoneCount--;
+	if(node->flags & JNODE_FLAG_EXTERNAL) tree->externalCount--;
+	tree->nodeCount--;
+
+	// 자식 노드가 하나 이하인 경우
+	if((node->left == NULL) || (node->right == NULL))
+	{
+		JNodePtr childNode = (node->left != NULL) ? node->left : node->right;
+		rebalanceNode = node->parent;
+		replacedNode = childNode;
+		JAVLTreeReplaceChild(tree, node->parent, node, childNode);
+	}
+	// 자식 노드가 두 개 다 있는 경우, 오른쪽 하위 트리의 최소 노드로 대체
+	else
+	{
+		JNodePtr successorNode = node->right;
+		while(successorNode->left != NULL) successorNode = successorNode->left;
+
+		// 실제로 빠지는 자리는 후속 노드의 원래 자리이다.
+		removedHeight = successorNode->height;
+		replacedNode = successorNode->right;
+		if(successorNode->parent != node)
+		{
+			rebalanceNode = successorNode->parent;
+			JAVLTreeReplaceChild(tree, successorNode->parent, successorNode, successorNode->right);
+			successorNode->right = node->right;
+			successorNode->right->parent = successorNode;
+		}
+		else rebalanceNode = successorNode;
+
+		successorNode->left = node->left;
+		successorNode->left->parent = successorNode;
+		successorNode->height = node->height;
+		successorNode->flags = (successorNode->flags & ~JNODE_FLAG_UNBALANCED) | (node->flags & JNODE_FLAG_UNBALANCED);
+		JAVLTreeReplaceChild(tree, node->parent, node, successorNode);
+	}
+
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = NULL;
+
+	JAVLTreeFixDelete(tree, rebalanceNode, replacedNode, removedHeight);
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeInsertFrom(JAVLTreePtr tree, JNodePtr startNode, void *key, int *isRevived, JNodePtr newNode)
+ * @brief 지정한 노드부터 내려가며 새로운 키의 위치를 찾아 노드를 추가하고 균형을 맞추는 함수
+ * 새로운 키는 시작 노드를 루트로 하는 하위 트리의 키 범위 안에 있어야 한다.
+ * 같은 키를 가진 노드가 삭제 표시되어 있으면 새 노드를 만들지 않고 그 노드를 반환한다.
+ * (되살리는 것은 JAVLTreeCommitInsert 에서 로그 기록 이후에 한다)
+ * KeyOwnerTree 트리는 위치를 찾은 뒤에 키를 복사하므로 중복 키는 복사하지 않는다.
+ * @param tree AVL Tree 의 주소(출력)
+ * @param startNode 탐색을 시작할 노드, NULL 이면 빈 트리로 간주(입력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @param isRevived 삭제 표시된 노드를 찾았으면 1, 새 노드를 추가했으면 0 저장(출력)
+ * @param newNode 연결할 노드, NULL 이면 새로 할당(입력)
+ * @return 성공 시 추가된 노드(또는 삭제 표시된 노드)의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JAVLTreeInsertFrom(JAVLTreePtr tree, JNodePtr startNode, void *key, int *isRevived, JNodePtr newNode)
+{
+	JNodePtr parentNode = NULL;
+	JNodePtr currentNode = startNode;
+	int compareResult = 0;
+
+	*isRevived = 0;
+	if(tree->type == CustomType && tree->compare == NULL) return NULL;
+	while(currentNode != NULL)
+	{
+		compareResult = JAVLTreeCompareKey(tree, currentNode->key, key);
+		if(compareResult == 0)
+		{
+			if((currentNode->flags & JNODE_FLAG_TOMBSTONE) == 0) return NULL;
+
+			*isRevived = 1;
+			return currentNode;
+		}
+
+		parentNode = currentNode;
+		if(compareResult > 0) currentNode = currentNode->left;
+		else currentNode = currentNode->right;
+	}
+
+	if(newNode == NULL)
+	{
+		newNode = JAVLTreeNewNode(tree);
+		if(newNode != NULL && tree->keyOwner == KeyOwnerTree) key = JAVLTreeOwnKey(tree, newNode, key);
+		if(JNodeSetKey(newNode, key) == NULL)
+		{
+			JAVLTreeFree(tree, newNode);
+			return NULL;
+		}
+	}
+	else
+	{
+		newNode->left = NULL;
+		newNode->right = NULL;
+		newNode->height = 1;
+		newNode->flags = 0;
+	}
+
+	newNode->parent = parentNode;
+	if(parentNode != NULL)
+	{
+		if(compareResult > 0) parentNode->left = newNode;
+		else parentNode->right = newNode;
+	}
+	else tree->root = newNode;
+
+	// 최소, 최대 노드는 그 노드의 바깥쪽 자식으로 추가될 때만 바뀐다.
+	if(tree->min == NULL || (tree->min == parentNode && parentNode->left == newNode)) tree->min = newNode;
+	if(tree->max == NULL || (tree->max == parentNode && parentNode->right == newNode)) tree->max = newNode;
+	tree->finger = newNode;
+	tree->nodeCount++;
+
+	JAVLTreeUpdateAggregate(tree, newNode);
+	JAVLTreeFixInsert(tree, newNode);
+	return newNode;
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeClimbFromHint(const JAVLTreePtr tree, JNodePtr hint, void *key)
+ * @brief 힌트 노드에서 부모 노드 방향으로 올라가며 새로운 키를 포함하는 가장 낮은 하위 트리를 찾는 함수
+ * 키가 힌트보다 크면, 하위 트리의 상한은 왼쪽 자식으로 처음 올라가는 부모 노드의 키이다.
+ * 새로운 키가 상한보다 작으면 그 하위 트리에서 내려가고, 아니면 상한 노드로 올라가서 반복한다. (작을 때는 반대)
+ * 트리의 최소, 최대 키 바깥의 키는 최소, 최대 노드에서 바로 내려간다.
+ * @param tree AVL Tree 의 주소(입력, 읽기 전용)
+ * @param hint 올라가기 시작할 노드(입력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @return 탐색을 시작할 노드의 주소 (같은 키를 가진 노드를 만나면 그 노드)
+ */
+static JNodePtr JAVLTreeClimbFromHint(const JAVLTreePtr tree, JNodePtr hint, void *key)
+{
+	int direction = JAVLTreeCompareKey(tree, key, hint->key);
+	if(direction == 0) return hint;
+
+	if(direction > 0 && JAVLTreeCompareKey(tree, key, tree->max->key) > 0) return tree->max;
+	if(direction < 0 && JAVLTreeCompareKey(tree, key, tree->min->key) < 0) return tree->min;
+
+	JNodePtr currentNode = hint;
+	while(1)
+	{
+		// 같은 방향의 자식으로 올라가는 동안은 하위 트리의 경계가 바뀌지 않는다.
+		JNodePtr boundNode = currentNode;
+		while(boundNode->parent != NULL && ((boundNode->parent->left == boundNode) != (direction > 0))) boundNode = boundNode->parent;
+		if(boundNode->parent == NULL) return currentNode;
+
+		int compareResult = JAVLTreeCompareKey(tree, key, boundNode->parent->key);
+		if(compareResult == 0) return boundNode->parent;
+		if((compareResult < 0) == (direction > 0)) return currentNode;
+
+		currentNode = boundNode->parent;
+	}
+}
+
+/**
+ * @fn static int JAVLTreeFindGroup(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results)
+ * @brief 최대 JAVLTREE_BATCH_GROUP_SIZE 개의 키를 번갈아 가며 한 단계씩 찾는 함수
+ * 한 단계는 두 번에 나눠 진행한다. 먼저 모든 키의 현재 노드에서 키 주소를 읽어 미리 가져오고,
+ * 다음으로 키를 비교해서 자식 노드로 이동한 뒤 그 노드를 미리 가져온다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param keys 찾을 키들의 주소 배열(입력)
+ * @param count 찾을 키 개수(입력)
+ * @param results 키마다 찾은 노드의 주소를 저장할 배열(출력)
+ * @return 찾은 키 개수
+ */
+static int JAVLTreeFindGroup(const JAVLTreePtr tree, void **keys, int count, JNodePtrContainer results)
+{
+	JNodePtr currentNodes[JAVLTREE_BATCH_GROUP_SIZE];
+	int activeCount = 0;
+	int foundCount = 0;
+	int index = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		results[index] = NULL;
+		currentNodes[index] = (keys[index] != NULL) ? tree->root : NULL;
+		if(currentNodes[index] != NULL && tree->bloom != NULL && JBloomFilterMayContain(tree->bloom, keys[index]) == FindFail)
+		{
+			currentNodes[index] = NULL;
+		}
+		if(currentNodes[index] != NULL) activeCount++;
+	}
+
+	while(activeCount > 0)
+	{
+		for(index = 0; index < count; index++)
+		{
+			if(currentNodes[index] != NULL) JAVLTREE_PREFETCH(currentNodes[index]->key);
+		}
+
+		for(index = 0; index < count; index++)
+		{
+			JNodePtr currentNode = currentNodes[index];
+			if(currentNode == NULL) continue;
+
+			int compareResult = JAVLTreeCompareKey(tree, currentNode->key, keys[index]);
+			if(compareResult == 0)
+			{
+				results[index] = currentNode;
+				currentNode = NULL;
+			}
+			else if(compareResult > 0) currentNode = currentNode->left;
+			else currentNode = currentNode->right;
+
+			if(currentNode != NULL) JAVLTREE_PREFETCH(currentNode);
+			else
+			{
+				results[index] = JAVLTreeCheckFound(tree, results[index]);
+				if(results[index] != NULL) foundCount++;
+				activeCount--;
+			}
+			currentNodes[index] = currentNode;
+		}
+	}
+
+	return foundCount;
+}
+
+/**
+ * @fn static int JAVLTreeLogOperation(JAVLTreePtr tree, WALOperation operation, const void *key)
+ * @brief AVL Tree 에 연결된 변경 기록 로그에 노드 추가, 삭제 기록을 추가하는 함수
+ * 기록이 로그에 남지 않은 경우(WALFail)에만 실패로 보고 호출한 쪽에서 변경을 되돌린다.
+ * 디스크에 남았는지 알 수 없는 경우(WALNotDurable)는 복구 시 적용될 수 있으므로 변경을 유지하며,
+ * 이때 로그는 실패 상태가 되어 이후의 변경은 모두 실패한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력)
+ * @param operation 기록 종류(입력)
+ * @param key 추가 또는 삭제된 노드의 키 주소(입력, 읽기 전용)
+ * @return 로그가 없거나 변경을 유지해야 하면 1, 기록하지 못했으면 0 반환
+ */
+static int JAVLTreeLogOperation(JAVLTreePtr tree, WALOperation operation, const void *key)
+{
+	if(tree->wal == NULL) return 1;
+	return JWALAppend(tree->wal, operation, key) != WALFail;
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeCommitInsert(JAVLTreePtr tree, JNodePtr node, void *key, int isRevived)
+ * @brief JAVLTreeInsertFrom 의 결과를 로그에 기록하고 확정하는 함수
+ * 로그 기록에 실패하면 추가한 노드를 다시 삭제한다.
+ * 삭제 표시된 노드를 찾은 경우에는 기록에 성공했을 때만 새 키로 되살린다.
+ * (KeyOwnerTree 트리는 노드가 이미 같은 키의 복사본을 가지고 있으므로 그대로 둔다)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node JAVLTreeInsertFrom 이 반환한 노드, NULL 이면 실패(입력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @param isRevived 삭제 표시된 노드를 찾았는지 여부(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JAVLTreeCommitInsert(JAVLTreePtr tree, JNodePtr node, void *key, int isRevived)
+{
+	if(node == NULL) return NULL;
+
+	if(JAVLTreeLogOperation(tree, WALAddNode, key) == 0)
+	{
+		if(isRevived == 0)
+		{
+			JAVLTreeUnlinkNode(tree, node);
+			JAVLTreeFree(tree, node);
+		}
+		return NULL;
+	}
+
+	if(isRevived == 1)
+	{
+		node->flags &= ~JNODE_FLAG_TOMBSTONE;
+		if(tree->keyOwner != KeyOwnerTree) node->key = key;
+		tree->tombstoneCount--;
+		tree->finger = node;
+		JAVLTreeUpdateAggregatePath(tree, node);
+	}
+	JAVLTreeOnInsert(tree, node);
+	return node;
+}
+
+/**
+ * @fn static void JAVLTreeOnInsert(JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드 추가가 확정된 뒤 AVL Tree 에 연결된 보조 구조를 갱신하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 추가된 노드의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JAVLTreeOnInsert(JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree->bloom != NULL) JBloomFilterAdd(tree->bloom, node->key);
+	if(tree->cache != NULL) JLookupCacheInvalidate(tree->cache, node->key);
+	// 해시 색인에 추가하지 못하면 색인을 버리고 트리 검색으로 돌아간다.
+	if(tree->index != NULL && JHashIndexAdd(tree->index, node) == NULL) DeleteJHashIndex(&(tree->index));
+}
+
+/**
+ * @fn static void JAVLTreeOnDelete(JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드 삭제(또는 삭제 표시)가 확정된 뒤 AVL Tree 에 연결된 보조 구조를 갱신하는 함수
+ * 노드를 해제하기 전에 호출해야 한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 삭제될 노드의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JAVLTreeOnDelete(JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree->bloom != NULL) JBloomFilterRemove(tree->bloom, node->key);
+	if(tree->cache != NULL) JLookupCacheInvalidate(tree->cache, node->key);
+	if(tree->index != NULL) JHashIndexRemove(tree->index, node);
+	if(tree->expiry != NULL) JExpiryHeapRemove(tree, node);
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeCheckFound(const JAVLTreePtr tree, JNodePtr node)
+ * @brief 검색 결과에서 삭제 표시된 노드를 걸러내고, 실패한 검색을 Bloom Filter 의 거짓 양성으로 세는 함수
+ * Bloom Filter 를 통과한 검색에만 호출한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력)
+ * @param node 트리에서 찾은 노드, 없으면 NULL(입력)
+ * @return 살아 있는 노드를 찾았으면 그 노드의 주소, 아니면 NULL 반환
+ */
+static JNodePtr JAVLTreeCheckFound(const JAVLTreePtr tree, JNodePtr node)
+{
+	if(node != NULL && (node->flags & JNODE_FLAG_TOMBSTONE)) node = NULL;
+	if(node == NULL && tree->bloom != NULL) tree->bloom->falsePositiveCount++;
+	return node;
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeNewNode(const JAVLTreePtr tree)
+ * @brief AVL Tree 에 추가할 새 노드를 할당하는 함수
+ * 트리의 할당자로 할당하며, 집계 값을 사용하면 노드 뒤에 집계 값 공간을 함께 할당하므로 한 번에 해제된다.
+ * KeyOwnerTree 트리는 맨 뒤에 JAVLTREE_INLINE_KEY_SIZE 바이트의 키 공간을 함께 할당한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 할당된 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JAVLTreeNewNode(const JAVLTreePtr tree)
+{
+	JNodePtr newNode = (JNodePtr)JAVLTreeAlloc(tree, JAVLTreeGetNodeSize(tree));
+	if(newNode == NULL)
+	{
+		return NULL;
 	}
+
+	newNode->left = NULL;
+	newNode->right = NULL;
+	newNode->parent = NULL;
+	newNode->key = NULL;
+	newNode->height = 1;
+	newNode->flags = 0;
+	if(tree->expiry != NULL) *JAVLTreeGetNodeHeapIndex(tree, newNode) = -1;
+
+	return newNode;
 }
 
 /**
- * @fn static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type)
- * @brief 지정한 노드의 키와 전달받은 키를 비교해서 저장할 노드의 위치를 찾아 그 노드의 주소를 반환하는 함수 
- * @param node 위치를 움직일 노드의 주소(입력)
- * @param key 전달받은 키(입력)
- * @param type 키의 데이터 유형(입력)
- * @return 성공 시 위치가 변경된 노드의 주소, 실패 시 NULL 반환
+ * @fn static size_t JAVLTreeGetNodeSize(const JAVLTreePtr tree)
+ * @brief AVL Tree 가 할당하는 노드 하나의 바이트 수를 구하는 함수 (노드 뒤의 집계 값, 힙 위치, 키 공간 포함)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 노드 하나의 바이트 수
  */
-static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type)
+static size_t JAVLTreeGetNodeSize(const JAVLTreePtr tree)
 {
-	switch(type)
+	size_t nodeSize = sizeof(JNode);
+	if(tree->augment.aggregateSize > 0) nodeSize = JAVLTREE_AGGREGATE_OFFSET + tree->augment.aggregateSize;
+	if(tree->expiry != NULL) nodeSize = JAVLTreeGetExpiryOffset(tree) + sizeof(int);
+	if(tree->keyOwner == KeyOwnerTree) nodeSize = JAVLTreeGetInlineKeyOffset(tree) + JAVLTREE_INLINE_KEY_SIZE;
+	return nodeSize;
+}
+
+/**
+ * @fn static JNodeSlabPtr JAVLTreeNewSlab(JAVLTreePtr tree, int capacity)
+ * @brief 재배치한 노드를 저장할 블록을 할당해서 AVL Tree 의 블록 목록에 연결하는 함수
+ * 노드 간격은 집계 값을 사용하면 16 바이트, 아니면 포인터 크기의 배수로 맞춘다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param capacity 저장할 노드 개수(입력)
+ * @return 성공 시 할당된 블록의 주소, 실패 시 NULL 반환
+ */
+static JNodeSlabPtr JAVLTreeNewSlab(JAVLTreePtr tree, int capacity)
+{
+	size_t align = (tree->augment.aggregateSize > 0) ? 16 : sizeof(void*);
+	size_t stride = (JAVLTreeGetNodeSize(tree) + align - 1) & ~(align - 1);
+	size_t headerSize = (sizeof(JNodeSlab) + 15) & ~(size_t)15;
+
+	JNodeSlabPtr newSlab = (JNodeSlabPtr)JAVLTreeAlloc(tree, headerSize + stride * (size_t)capacity + 15);
+	if(newSlab == NULL)
 	{
-		case IntType:
-			if(*((int*)(node->key)) > *((int*)(key))) node = node->left;
-			else node = node->right;
-			break;
-		case CharType:
-			if(*((char*)(node->key)) > *((char*)(key))) node = node->left;
-			else node = node->right;
-			break;
-		case StringType:
-		{
-			if(strncmp((char*)(node->key), (char*)(key), _GetCompareLength((char*)(node->key), (char*)(key))) < 0) node = node->left;
-			else node = node->right;
-			break;
-		}
-		default: return NULL;
+		return NULL;
 	}
-	return node;
+
+	// 할당자가 16 바이트 정렬을 보장하지 않아도 노드 공간은 정렬한다.
+	uintptr_t nodesAddress = ((uintptr_t)newSlab + headerSize + 15) & ~(uintptr_t)15;
+	newSlab->nodes = (unsigned char*)nodesAddress;
+	newSlab->stride = stride;
+	newSlab->capacity = capacity;
+	newSlab->used = 0;
+	newSlab->liveCount = 0;
+	newSlab->next = tree->nodeSlabs;
+	tree->nodeSlabs = newSlab;
+
+	return newSlab;
 }
 
 /**
- * @fn static void JNodePreorderTraverse(const JNodePtr node, KeyType type)
- * @brief 지정한 노드를 기준으로 전위 순회하며 키를 출력하는 함수(재귀)
- * @param node 순회할 기준 노드의 주소(입력)
- * @param type 출력할 키의 데이터 유형(입력)
+ * @fn static void JAVLTreeDeleteSlab(JAVLTreePtr tree, JNodeSlabPtr slab)
+ * @brief 블록을 AVL Tree 의 블록 목록에서 빼고 해제하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param slab 해제할 블록의 주소(입력)
  * @return 반환값 없음
  */
-static void JNodePreorderTraverse(const JNodePtr node, KeyType type)
+static void JAVLTreeDeleteSlab(JAVLTreePtr tree, JNodeSlabPtr slab)
 {
-	if(node == NULL) return;
-	JNodePrintKey(node, type);
-	JNodePreorderTraverse(node->left, type);
-	JNodePreorderTraverse(node->right, type);
+	JNodeSlabPtr *link = &(tree->nodeSlabs);
+	while(*link != NULL && *link != slab) link = &((*link)->next);
+	if(*link == NULL) return;
+
+	*link = slab->next;
+	if(tree->compactSlab == slab) tree->compactSlab = NULL;
+	_FreeMemory(&(tree->allocator), slab);
 }
 
 /**
- * @fn static void JNodeInorderTraverse(const JNodePtr node, KeyType type)
- * @brief 지정한 노드를 기준으로 중위 순회하며 키를 출력하는 함수(재귀)
- * @param node 순회할 기준 노드의 주소(입력)
- * @param type 출력할 키의 데이터 유형(입력)
+ * @fn static int JAVLTreeReleaseSlabNode(JAVLTreePtr tree, const void *pointer)
+ * @brief 해제할 메모리가 블록 안의 노드이면 블록의 남은 노드 수를 줄이는 함수
+ * 남은 노드가 없고 채우는 중인 블록이 아니면 블록을 해제한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param pointer 해제할 메모리의 주소(입력, 읽기 전용)
+ * @return 블록 안의 노드였으면 1, 아니면 0 반환
+ */
+static int JAVLTreeReleaseSlabNode(JAVLTreePtr tree, const void *pointer)
+{
+	JNodeSlabPtr slab = tree->nodeSlabs;
+	for(; slab != NULL; slab = slab->next)
+	{
+		const unsigned char *address = (const unsigned char*)pointer;
+		if(address < slab->nodes || address >= slab->nodes + slab->stride * (size_t)slab->capacity) continue;
+
+		slab->liveCount--;
+		if(slab->liveCount == 0 && slab != tree->compactSlab) JAVLTreeDeleteSlab(tree, slab);
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeMoveNode(JAVLTreePtr tree, JNodePtr node, JNodeSlabPtr slab)
+ * @brief 노드를 블록의 다음 칸으로 복사하고, 노드를 가리키던 연결을 모두 새 주소로 바꾼 뒤 기존 노드를 해제하는 함수
+ * 블록에 빈 칸이 있어야 한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 옮길 노드, 트리가 할당한 노드여야 함(입력)
+ * @param slab 노드를 옮길 블록(출력)
+ * @return 옮겨진 노드의 주소
+ */
+static JNodePtr JAVLTreeMoveNode(JAVLTreePtr tree, JNodePtr node, JNodeSlabPtr slab)
+{
+	JNodePtr newNode = (JNodePtr)(slab->nodes + slab->stride * (size_t)slab->used);
+	slab->used++;
+	slab->liveCount++;
+
+	// 해시 색인과 검색 캐시는 노드 주소를 저장하므로 옮기기 전에 뺀다.
+	int isIndexed = (tree->index != NULL && JHashIndexRemove(tree->index, node) == DeleteSuccess);
+	if(tree->cache != NULL) JLookupCacheInvalidate(tree->cache, node->key);
+
+	memcpy(newNode, node, JAVLTreeGetNodeSize(tree));
+	if(JAVLTreeIsInlineKey(tree, node) == 1) newNode->key = (unsigned char*)newNode + JAVLTreeGetInlineKeyOffset(tree);
+
+	JAVLTreeReplaceChild(tree, node->parent, node, newNode);
+	if(newNode->left != NULL) newNode->left->parent = newNode;
+	if(newNode->right != NULL) newNode->right->parent = newNode;
+
+	if(tree->min == node) tree->min = newNode;
+	if(tree->max == node) tree->max = newNode;
+	if(tree->finger == node) tree->finger = newNode;
+	if(tree->relaxCursor == node) tree->relaxCursor = newNode;
+	if(tree->compactCursor == node) tree->compactCursor = newNode;
+	if(tree->expiry != NULL)
+	{
+		int position = *JAVLTreeGetNodeHeapIndex(tree, newNode);
+		if(position >= 0) tree->expiry->entries[position].node = newNode;
+	}
+	// 해시 색인에 다시 추가하지 못하면 색인을 버리고 트리 검색으로 돌아간다.
+	if(isIndexed == 1 && JHashIndexAdd(tree->index, newNode) == NULL) DeleteJHashIndex(&(tree->index));
+
+	JAVLTreeFree(tree, node);
+	return newNode;
+}
+
+/**
+ * @fn static void JAVLTreeEndCompact(JAVLTreePtr tree)
+ * @brief 진행 중인 점진적 재배치를 끝내는 함수 (옮긴 노드는 그대로 두고, 빈 블록은 해제)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
  * @return 반환값 없음
  */
-static void JNodeInorderTraverse(const JNodePtr node, KeyType type)
+static void JAVLTreeEndCompact(JAVLTreePtr tree)
 {
-	if(node == NULL) return;
-	JNodeInorderTraverse(node->left, type);
-	JNodePrintKey(node, type);
-	JNodeInorderTraverse(node->right, type);
+	JNodeSlabPtr slab = tree->compactSlab;
+	tree->compactSlab = NULL;
+	tree->compactCursor = NULL;
+	if(slab != NULL && slab->liveCount == 0) JAVLTreeDeleteSlab(tree, slab);
 }
 
 /**
- * @fn static void JNodePostorderTraverse(const JNodePtr node, KeyType type)
- * @brief 지정한 노드를 기준으로 후위 순회하며 키를 출력하는 함수(재귀)
- * @param node 순회할 기준 노드의 주소(입력)
- * @param type 출력할 키의 데이터 유형(입력)
+ * @fn static void* JAVLTreeGetNodeAggregate(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드 뒤에 할당된 집계 값의 주소를 구하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 노드의 주소(입력, 읽기 전용)
+ * @return 집계 값을 사용하면 집계 값의 주소, 아니면 NULL 반환
+ */
+static void* JAVLTreeGetNodeAggregate(const JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree->augment.aggregateSize == 0) return NULL;
+	return (unsigned char*)node + JAVLTREE_AGGREGATE_OFFSET;
+}
+
+/**
+ * @fn static void JAVLTreeUpdateAggregate(const JAVLTreePtr tree, JNodePtr node)
+ * @brief 자식 노드들의 집계 값과 자신의 키로 지정한 노드의 집계 값을 다시 계산하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 집계 값을 갱신할 노드, NULL 이면 무시(출력)
  * @return 반환값 없음
  */
-static void JNodePostorderTraverse(const JNodePtr node, KeyType type)
+static void JAVLTreeUpdateAggregate(const JAVLTreePtr tree, JNodePtr node)
 {
-	if(node == NULL) return;
-	JNodePostorderTraverse(node->left, type);
-	JNodePostorderTraverse(node->right, type);
-	JNodePrintKey(node, type);
+	if(node == NULL || tree->augment.aggregateSize == 0) return;
+
+	const JAVLTreeAugment *augment = &(tree->augment);
+	void *aggregate = JAVLTreeGetNodeAggregate(tree, node);
+
+	JAVLTreeLiftNode(tree, node, aggregate);
+	if(node->left != NULL) augment->combine(aggregate, JAVLTreeGetNodeAggregate(tree, node->left), aggregate, augment->userData);
+	if(node->right != NULL) augment->combine(aggregate, aggregate, JAVLTreeGetNodeAggregate(tree, node->right), augment->userData);
 }
 
 /**
- * @fn static void JNodePrintKey(const JNodePtr node, KeyType type)
- * @brief 지정한 노드의 키를 출력하는 함수
- * @param node 출력할 노드의 주소(입력, 읽기 전용)
- * @param type 출력할 키의 데이터 유형(입력)
+ * @fn static void JAVLTreeUpdateAggregatePath(const JAVLTreePtr tree, JNodePtr node)
+ * @brief 지정한 노드부터 루트 노드까지 올라가며 집계 값을 다시 계산하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 시작 노드(출력)
  * @return 반환값 없음
  */
-static void JNodePrintKey(const JNodePtr node, KeyType type)
+static void JAVLTreeUpdateAggregatePath(const JAVLTreePtr tree, JNodePtr node)
 {
-	switch(type)
+	if(tree->augment.aggregateSize == 0) return;
+
+	for(; node != NULL; node = node->parent) JAVLTreeUpdateAggregate(tree, node);
+}
+
+/**
+ * @fn static void JAVLTreeUpdateAggregateAll(const JAVLTreePtr tree, JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 모든 집계 값을 후위 순회로 다시 계산하는 함수(재귀)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 하위 트리의 루트 노드(출력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeUpdateAggregateAll(const JAVLTreePtr tree, JNodePtr node)
+{
+	if(node == NULL || tree->augment.aggregateSize == 0) return;
+
+	JAVLTreeUpdateAggregateAll(tree, node->left);
+	JAVLTreeUpdateAggregateAll(tree, node->right);
+	JAVLTreeUpdateAggregate(tree, node);
+}
+
+/**
+ * @fn static void JAVLTreeLiftNode(const JAVLTreePtr tree, const JNodePtr node, void *aggregate)
+ * @brief 노드 하나(자식 제외)의 집계 값을 구하는 함수, 삭제 표시된 노드는 항등원
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 노드의 주소(입력, 읽기 전용)
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @return 반환값 없음
+ */
+static void JAVLTreeLiftNode(const JAVLTreePtr tree, const JNodePtr node, void *aggregate)
+{
+	const JAVLTreeAugment *augment = &(tree->augment);
+
+	if(node->flags & JNODE_FLAG_TOMBSTONE) augment->identity(aggregate, augment->userData);
+	else augment->lift(aggregate, node->key, augment->userData);
+}
+
+/**
+ * @fn static int JAVLTreeCompareKey(const JAVLTreePtr tree, const void *key1, const void *key2)
+ * @brief AVL Tree 의 키 데이터 유형에 맞는 방법으로 두 키를 비교하는 함수
+ * CustomType 이면 설정된 비교 함수를 호출하고, 아니면 _CompareKey 를 사용한다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @return key1 이 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int JAVLTreeCompareKey(const JAVLTreePtr tree, const void *key1, const void *key2)
+{
+	if(tree->type == CustomType) return tree->compare(key1, key2, tree->compareData);
+	return _CompareKey(key1, key2, tree->type);
+}
+
+/**
+ * @fn static DeleteResult JAVLTreeDeleteNode(JAVLTreePtr tree, JNodePtr node)
+ * @brief 찾은 노드를 로그에 기록하고 삭제(지연 삭제 모드에서는 삭제 표시)하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 삭제할 노드, 삭제 표시되지 않은 노드(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+static DeleteResult JAVLTreeDeleteNode(JAVLTreePtr tree, JNodePtr node)
+{
+	if(JAVLTreeLogOperation(tree, WALDeleteNode, node->key) == 0) return DeleteFail;
+	JAVLTreeOnDelete(tree, node);
+
+	if(tree->tombstoneThreshold > 0)
 	{
-		case IntType:
-			printf("%d ", *((int*)(node->key)));
-			break;
-		case CharType:
-			printf("%c ", *((char*)(node->key)));
-			break;
-		case StringType:
-			printf("%s ", (char*)(node->key));
-			break;
-		default: return;
+		node->flags |= JNODE_FLAG_TOMBSTONE;
+		tree->tombstoneCount++;
+		JAVLTreeUpdateAggregatePath(tree, node);
+		if((long long)tree->tombstoneCount * 100 >= (long long)tree->tombstoneThreshold * tree->nodeCount)
+		{
+			JAVLTreePurgeTombstones(tree);
+		}
+		return DeleteSuccess;
 	}
+
+	JAVLTreeUnlinkNode(tree, node);
+	JAVLTreeFree(tree, node);
+	return DeleteSuccess;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// JAVLTree Static Function
-////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @fn static JAVLTreePtr JAVLTreeRebalance(JAVLTreePtr tree)
- * @brief AVL Tree 의 높이 균형을 맞추도록 노드들의 위치를 재배열하는 함수
- * @param tree AVL Tree 의 주소(입력)
- * @return 성공 시 AVL Tree 의 주소, 실패 시 NULL 반환
+ * @fn static size_t JAVLTreeGetExpiryOffset(const JAVLTreePtr tree)
+ * @brief 노드 뒤에 붙는 힙 위치의 시작 위치를 구하는 함수 (집계 값이 있으면 그 뒤)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 노드 시작 주소로부터의 바이트 수
  */
-static JAVLTreePtr JAVLTreeRebalance(JAVLTreePtr tree)
+static size_t JAVLTreeGetExpiryOffset(const JAVLTreePtr tree)
 {
-	if(tree == NULL) return NULL;
+	return JAVLTREE_AGGREGATE_OFFSET + ((tree->augment.aggregateSize + sizeof(int) - 1) & ~(sizeof(int) - 1));
+}
+
+/**
+ * @fn static int* JAVLTreeGetNodeHeapIndex(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드 뒤에 할당된 만료 시각 힙 위치의 주소를 구하는 함수 (만료 시각이 없으면 -1 저장)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 노드의 주소(입력, 읽기 전용)
+ * @return 힙 위치의 주소
+ */
+static int* JAVLTreeGetNodeHeapIndex(const JAVLTreePtr tree, const JNodePtr node)
+{
+	return (int*)((unsigned char*)node + JAVLTreeGetExpiryOffset(tree));
+}
 
-	int heightDiff = JNodeGetHeightDiff(tree->root);
+/**
+ * @fn static size_t JAVLTreeGetInlineKeyOffset(const JAVLTreePtr tree)
+ * @brief 노드 뒤에 붙는 키 공간의 시작 위치를 구하는 함수 (집계 값, 힙 위치가 있으면 그 뒤)
+ * 집계 값과 만료 정보는 빈 트리에서만 설정할 수 있으므로 노드가 있는 동안 위치가 바뀌지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 노드 시작 주소로부터의 바이트 수 (포인터 크기의 배수)
+ */
+static size_t JAVLTreeGetInlineKeyOffset(const JAVLTreePtr tree)
+{
+	size_t offset = sizeof(JNode);
+	if(tree->augment.aggregateSize > 0) offset = JAVLTREE_AGGREGATE_OFFSET + tree->augment.aggregateSize;
+	if(tree->expiry != NULL) offset = JAVLTreeGetExpiryOffset(tree) + sizeof(int);
+	return (offset + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+}
 
-	if(heightDiff > 1)
+/**
+ * @fn static void* JAVLTreeOwnKey(JAVLTreePtr tree, JNodePtr node, const void *key)
+ * @brief KeyOwnerTree 트리에서 노드에 저장할 키를 복사하는 함수
+ * JAVLTREE_INLINE_KEY_SIZE 이하의 키는 노드 안의 키 공간에, 더 큰 키는 키 저장 블록에 복사한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 키를 저장할 노드, JAVLTreeNewNode 로 할당되어야 함(입력)
+ * @param key 복사할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 복사된 키의 주소, 실패 시 NULL 반환
+ */
+static void* JAVLTreeOwnKey(JAVLTreePtr tree, JNodePtr node, const void *key)
+{
+	size_t keySize = _GetKeySize(key, tree->type);
+	if(keySize == 0 || keySize > JAVLTREE_INLINE_KEY_SIZE) return JAVLTreeStoreKey(tree, key);
+
+	void *inlineKey = (unsigned char*)node + JAVLTreeGetInlineKeyOffset(tree);
+	memcpy(inlineKey, key, keySize);
+	return inlineKey;
+}
+
+/**
+ * @fn static int JAVLTreeIsInlineKey(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드의 키가 노드 안의 키 공간에 저장되어 있는지 검사하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 검사할 노드의 주소(입력, 읽기 전용)
+ * @return 노드 안에 있으면 1, 아니면 0 반환
+ */
+static int JAVLTreeIsInlineKey(const JAVLTreePtr tree, const JNodePtr node)
+{
+	if(tree->keyOwner != KeyOwnerTree) return 0;
+	return node->key == (void*)((unsigned char*)node + JAVLTreeGetInlineKeyOffset(tree));
+}
+
+/**
+ * @fn static JNodePtr JAVLTreeCheckExpired(const JAVLTreePtr tree, JNodePtr node)
+ * @brief 현재 시각 함수가 설정되어 있으면 만료된 노드를 검색 결과에서 걸러내는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 찾은 노드, 없으면 NULL(입력)
+ * @return 만료되지 않은 노드면 그 노드의 주소, 아니면 NULL 반환
+ */
+static JNodePtr JAVLTreeCheckExpired(const JAVLTreePtr tree, JNodePtr node)
+{
+	if(node == NULL || tree->expiry == NULL || tree->expiry->clock == NULL) return node;
+
+	int position = *JAVLTreeGetNodeHeapIndex(tree, node);
+	if(position >= 0 && tree->expiry->entries[position].expireAt <= tree->expiry->clock(tree->expiry->clockData)) return NULL;
+	return node;
+}
+
+/**
+ * @fn static void JExpiryHeapMove(const JAVLTreePtr tree, int position, JExpiryEntry entry)
+ * @brief 힙의 지정한 위치에 항목을 저장하고 노드의 힙 위치를 갱신하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 저장할 위치(입력)
+ * @param entry 저장할 항목(입력)
+ * @return 반환값 없음
+ */
+static void JExpiryHeapMove(const JAVLTreePtr tree, int position, JExpiryEntry entry)
+{
+	tree->expiry->entries[position] = entry;
+	*JAVLTreeGetNodeHeapIndex(tree, entry.node) = position;
+}
+
+/**
+ * @fn static void JExpiryHeapSiftUp(const JAVLTreePtr tree, int position)
+ * @brief 만료 시각이 부모보다 빠른 항목을 위로 올리는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 올릴 항목의 위치(입력)
+ * @return 반환값 없음
+ */
+static void JExpiryHeapSiftUp(const JAVLTreePtr tree, int position)
+{
+	JExpiryEntry entry = tree->expiry->entries[position];
+
+	while(position > 0)
 	{
-		if(JNodeGetHeightDiff(tree->root->left) > 0) tree->root = JNodeRotateLL(tree->root);
-		else tree->root = JNodeRotateLR(tree->root);
+		int parent = (position - 1) / 2;
+		if(tree->expiry->entries[parent].expireAt <= entry.expireAt) break;
+		JExpiryHeapMove(tree, position, tree->expiry->entries[parent]);
+		position = parent;
 	}
+	JExpiryHeapMove(tree, position, entry);
+}
 
-	if(heightDiff < -1)
+/**
+ * @fn static void JExpiryHeapSiftDown(const JAVLTreePtr tree, int position)
+ * @brief 만료 시각이 자식보다 늦은 항목을 아래로 내리는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 내릴 항목의 위치(입력)
+ * @return 반환값 없음
+ */
+static void JExpiryHeapSiftDown(const JAVLTreePtr tree, int position)
+{
+	JExpiryHeapPtr heap = tree->expiry;
+	JExpiryEntry entry = heap->entries[position];
+
+	while(1)
 	{
-		if(JNodeGetHeightDiff(tree->root->right) < 0) tree->root = JNodeRotateRR(tree->root);
-		else tree->root = JNodeRotateRL(tree->root);
+		int child = position * 2 + 1;
+		if(child >= heap->count) break;
+		if(child + 1 < heap->count && heap->entries[child + 1].expireAt < heap->entries[child].expireAt) child++;
+		if(entry.expireAt <= heap->entries[child].expireAt) break;
+		JExpiryHeapMove(tree, position, heap->entries[child]);
+		position = child;
 	}
+	JExpiryHeapMove(tree, position, entry);
+}
 
-	return tree;
+/**
+ * @fn static void JExpiryHeapRemove(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 노드를 만료 시각 힙에서 빼는 함수 (힙에 없으면 무시)
+ * 마지막 항목을 빈 자리로 옮긴 뒤 위나 아래로 이동시킨다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 뺄 노드의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JExpiryHeapRemove(const JAVLTreePtr tree, const JNodePtr node)
+{
+	JExpiryHeapPtr heap = tree->expiry;
+	int *heapIndex = JAVLTreeGetNodeHeapIndex(tree, node);
+	int position = *heapIndex;
+	if(position < 0) return;
+
+	*heapIndex = -1;
+	heap->count--;
+	if(position == heap->count) return;
+
+	JExpiryHeapMove(tree, position, heap->entries[heap->count]);
+	JExpiryHeapSiftUp(tree, position);
+	JExpiryHeapSiftDown(tree, *JAVLTreeGetNodeHeapIndex(tree, heap->entries[position].node));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -642,6 +3602,8 @@ static KeyType _CheckKeyType(KeyType type)
 		case IntType:
 		case CharType:
 		case StringType:
+		case IntervalType:
+		case CustomType:
 			break;
 		default:
 			return Unknown;
@@ -650,16 +3612,100 @@ static KeyType _CheckKeyType(KeyType type)
 }
 
 /**
- * @fn static int _GetCompareLength(const char *s1, const char *s2)
- * @brief 두 문자열을 비교할 때 가장 긴 문자열의 길이를 반환하는 함수
- * @param s1 첫 번째 비교할 문자열(입력, 읽기 전용)
- * @param s2 두 번째 비교할 문자열(입력, 읽기 전용)
- * @return 항상 비교할 길이 반환
+ * @fn static int _CompareKey(const void *key1, const void *key2, KeyType type)
+ * @brief 지정한 키 데이터 유형에 따라 두 키를 비교하는 함수
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return key1 이 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int _CompareKey(const void *key1, const void *key2, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return (*((const int*)key1) > *((const int*)key2)) - (*((const int*)key1) < *((const int*)key2));
+		case CharType:
+			return (*((const char*)key1) > *((const char*)key2)) - (*((const char*)key1) < *((const char*)key2));
+		case StringType:
+			return strcmp((const char*)key1, (const char*)key2);
+		case IntervalType:
+		{
+			const JInterval *interval1 = (const JInterval*)key1;
+			const JInterval *interval2 = (const JInterval*)key2;
+			if(interval1->start != interval2->start) return (interval1->start > interval2->start) - (interval1->start < interval2->start);
+			return (interval1->end > interval2->end) - (interval1->end < interval2->end);
+		}
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static int _IsBoundCandidate(int compareResult, JNodeBound bound)
+ * @brief 노드의 키와 찾는 키의 비교 결과가 탐색 경계 조건을 만족하는지 검사하는 함수
+ * @param compareResult 노드의 키와 찾는 키의 비교 결과(입력)
+ * @param bound 탐색 경계 조건(입력, JNodeBound 열거형 참고)
+ * @return 만족하면 1, 만족하지 않으면 0 반환
+ */
+static int _IsBoundCandidate(int compareResult, JNodeBound bound)
+{
+	switch(bound)
+	{
+		case BoundGreaterEqual: return compareResult >= 0;
+		case BoundGreater: return compareResult > 0;
+		case BoundLessEqual: return compareResult <= 0;
+		case BoundLess: return compareResult < 0;
+		default: return 0;
+	}
+}
+
+/**
+ * @fn static size_t _GetKeySize(const void *key, KeyType type)
+ * @brief 지정한 키 데이터 유형에 따라 키가 차지하는 바이트 수를 구하는 함수
+ * @param key 크기를 구할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return 키의 바이트 수 반환 (문자열은 NULL 문자 포함)
+ */
+static size_t _GetKeySize(const void *key, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return sizeof(int);
+		case CharType:
+			return sizeof(char);
+		case StringType:
+			return strlen((const char*)key) + 1;
+		case IntervalType:
+			return sizeof(JInterval);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static void* _AllocMemory(const JAVLTreeAllocator *allocator, size_t size)
+ * @brief 할당자로 메모리를 할당하는 함수
+ * @param allocator 메모리 할당자, 함수가 NULL 이면 malloc(입력, 읽기 전용)
+ * @param size 할당할 바이트 수(입력)
+ * @return 성공 시 할당된 메모리의 주소, 실패 시 NULL 반환
  */
-static int _GetCompareLength(const char *s1, const char *s2)
+static void* _AllocMemory(const JAVLTreeAllocator *allocator, size_t size)
 {
-	int s1Length = strlen(s1);
-	int s2Length = strlen(s2);
-	return s1Length > s2Length ? s1Length : s2Length;
+	if(allocator->alloc == NULL) return malloc(size);
+	return allocator->alloc(size, allocator->context);
 }
 
+/**
+ * @fn static void _FreeMemory(const JAVLTreeAllocator *allocator, void *pointer)
+ * @brief 할당자로 할당한 메모리를 해제하는 함수
+ * @param allocator 메모리 할당자, 함수가 NULL 이면 free(입력, 읽기 전용)
+ * @param pointer 해제할 메모리의 주소(입력)
+ * @return 반환값 없음
+ */
+static void _FreeMemory(const JAVLTreeAllocator *allocator, void *pointer)
+{
+	if(allocator->free == NULL) free(pointer);
+	else allocator->free(pointer, allocator->context);
+}
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jbloomfilter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 카운터 최대값, 이 값에 도달한 카운터는 더 이상 줄이지 않는다.
+#define JBLOOM_COUNTER_MAX 15U
+// 두 번째 해시 값을 만들 때 곱하는 값 (황금비)
+#define JBLOOM_GOLDEN_RATIO 0x9E3779B97F4A7C15ULL
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JBloomFilter Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned char* JBloomFilterGetBlock(const JBloomFilterPtr filter, unsigned long long hash);
+static unsigned int JBloomFilterGetSlot(const JBloomFilterPtr filter, unsigned long long hash, int index);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JBloomFilter
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JBloomFilterPtr NewJBloomFilter(KeyType type, JBloomMode mode, unsigned int expectedKeyCount, int slotsPerKey)
+ * @brief 새로운 블록 단위 Bloom Filter 구조체 객체를 생성하는 함수
+ * 키 하나의 칸들은 모두 한 블록(캐시 라인) 안에 있으므로 검사할 때 캐시 라인 하나만 읽는다.
+ * 해시 함수 개수는 키 당 칸 수 * ln2 로 정한다.
+ * @param type 키 데이터 유형(입력)
+ * @param mode 종류, 삭제가 필요하면 BloomCounting(입력)
+ * @param expectedKeyCount 저장할 것으로 예상하는 키 개수(입력)
+ * @param slotsPerKey 키 하나 당 칸 수, 클수록 거짓 양성이 줄어든다 (BloomCounting 의 칸은 4 비트)(입력)
+ * @return 성공 시 생성된 Bloom Filter 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JBloomFilterPtr NewJBloomFilter(KeyType type, JBloomMode mode, unsigned int expectedKeyCount, int slotsPerKey)
+{
+	if(type != IntType && type != CharType && type != StringType) return NULL;
+	if((mode != BloomBlocked && mode != BloomCounting) || slotsPerKey < 1) return NULL;
+
+	JBloomFilterPtr newFilter = (JBloomFilterPtr)malloc(sizeof(JBloomFilter));
+	if(newFilter == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned int slotsPerBlock = (mode == BloomBlocked) ? JBLOOM_BLOCK_SIZE * 8 : JBLOOM_BLOCK_SIZE * 2;
+	unsigned long long totalSlots = (unsigned long long)expectedKeyCount * (unsigned long long)slotsPerKey;
+	unsigned long long blockCount = (totalSlots + slotsPerBlock - 1) / slotsPerBlock;
+	if(blockCount == 0) blockCount = 1;
+	if(blockCount > 0xFFFFFFFFULL)
+	{
+		free(newFilter);
+		return NULL;
+	}
+
+	newFilter->blocks = (unsigned char*)aligned_alloc(JBLOOM_BLOCK_SIZE, (size_t)blockCount * JBLOOM_BLOCK_SIZE);
+	if(newFilter->blocks == NULL)
+	{
+		free(newFilter);
+		return NULL;
+	}
+
+	int hashCount = (slotsPerKey * 693 + 500) / 1000;
+	if(hashCount < 1) hashCount = 1;
+	if(hashCount > JBLOOM_MAX_HASH_COUNT) hashCount = JBLOOM_MAX_HASH_COUNT;
+
+	newFilter->type = type;
+	newFilter->mode = mode;
+	newFilter->blockCount = (unsigned int)blockCount;
+	newFilter->slotsPerBlock = slotsPerBlock;
+	newFilter->hashCount = hashCount;
+	JBloomFilterClear(newFilter);
+
+	return newFilter;
+}
+
+/**
+ * @fn DeleteResult DeleteJBloomFilter(JBloomFilterPtrContainer container)
+ * @brief Bloom Filter 구조체 객체를 삭제하는 함수
+ * @param container Bloom Filter 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJBloomFilter(JBloomFilterPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->blocks);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JBloomFilterClear(JBloomFilterPtr filter)
+ * @brief Bloom Filter 의 모든 칸과 통계를 지우는 함수
+ * @param filter Bloom Filter 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+void JBloomFilterClear(JBloomFilterPtr filter)
+{
+	if(filter == NULL) return;
+
+	memset(filter->blocks, 0, (size_t)filter->blockCount * JBLOOM_BLOCK_SIZE);
+	filter->queryCount = 0;
+	filter->negativeCount = 0;
+	filter->falsePositiveCount = 0;
+}
+
+/**
+ * @fn void JBloomFilterAdd(JBloomFilterPtr filter, const void *key)
+ * @brief Bloom Filter 에 키를 추가하는 함수
+ * 카운터는 최대값에 도달하면 더 늘리지 않는다.
+ * @param filter Bloom Filter 구조체 객체의 주소(출력)
+ * @param key 추가할 키의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JBloomFilterAdd(JBloomFilterPtr filter, const void *key)
+{
+	if(filter == NULL || key == NULL) return;
+
+	unsigned long long hash = JAVLTreeHashKey(key, filter->type);
+	unsigned char *block = JBloomFilterGetBlock(filter, hash);
+	int index = 0;
+
+	for(; index < filter->hashCount; index++)
+	{
+		unsigned int slot = JBloomFilterGetSlot(filter, hash, index);
+		if(filter->mode == BloomBlocked)
+		{
+			block[slot >> 3] |= (unsigned char)(1U << (slot & 7U));
+			continue;
+		}
+
+		unsigned int shift = (slot & 1U) << 2;
+		unsigned int counter = (block[slot >> 1] >> shift) & 0xFU;
+		if(counter < JBLOOM_COUNTER_MAX) block[slot >> 1] = (unsigned char)(block[slot >> 1] + (1U << shift));
+	}
+}
+
+/**
+ * @fn void JBloomFilterRemove(JBloomFilterPtr filter, const void *key)
+ * @brief Bloom Filter 에서 키를 제거하는 함수 (BloomCounting 만 반영)
+ * 최대값에 도달한 카운터는 실제 개수를 알 수 없으므로 줄이지 않는다.
+ * BloomBlocked 에서는 아무것도 하지 않으므로, 삭제가 많으면 거짓 양성 비율이 점점 올라간다.
+ * @param filter Bloom Filter 구조체 객체의 주소(출력)
+ * @param key 제거할 키의 주소, 반드시 추가되었던 키(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JBloomFilterRemove(JBloomFilterPtr filter, const void *key)
+{
+	if(filter == NULL || key == NULL || filter->mode != BloomCounting) return;
+
+	unsigned long long hash = JAVLTreeHashKey(key, filter->type);
+	unsigned char *block = JBloomFilterGetBlock(filter, hash);
+	int index = 0;
+
+	for(; index < filter->hashCount; index++)
+	{
+		unsigned int slot = JBloomFilterGetSlot(filter, hash, index);
+		unsigned int shift = (slot & 1U) << 2;
+		unsigned int counter = (block[slot >> 1] >> shift) & 0xFU;
+		if(counter > 0 && counter < JBLOOM_COUNTER_MAX) block[slot >> 1] = (unsigned char)(block[slot >> 1] - (1U << shift));
+	}
+}
+
+/**
+ * @fn FindResult JBloomFilterMayContain(const JBloomFilterPtr filter, const void *key)
+ * @brief 키가 있을 수 있는지 검사하는 함수
+ * FindFail 이면 키가 확실히 없고, FindSuccess 이면 있을 수도 있다(거짓 양성 가능).
+ * @param filter Bloom Filter 구조체 객체의 주소(입력)
+ * @param key 검사할 키의 주소(입력, 읽기 전용)
+ * @return 있을 수 있으면 FindSuccess, 확실히 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JBloomFilterMayContain(const JBloomFilterPtr filter, const void *key)
+{
+	if(filter == NULL || key == NULL) return FindSuccess;
+
+	unsigned long long hash = JAVLTreeHashKey(key, filter->type);
+	const unsigned char *block = JBloomFilterGetBlock(filter, hash);
+	int index = 0;
+
+	filter->queryCount++;
+	for(; index < filter->hashCount; index++)
+	{
+		unsigned int slot = JBloomFilterGetSlot(filter, hash, index);
+		int isSet = 0;
+		if(filter->mode == BloomBlocked) isSet = (block[slot >> 3] >> (slot & 7U)) & 1U;
+		else isSet = ((block[slot >> 1] >> ((slot & 1U) << 2)) & 0xFU) != 0;
+
+		if(isSet == 0)
+		{
+			filter->negativeCount++;
+			return FindFail;
+		}
+	}
+
+	return FindSuccess;
+}
+
+/**
+ * @fn double JBloomFilterGetFalsePositiveRate(const JBloomFilterPtr filter)
+ * @brief 지금까지 측정한 거짓 양성 비율을 반환하는 함수
+ * 없는 키에 대한 검사 중 있을 수 있다고 답한 비율이다.
+ * 거짓 양성 횟수는 Bloom Filter 를 연결한 AVL Tree 가 검색에 실패할 때 센다.
+ * @param filter Bloom Filter 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 거짓 양성 비율(0 ~ 1), 측정한 적이 없으면 0 반환
+ */
+double JBloomFilterGetFalsePositiveRate(const JBloomFilterPtr filter)
+{
+	if(filter == NULL) return 0.0;
+
+	unsigned long long absentCount = filter->negativeCount + filter->falsePositiveCount;
+	if(absentCount == 0) return 0.0;
+	return (double)filter->falsePositiveCount / (double)absentCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JBloomFilter Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static unsigned char* JBloomFilterGetBlock(const JBloomFilterPtr filter, unsigned long long hash)
+ * @brief 해시 값의 상위 32 비트로 키가 사용할 블록을 고르는 함수
+ * 나머지 연산 대신 곱셈으로 [0, 블록 개수) 범위로 줄인다.
+ * @param filter Bloom Filter 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 해시 값(입력)
+ * @return 블록의 주소
+ */
+static unsigned char* JBloomFilterGetBlock(const JBloomFilterPtr filter, unsigned long long hash)
+{
+	unsigned long long blockIndex = ((hash >> 32) * (unsigned long long)filter->blockCount) >> 32;
+	return filter->blocks + blockIndex * JBLOOM_BLOCK_SIZE;
+}
+
+/**
+ * @fn static unsigned int JBloomFilterGetSlot(const JBloomFilterPtr filter, unsigned long long hash, int index)
+ * @brief 블록 안에서 index 번째 해시 함수가 가리키는 칸을 구하는 함수
+ * 해시 값의 하위 32 비트와 그 값을 다시 섞은 값으로 이중 해싱한다.
+ * @param filter Bloom Filter 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 해시 값(입력)
+ * @param index 해시 함수 번호(입력)
+ * @return 블록 안의 칸 번호
+ */
+static unsigned int JBloomFilterGetSlot(const JBloomFilterPtr filter, unsigned long long hash, int index)
+{
+	unsigned int first = (unsigned int)hash;
+	unsigned int second = (unsigned int)(((hash & 0xFFFFFFFFULL) * JBLOOM_GOLDEN_RATIO) >> 32) | 1U;
+	return (first + (unsigned int)index * second) & (filter->slotsPerBlock - 1U);
+}
@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jbufferedavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JInsertBuffer Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JInsertBufferSearch(const JInsertBufferPtr buffer, const void *key, int *isFound);
+static int JInsertBufferMerge(JInsertBufferPtr buffer);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JBufferedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JBufferedAVLTreePtr NewJBufferedAVLTree(JAVLTreePtr tree, int bufferCapacity)
+ * @brief 공유 AVL Tree 앞에 스레드별 삽입 버퍼를 두는 앞단 구조체 객체를 생성하는 함수
+ * 앞단을 사용하는 동안에는 공유 트리를 직접 사용하지 말고 앞단의 함수로만 사용해야 한다.
+ * @param tree 키를 합칠 공유 AVL Tree 구조체 객체의 주소(입력)
+ * @param bufferCapacity 버퍼 하나의 최대 키 개수, 0 이면 JINSERT_BUFFER_DEFAULT_CAPACITY(입력)
+ * @return 성공 시 생성된 앞단 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JBufferedAVLTreePtr NewJBufferedAVLTree(JAVLTreePtr tree, int bufferCapacity)
+{
+	if(tree == NULL || bufferCapacity < 0) return NULL;
+	if(bufferCapacity == 0) bufferCapacity = JINSERT_BUFFER_DEFAULT_CAPACITY;
+
+	JBufferedAVLTreePtr newFront = (JBufferedAVLTreePtr)malloc(sizeof(JBufferedAVLTree));
+	if(newFront == NULL)
+	{
+		return NULL;
+	}
+
+	if(pthread_mutex_init(&(newFront->treeLock), NULL) != 0)
+	{
+		free(newFront);
+		return NULL;
+	}
+
+	if(pthread_mutex_init(&(newFront->listLock), NULL) != 0)
+	{
+		pthread_mutex_destroy(&(newFront->treeLock));
+		free(newFront);
+		return NULL;
+	}
+
+	newFront->tree = tree;
+	newFront->buffers = NULL;
+	newFront->bufferCapacity = bufferCapacity;
+	newFront->mergeCount = 0;
+
+	return newFront;
+}
+
+/**
+ * @fn DeleteResult DeleteJBufferedAVLTree(JBufferedAVLTreePtrContainer container)
+ * @brief 앞단 구조체 객체를 삭제하는 함수
+ * 남아 있는 버퍼의 키를 모두 공유 트리로 합치고 버퍼도 함께 해제하므로, 어떤 스레드도 버퍼를 사용하지 않을 때 호출해야 한다.
+ * 공유 트리는 해제하지 않는다. 합치지 못한 키가 있어도 앞단은 삭제하고 DeleteFail 을 반환한다.
+ * @param container 앞단 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJBufferedAVLTree(JBufferedAVLTreePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JBufferedAVLTreePtr front = *container;
+	DeleteResult result = (JBufferedAVLTreeFlush(front) < 0) ? DeleteFail : DeleteSuccess;
+
+	while(front->buffers != NULL)
+	{
+		JInsertBufferPtr buffer = front->buffers;
+		front->buffers = buffer->next;
+		pthread_mutex_destroy(&(buffer->lock));
+		free(buffer->keys);
+		free(buffer);
+	}
+
+	pthread_mutex_destroy(&(front->listLock));
+	pthread_mutex_destroy(&(front->treeLock));
+	free(front);
+	*container = NULL;
+
+	return result;
+}
+
+/**
+ * @fn int JBufferedAVLTreeFlush(JBufferedAVLTreePtr front)
+ * @brief 모든 스레드의 버퍼에 모인 키를 공유 트리로 합치는 함수 (어느 스레드에서나 호출 가능)
+ * 한 버퍼를 합치지 못해도 나머지 버퍼는 계속 합치며, 합치지 못한 키는 각 버퍼에 남는다.
+ * @param front 앞단 구조체 객체의 주소(출력)
+ * @return 성공 시 공유 트리에 새로 추가된 키 개수, 합치지 못한 버퍼가 있으면 -1 반환
+ */
+int JBufferedAVLTreeFlush(JBufferedAVLTreePtr front)
+{
+	if(front == NULL) return -1;
+
+	int addedCount = 0;
+	int isFailed = 0;
+	JInsertBufferPtr buffer = NULL;
+
+	pthread_mutex_lock(&(front->listLock));
+	for(buffer = front->buffers; buffer != NULL; buffer = buffer->next)
+	{
+		pthread_mutex_lock(&(buffer->lock));
+		int mergedCount = JInsertBufferMerge(buffer);
+		pthread_mutex_unlock(&(buffer->lock));
+
+		if(mergedCount < 0) isFailed = 1;
+		else addedCount += mergedCount;
+	}
+	pthread_mutex_unlock(&(front->listLock));
+
+	return (isFailed == 1) ? -1 : addedCount;
+}
+
+/**
+ * @fn void* JBufferedAVLTreeFindKey(JBufferedAVLTreePtr front, void *key)
+ * @brief 모든 버퍼와 공유 트리에서 지정한 키를 찾는 함수
+ * 버퍼를 먼저 찾고 공유 트리를 나중에 찾으므로, 찾는 도중에 버퍼가 합쳐져도 놓치지 않는다.
+ * @param front 앞단 구조체 객체의 주소(입력)
+ * @param key 찾을 키의 주소(입력)
+ * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
+ */
+void* JBufferedAVLTreeFindKey(JBufferedAVLTreePtr front, void *key)
+{
+	if(front == NULL || key == NULL) return NULL;
+
+	void *foundKey = NULL;
+	JInsertBufferPtr buffer = NULL;
+
+	pthread_mutex_lock(&(front->listLock));
+	for(buffer = front->buffers; buffer != NULL && foundKey == NULL; buffer = buffer->next)
+	{
+		int isFound = 0;
+
+		pthread_mutex_lock(&(buffer->lock));
+		int position = JInsertBufferSearch(buffer, key, &isFound);
+		if(isFound == 1) foundKey = buffer->keys[position];
+		pthread_mutex_unlock(&(buffer->lock));
+	}
+	pthread_mutex_unlock(&(front->listLock));
+	if(foundKey != NULL) return foundKey;
+
+	pthread_mutex_lock(&(front->treeLock));
+	JNodePtr node = JAVLTreeFindNode(front->tree, key);
+	if(node != NULL) foundKey = JNodeGetKey(node);
+	pthread_mutex_unlock(&(front->treeLock));
+
+	return foundKey;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JInsertBuffer
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JInsertBufferPtr NewJInsertBuffer(JBufferedAVLTreePtr front)
+ * @brief 스레드 하나가 사용할 삽입 버퍼를 생성해서 앞단에 등록하는 함수
+ * 버퍼는 만든 스레드만 키를 추가해야 한다.
+ * @param front 버퍼를 등록할 앞단 구조체 객체의 주소(출력)
+ * @return 성공 시 생성된 삽입 버퍼 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JInsertBufferPtr NewJInsertBuffer(JBufferedAVLTreePtr front)
+{
+	if(front == NULL) return NULL;
+
+	JInsertBufferPtr newBuffer = (JInsertBufferPtr)malloc(sizeof(JInsertBuffer));
+	if(newBuffer == NULL)
+	{
+		return NULL;
+	}
+
+	newBuffer->keys = (void**)malloc(sizeof(void*) * (size_t)front->bufferCapacity);
+	if(newBuffer->keys == NULL)
+	{
+		free(newBuffer);
+		return NULL;
+	}
+
+	if(pthread_mutex_init(&(newBuffer->lock), NULL) != 0)
+	{
+		free(newBuffer->keys);
+		free(newBuffer);
+		return NULL;
+	}
+
+	newBuffer->owner = front;
+	newBuffer->count = 0;
+	newBuffer->capacity = front->bufferCapacity;
+
+	pthread_mutex_lock(&(front->listLock));
+	newBuffer->next = front->buffers;
+	front->buffers = newBuffer;
+	pthread_mutex_unlock(&(front->listLock));
+
+	return newBuffer;
+}
+
+/**
+ * @fn DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container)
+ * @brief 삽입 버퍼의 키를 공유 트리로 합치고 앞단에서 빼낸 뒤 삭제하는 함수
+ * 합치지 못한 키가 있으면 키를 잃지 않도록 버퍼를 삭제하지 않고 실패한다. (다시 호출하거나 앞단 삭제 시 합쳐짐)
+ * @param container 삽입 버퍼 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JInsertBufferPtr buffer = *container;
+	JBufferedAVLTreePtr front = buffer->owner;
+	JInsertBufferPtr *link = NULL;
+
+	if(JInsertBufferFlush(buffer) < 0) return DeleteFail;
+
+	pthread_mutex_lock(&(front->listLock));
+	for(link = &(front->buffers); *link != NULL; link = &((*link)->next))
+	{
+		if(*link == buffer)
+		{
+			*link = buffer->next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&(front->listLock));
+
+	pthread_mutex_destroy(&(buffer->lock));
+	free(buffer->keys);
+	free(buffer);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JInsertBufferPtr JInsertBufferAddKey(JInsertBufferPtr buffer, void *key)
+ * @brief 삽입 버퍼에 키를 정렬된 위치로 추가하는 함수
+ * 공유 트리 잠금을 잡지 않으며, 버퍼가 가득 차면 그때만 잠금을 잡고 한꺼번에 합친다.
+ * 공유 트리에 이미 있는 키는 합칠 때 건너뛴다.
+ * 합치기에 실패해서 버퍼가 가득 찬 채로 남아 있으면 다시 합쳐 보고, 그래도 가득 차 있으면 실패한다.
+ * @param buffer 삽입 버퍼 구조체 객체의 주소(출력)
+ * @param key 추가할 키의 주소, 공유 트리에 합쳐진 뒤에도 유지되어야 함(입력)
+ * @return 성공 시 삽입 버퍼 구조체의 주소, 버퍼에 같은 키가 있거나 실패 시 NULL 반환
+ */
+JInsertBufferPtr JInsertBufferAddKey(JInsertBufferPtr buffer, void *key)
+{
+	if(buffer == NULL || key == NULL) return NULL;
+
+	int isFound = 0;
+
+	pthread_mutex_lock(&(buffer->lock));
+	if(buffer->count == buffer->capacity) JInsertBufferMerge(buffer);
+	if(buffer->count == buffer->capacity)
+	{
+		pthread_mutex_unlock(&(buffer->lock));
+		return NULL;
+	}
+
+	int position = JInsertBufferSearch(buffer, key, &isFound);
+	if(isFound == 1)
+	{
+		pthread_mutex_unlock(&(buffer->lock));
+		return NULL;
+	}
+
+	memmove(buffer->keys + position + 1, buffer->keys + position, sizeof(void*) * (size_t)(buffer->count - position));
+	buffer->keys[position] = key;
+	buffer->count++;
+	if(buffer->count == buffer->capacity) JInsertBufferMerge(buffer);
+	pthread_mutex_unlock(&(buffer->lock));
+
+	return buffer;
+}
+
+/**
+ * @fn int JInsertBufferFlush(JInsertBufferPtr buffer)
+ * @brief 삽입 버퍼에 모인 키를 공유 트리로 합치는 함수
+ * @param buffer 삽입 버퍼 구조체 객체의 주소(출력)
+ * @return 성공 시 공유 트리에 새로 추가된 키 개수, 실패 시 -1 반환 (합치지 못한 키는 버퍼에 남음)
+ */
+int JInsertBufferFlush(JInsertBufferPtr buffer)
+{
+	if(buffer == NULL) return -1;
+
+	pthread_mutex_lock(&(buffer->lock));
+	int addedCount = JInsertBufferMerge(buffer);
+	pthread_mutex_unlock(&(buffer->lock));
+
+	return addedCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JInsertBuffer Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JInsertBufferSearch(const JInsertBufferPtr buffer, const void *key, int *isFound)
+ * @brief 정렬된 버퍼에서 키의 위치를 이진 탐색으로 찾는 함수 (버퍼 잠금을 잡은 상태에서 호출)
+ * @param buffer 삽입 버퍼 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @param isFound 같은 키가 있으면 1, 없으면 0 저장(출력)
+ * @return 같은 키의 위치, 없으면 키를 넣을 위치
+ */
+static int JInsertBufferSearch(const JInsertBufferPtr buffer, const void *key, int *isFound)
+{
+	int low = 0;
+	int high = buffer->count;
+
+	*isFound = 0;
+	while(low < high)
+	{
+		int middle = low + (high - low) / 2;
+		int compareResult = JAVLTreeCompare(buffer->owner->tree, buffer->keys[middle], key);
+		if(compareResult == 0)
+		{
+			*isFound = 1;
+			return middle;
+		}
+
+		if(compareResult < 0) low = middle + 1;
+		else high = middle;
+	}
+
+	return low;
+}
+
+/**
+ * @fn static int JInsertBufferMerge(JInsertBufferPtr buffer)
+ * @brief 버퍼의 키를 공유 트리 잠금을 한 번만 잡고 순서대로 추가한 뒤 버퍼를 비우는 함수 (버퍼 잠금을 잡은 상태에서 호출)
+ * 키가 정렬되어 있으므로 직전에 추가한 노드를 힌트로 사용해서 가까운 위치부터 찾는다.
+ * 추가에 실패하면 같은 키가 이미 있는 경우만 건너뛰고, 할당이나 로그 기록 실패면 멈춘다.
+ * 이때 합치지 못한 키는 버퍼 앞으로 옮겨서 남기므로 검색에서 계속 찾을 수 있고 다음에 다시 합친다.
+ * @param buffer 삽입 버퍼 구조체 객체의 주소(출력)
+ * @return 성공 시 공유 트리에 새로 추가된 키 개수, 합치지 못한 키가 남으면 -1 반환
+ */
+static int JInsertBufferMerge(JInsertBufferPtr buffer)
+{
+	if(buffer->count == 0) return 0;
+
+	JBufferedAVLTreePtr front = buffer->owner;
+	JNodePtr hint = NULL;
+	int addedCount = 0;
+	int index = 0;
+
+	pthread_mutex_lock(&(front->treeLock));
+	for(; index < buffer->count; index++)
+	{
+		JNodePtr newNode = JAVLTreeAddNodeHint(front->tree, hint, buffer->keys[index]);
+		if(newNode == NULL)
+		{
+			if(JAVLTreeFindNode(front->tree, buffer->keys[index]) == NULL) break;
+			continue;
+		}
+
+		hint = newNode;
+		addedCount++;
+	}
+	front->mergeCount++;
+	pthread_mutex_unlock(&(front->treeLock));
+
+	if(index < buffer->count)
+	{
+		memmove(buffer->keys, buffer->keys + index, sizeof(void*) * (size_t)(buffer->count - index));
+		buffer->count -= index;
+		return -1;
+	}
+
+	buffer->count = 0;
+	return addedCount;
+}
+
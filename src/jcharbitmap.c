@@ -0,0 +1,449 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../include/jcharbitmap.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 비트 위치 개수
+#define JCHAR_BITMAP_BIT_COUNT (JCHAR_BITMAP_WORD_COUNT * 64)
+// char 가 부호 있는 형이면 최상위 비트를 뒤집어서 비트 위치가 char 의 비교 순서를 따르게 한다.
+#define JCHAR_BITMAP_SIGN_FLIP ((CHAR_MIN < 0) ? 0x80U : 0x00U)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JCharBitmap Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JCharBitmapFindNextBit(const JCharBitmapPtr bitmap, int position);
+static int JCharBitmapFindPrevBit(const JCharBitmapPtr bitmap, int position);
+static int JCharBitmapCountBelow(const JCharBitmapPtr bitmap, int position);
+static FindResult JCharBitmapSetResult(int position, char *result);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int _GetBitPosition(const void *key);
+static char _GetBitKey(int position);
+static int _CountBits(unsigned long long word);
+static int _CountTrailingZeros(unsigned long long word);
+static int _CountLeadingZeros(unsigned long long word);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JCharBitmap
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JCharBitmapPtr NewJCharBitmap()
+ * @brief 비어 있는 새로운 char 비트맵 집합 구조체 객체를 생성하는 함수
+ * 작은 char 집합을 많이 만들 때 노드 할당 없이 32 바이트만 사용한다.
+ * 다른 구조체 안에 직접 두고 JCharBitmapClear 로 초기화해서 사용해도 된다.
+ * @return 성공 시 생성된 비트맵 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JCharBitmapPtr NewJCharBitmap()
+{
+	JCharBitmapPtr newBitmap = (JCharBitmapPtr)malloc(sizeof(JCharBitmap));
+	if(newBitmap == NULL)
+	{
+		return NULL;
+	}
+
+	JCharBitmapClear(newBitmap);
+	return newBitmap;
+}
+
+/**
+ * @fn DeleteResult DeleteJCharBitmap(JCharBitmapPtrContainer container)
+ * @brief char 비트맵 집합 구조체 객체를 삭제하는 함수
+ * @param container 비트맵 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJCharBitmap(JCharBitmapPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JCharBitmapClear(JCharBitmapPtr bitmap)
+ * @brief char 비트맵 집합의 모든 키를 지우는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+void JCharBitmapClear(JCharBitmapPtr bitmap)
+{
+	if(bitmap == NULL) return;
+	memset(bitmap->words, 0, sizeof(bitmap->words));
+}
+
+/**
+ * @fn int JCharBitmapGetSize(const JCharBitmapPtr bitmap)
+ * @brief char 비트맵 집합에 저장된 키 개수를 반환하는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
+ */
+int JCharBitmapGetSize(const JCharBitmapPtr bitmap)
+{
+	if(bitmap == NULL) return 0;
+	return JCharBitmapCountBelow(bitmap, JCHAR_BITMAP_BIT_COUNT);
+}
+
+/**
+ * @fn JCharBitmapPtr JCharBitmapAddKey(JCharBitmapPtr bitmap, const void *key)
+ * @brief char 비트맵 집합에 새로운 키를 추가하는 함수
+ * 키의 주소가 아닌 값을 비트로 표시하므로 호출한 쪽에서 키를 유지하지 않아도 된다.
+ * 중복 허용하지 않음
+ * @param bitmap 비트맵 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 비트맵 구조체의 주소, 실패 시 NULL 반환
+ */
+JCharBitmapPtr JCharBitmapAddKey(JCharBitmapPtr bitmap, const void *key)
+{
+	if(bitmap == NULL || key == NULL) return NULL;
+
+	int position = _GetBitPosition(key);
+	unsigned long long mask = 1ULL << (position & 63);
+	if(bitmap->words[position >> 6] & mask) return NULL;
+
+	bitmap->words[position >> 6] |= mask;
+	return bitmap;
+}
+
+/**
+ * @fn DeleteResult JCharBitmapDeleteKey(JCharBitmapPtr bitmap, const void *key)
+ * @brief char 비트맵 집합에서 지정한 키를 삭제하는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(출력)
+ * @param key 삭제할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JCharBitmapDeleteKey(JCharBitmapPtr bitmap, const void *key)
+{
+	if(bitmap == NULL || key == NULL) return DeleteFail;
+
+	int position = _GetBitPosition(key);
+	unsigned long long mask = 1ULL << (position & 63);
+	if((bitmap->words[position >> 6] & mask) == 0) return DeleteFail;
+
+	bitmap->words[position >> 6] &= ~mask;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn FindResult JCharBitmapFindKey(const JCharBitmapPtr bitmap, const void *key)
+ * @brief char 비트맵 집합에 지정한 키가 있는지 검색하는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapFindKey(const JCharBitmapPtr bitmap, const void *key)
+{
+	if(bitmap == NULL || key == NULL) return FindFail;
+
+	int position = _GetBitPosition(key);
+	return (bitmap->words[position >> 6] & (1ULL << (position & 63))) ? FindSuccess : FindFail;
+}
+
+/**
+ * @fn FindResult JCharBitmapGetMin(const JCharBitmapPtr bitmap, char *result)
+ * @brief char 비트맵 집합에서 가장 작은 키를 찾는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 비어 있으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapGetMin(const JCharBitmapPtr bitmap, char *result)
+{
+	if(bitmap == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindNextBit(bitmap, 0), result);
+}
+
+/**
+ * @fn FindResult JCharBitmapGetMax(const JCharBitmapPtr bitmap, char *result)
+ * @brief char 비트맵 집합에서 가장 큰 키를 찾는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 비어 있으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapGetMax(const JCharBitmapPtr bitmap, char *result)
+{
+	if(bitmap == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindPrevBit(bitmap, JCHAR_BITMAP_BIT_COUNT - 1), result);
+}
+
+/**
+ * @fn FindResult JCharBitmapCeiling(const JCharBitmapPtr bitmap, const void *key, char *result)
+ * @brief char 비트맵 집합에서 지정한 키보다 크거나 같은 키 중 가장 작은 키를 찾는 함수 (JAVLTreeCeiling 참고)
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapCeiling(const JCharBitmapPtr bitmap, const void *key, char *result)
+{
+	if(bitmap == NULL || key == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindNextBit(bitmap, _GetBitPosition(key)), result);
+}
+
+/**
+ * @fn FindResult JCharBitmapFloor(const JCharBitmapPtr bitmap, const void *key, char *result)
+ * @brief char 비트맵 집합에서 지정한 키보다 작거나 같은 키 중 가장 큰 키를 찾는 함수 (JAVLTreeFloor 참고)
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapFloor(const JCharBitmapPtr bitmap, const void *key, char *result)
+{
+	if(bitmap == NULL || key == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindPrevBit(bitmap, _GetBitPosition(key)), result);
+}
+
+/**
+ * @fn FindResult JCharBitmapSuccessor(const JCharBitmapPtr bitmap, const void *key, char *result)
+ * @brief char 비트맵 집합에서 지정한 키보다 큰 키 중 가장 작은 키를 찾는 함수 (JAVLTreeSuccessor 참고)
+ * 집합을 키 순서로 순회할 때는 JCharBitmapGetMin 다음에 이 함수를 반복해서 호출한다.
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapSuccessor(const JCharBitmapPtr bitmap, const void *key, char *result)
+{
+	if(bitmap == NULL || key == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindNextBit(bitmap, _GetBitPosition(key) + 1), result);
+}
+
+/**
+ * @fn FindResult JCharBitmapPredecessor(const JCharBitmapPtr bitmap, const void *key, char *result)
+ * @brief char 비트맵 집합에서 지정한 키보다 작은 키 중 가장 큰 키를 찾는 함수 (JAVLTreePredecessor 참고)
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @param result 찾은 키를 저장할 주소(출력)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCharBitmapPredecessor(const JCharBitmapPtr bitmap, const void *key, char *result)
+{
+	if(bitmap == NULL || key == NULL || result == NULL) return FindFail;
+	return JCharBitmapSetResult(JCharBitmapFindPrevBit(bitmap, _GetBitPosition(key) - 1), result);
+}
+
+/**
+ * @fn int JCharBitmapRank(const JCharBitmapPtr bitmap, const void *key)
+ * @brief char 비트맵 집합에서 지정한 키보다 작은 키의 개수를 구하는 함수
+ * 앞쪽 단어들과 기준 단어의 아래쪽 비트만 세므로 단어 4 개 이하만 읽는다.
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 키의 순위(0 부터 시작), 실패 시 0 반환
+ */
+int JCharBitmapRank(const JCharBitmapPtr bitmap, const void *key)
+{
+	if(bitmap == NULL || key == NULL) return 0;
+	return JCharBitmapCountBelow(bitmap, _GetBitPosition(key));
+}
+
+/**
+ * @fn int JCharBitmapCountRange(const JCharBitmapPtr bitmap, const void *lowKey, const void *highKey)
+ * @brief char 비트맵 집합에서 [lowKey, highKey] 범위에 있는 키의 개수를 구하는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lowKey 범위의 시작 키 주소(입력, 읽기 전용)
+ * @param highKey 범위의 끝 키 주소(입력, 읽기 전용)
+ * @return 성공 시 범위 안의 키 개수, 실패하거나 시작 키가 끝 키보다 크면 0 반환
+ */
+int JCharBitmapCountRange(const JCharBitmapPtr bitmap, const void *lowKey, const void *highKey)
+{
+	if(bitmap == NULL || lowKey == NULL || highKey == NULL) return 0;
+
+	int lowPosition = _GetBitPosition(lowKey);
+	int highPosition = _GetBitPosition(highKey);
+	if(lowPosition > highPosition) return 0;
+	return JCharBitmapCountBelow(bitmap, highPosition + 1) - JCharBitmapCountBelow(bitmap, lowPosition);
+}
+
+/**
+ * @fn void JCharBitmapInorderTraverse(const JCharBitmapPtr bitmap)
+ * @brief char 비트맵 집합의 키를 작은 순서로 출력하는 함수 (JAVLTreeInorderTraverse 와 같은 형식)
+ * @param bitmap 순회할 비트맵 (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JCharBitmapInorderTraverse(const JCharBitmapPtr bitmap)
+{
+	if(bitmap == NULL) return;
+
+	int position = JCharBitmapFindNextBit(bitmap, 0);
+	for(; position >= 0; position = JCharBitmapFindNextBit(bitmap, position + 1))
+	{
+		printf("%c ", _GetBitKey(position));
+	}
+	printf("\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JCharBitmap Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JCharBitmapFindNextBit(const JCharBitmapPtr bitmap, int position)
+ * @brief 지정한 위치부터 위쪽으로 켜진 첫 번째 비트를 찾는 함수
+ * 첫 단어의 아래쪽 비트를 가린 뒤 0 이 아닌 단어에서 최하위 비트 위치를 센다.
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 찾기 시작할 비트 위치, 범위를 넘으면 찾지 않음(입력)
+ * @return 찾으면 비트 위치, 없으면 -1 반환
+ */
+static int JCharBitmapFindNextBit(const JCharBitmapPtr bitmap, int position)
+{
+	if(position < 0) position = 0;
+	if(position >= JCHAR_BITMAP_BIT_COUNT) return -1;
+
+	int index = position >> 6;
+	unsigned long long word = bitmap->words[index] & (~0ULL << (position & 63));
+	while(word == 0)
+	{
+		if(++index == JCHAR_BITMAP_WORD_COUNT) return -1;
+		word = bitmap->words[index];
+	}
+	return (index << 6) + _CountTrailingZeros(word);
+}
+
+/**
+ * @fn static int JCharBitmapFindPrevBit(const JCharBitmapPtr bitmap, int position)
+ * @brief 지정한 위치부터 아래쪽으로 켜진 첫 번째 비트를 찾는 함수
+ * 첫 단어의 위쪽 비트를 가린 뒤 0 이 아닌 단어에서 최상위 비트 위치를 센다.
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 찾기 시작할 비트 위치, 음수면 찾지 않음(입력)
+ * @return 찾으면 비트 위치, 없으면 -1 반환
+ */
+static int JCharBitmapFindPrevBit(const JCharBitmapPtr bitmap, int position)
+{
+	if(position < 0) return -1;
+	if(position >= JCHAR_BITMAP_BIT_COUNT) position = JCHAR_BITMAP_BIT_COUNT - 1;
+
+	int index = position >> 6;
+	unsigned long long word = bitmap->words[index] & (~0ULL >> (63 - (position & 63)));
+	while(word == 0)
+	{
+		if(--index < 0) return -1;
+		word = bitmap->words[index];
+	}
+	return (index << 6) + 63 - _CountLeadingZeros(word);
+}
+
+/**
+ * @fn static int JCharBitmapCountBelow(const JCharBitmapPtr bitmap, int position)
+ * @brief 지정한 위치보다 아래에 켜진 비트의 개수를 세는 함수
+ * @param bitmap 비트맵 구조체 객체의 주소(입력, 읽기 전용)
+ * @param position 기준 비트 위치, JCHAR_BITMAP_BIT_COUNT 면 전체 개수(입력)
+ * @return 켜진 비트의 개수
+ */
+static int JCharBitmapCountBelow(const JCharBitmapPtr bitmap, int position)
+{
+	int count = 0;
+	int index = 0;
+
+	for(; index < (position >> 6); index++) count += _CountBits(bitmap->words[index]);
+	if((position & 63) != 0) count += _CountBits(bitmap->words[index] & ((1ULL << (position & 63)) - 1));
+	return count;
+}
+
+/**
+ * @fn static FindResult JCharBitmapSetResult(int position, char *result)
+ * @brief 찾은 비트 위치를 키로 바꿔 저장하는 함수
+ * @param position 찾은 비트 위치, 없으면 -1(입력)
+ * @param result 키를 저장할 주소(출력)
+ * @return 찾았으면 FindSuccess, 아니면 FindFail 반환
+ */
+static FindResult JCharBitmapSetResult(int position, char *result)
+{
+	if(position < 0) return FindFail;
+	*result = _GetBitKey(position);
+	return FindSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _GetBitPosition(const void *key)
+ * @brief char 키의 비트 위치를 구하는 함수
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 0 ~ 255 비트 위치
+ */
+static int _GetBitPosition(const void *key)
+{
+	return (int)((unsigned int)*((const unsigned char*)key) ^ JCHAR_BITMAP_SIGN_FLIP);
+}
+
+/**
+ * @fn static char _GetBitKey(int position)
+ * @brief 비트 위치의 char 키를 구하는 함수 (_GetBitPosition 의 역함수)
+ * @param position 0 ~ 255 비트 위치(입력)
+ * @return char 키
+ */
+static char _GetBitKey(int position)
+{
+	unsigned char value = (unsigned char)((unsigned int)position ^ JCHAR_BITMAP_SIGN_FLIP);
+	char key = 0;
+	memcpy(&key, &value, sizeof(char));
+	return key;
+}
+
+/**
+ * @fn static int _CountBits(unsigned long long word)
+ * @brief 켜진 비트의 개수를 세는 함수 (popcount)
+ * @param word 64 비트 단어(입력)
+ * @return 켜진 비트의 개수
+ */
+static int _CountBits(unsigned long long word)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @fn static int _CountTrailingZeros(unsigned long long word)
+ * @brief 최하위 비트부터 연속된 0 의 개수를 세는 함수 (0 이 아닌 단어만)
+ * @param word 64 비트 단어(입력)
+ * @return 최하위 켜진 비트의 위치
+ */
+static int _CountTrailingZeros(unsigned long long word)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(word);
+#else
+	return _CountBits((word & (0ULL - word)) - 1);
+#endif
+}
+
+/**
+ * @fn static int _CountLeadingZeros(unsigned long long word)
+ * @brief 최상위 비트부터 연속된 0 의 개수를 세는 함수 (0 이 아닌 단어만)
+ * @param word 64 비트 단어(입력)
+ * @return 63 - 최상위 켜진 비트의 위치
+ */
+static int _CountLeadingZeros(unsigned long long word)
+{
+#if defined(__GNUC__)
+	return __builtin_clzll(word);
+#else
+	word |= word >> 1;
+	word |= word >> 2;
+	word |= word >> 4;
+	word |= word >> 8;
+	word |= word >> 16;
+	word |= word >> 32;
+	return 64 - _CountBits(word);
+#endif
+}
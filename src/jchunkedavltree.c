@@ -0,0 +1,722 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jchunkedavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 루트부터 최하위 노드까지 경로의 최대 길이
+#define JCHUNK_MAX_HEIGHT 64
+// 비어 있는 칸의 순서 값, 어떤 키의 순서 값보다도 작지 않다.
+#define JCHUNK_EMPTY_RANK 0xFFFFFFFFFFFFFFFFULL
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JChunkedAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JChunkNodePtr JChunkedAVLTreeNewNode(JChunkedAVLTreePtr tree);
+static void JChunkedAVLTreeFreeNode(JChunkedAVLTreePtr tree, JChunkNodePtr node);
+static void JChunkedAVLTreeRebalance(JChunkedAVLTreePtr tree, JChunkNodePtr *path, int depth);
+static void JChunkNodeInsertAt(JChunkNodePtr node, int slot, void *key, unsigned long long rank);
+static void JChunkNodeRemoveAt(JChunkNodePtr node, int slot);
+static int JChunkNodeFindSlot(const JChunkNodePtr node, const void *key, unsigned long long rank, KeyType type, int *isFound);
+static int JChunkNodeGetHeight(const JChunkNodePtr node);
+static void JChunkNodeUpdateHeight(JChunkNodePtr node);
+static JChunkNodePtr JChunkNodeRotateLeft(JChunkNodePtr node);
+static JChunkNodePtr JChunkNodeRotateRight(JChunkNodePtr node);
+static JChunkNodePtr JChunkNodeRebalance(JChunkNodePtr node);
+static void JChunkNodeDeleteChilds(JChunkNodePtr node);
+static void JChunkNodeInorderTraverse(const JChunkNodePtr node, KeyType type);
+static unsigned long long _GetChunkRank(const void *key, KeyType type);
+static int _CompareChunkKey(const void *key, unsigned long long rank, const JChunkNodePtr node, int index, KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JChunkedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JChunkedAVLTreePtr NewJChunkedAVLTree(KeyType type)
+ * @brief 새로운 키 배열 노드 AVL Tree(T-Tree) 구조체 객체를 생성하는 함수
+ * 노드 하나에 JCHUNK_CAPACITY 개의 키를 정렬해서 저장하므로 트리 높이가 낮아지고,
+ * 노드 안에서는 연속된 순서 값 배열만 훑으므로 비교마다 다른 캐시 라인을 읽지 않는다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JChunkedAVLTreePtr NewJChunkedAVLTree(KeyType type)
+{
+	if(type != IntType && type != CharType && type != StringType) return NULL;
+
+	JChunkedAVLTreePtr newTree = (JChunkedAVLTreePtr)malloc(sizeof(JChunkedAVLTree));
+	if(newTree == NULL)
+	{
+		return NULL;
+	}
+
+	newTree->type = type;
+	newTree->root = NULL;
+	newTree->size = 0;
+	newTree->nodeCount = 0;
+	newTree->data = NULL;
+
+	return newTree;
+}
+
+/**
+ * @fn DeleteResult DeleteJChunkedAVLTree(JChunkedAVLTreePtrContainer container)
+ * @brief 키 배열 노드 AVL Tree 구조체 객체를 삭제하는 함수
+ * @param container AVL Tree 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJChunkedAVLTree(JChunkedAVLTreePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JChunkNodePtr rootNode = (*container)->root;
+	if(rootNode != NULL)
+	{
+		JChunkNodeDeleteChilds(rootNode);
+		free(rootNode);
+	}
+
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn unsigned int JChunkedAVLTreeGetSize(const JChunkedAVLTreePtr tree)
+ * @brief 키 배열 노드 AVL Tree 에 저장된 키 개수를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
+ */
+unsigned int JChunkedAVLTreeGetSize(const JChunkedAVLTreePtr tree)
+{
+	if(tree == NULL) return 0;
+	return tree->size;
+}
+
+/**
+ * @fn JChunkedAVLTreePtr JChunkedAVLTreeAddKey(JChunkedAVLTreePtr tree, void *key)
+ * @brief 키 배열 노드 AVL Tree 에 키를 추가하는 함수
+ * 키가 들어갈 노드에 빈 칸이 있으면 노드 안에서만 옮기므로 회전이 일어나지 않는다.
+ * 노드가 가득 찼으면 뒤쪽 절반을 새 노드로 옮겨서 바로 다음 순서 위치에 연결한다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JChunkedAVLTreePtr JChunkedAVLTreeAddKey(JChunkedAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+
+	unsigned long long rank = _GetChunkRank(key, tree->type);
+	JChunkNodePtr path[JCHUNK_MAX_HEIGHT];
+	int depth = 0;
+	int isFound = 0;
+	JChunkNodePtr node = tree->root;
+
+	if(node == NULL)
+	{
+		node = JChunkedAVLTreeNewNode(tree);
+		if(node == NULL) return NULL;
+
+		JChunkNodeInsertAt(node, 0, key, rank);
+		tree->root = node;
+		tree->size++;
+		return tree;
+	}
+
+	// 키를 포함하는 범위의 노드, 또는 키가 바로 앞이나 뒤에 붙을 노드까지 내려간다.
+	while(1)
+	{
+		if(_CompareChunkKey(key, rank, node, 0, tree->type) < 0 && node->left != NULL)
+		{
+			path[depth++] = node;
+			node = node->left;
+		}
+		else if(_CompareChunkKey(key, rank, node, node->count - 1, tree->type) > 0 && node->right != NULL)
+		{
+			path[depth++] = node;
+			node = node->right;
+		}
+		else break;
+	}
+
+	int slot = JChunkNodeFindSlot(node, key, rank, tree->type, &isFound);
+	if(isFound == 1) return NULL;
+
+	if(node->count < JCHUNK_CAPACITY)
+	{
+		JChunkNodeInsertAt(node, slot, key, rank);
+		tree->size++;
+		return tree;
+	}
+
+	JChunkNodePtr newNode = JChunkedAVLTreeNewNode(tree);
+	if(newNode == NULL) return NULL;
+
+	path[depth++] = node;
+	if(slot == 0 && node->left == NULL)
+	{
+		JChunkNodeInsertAt(newNode, 0, key, rank);
+		node->left = newNode;
+	}
+	else if(slot == node->count && node->right == NULL)
+	{
+		JChunkNodeInsertAt(newNode, 0, key, rank);
+		node->right = newNode;
+	}
+	else
+	{
+		int half = JCHUNK_CAPACITY / 2;
+		size_t moveCount = (size_t)(JCHUNK_CAPACITY - half);
+		memcpy(newNode->ranks, node->ranks + half, sizeof(unsigned long long) * moveCount);
+		memcpy(newNode->keys, node->keys + half, sizeof(void*) * moveCount);
+		memset(node->ranks + half, 0xFF, sizeof(unsigned long long) * moveCount);
+		memset(node->keys + half, 0, sizeof(void*) * moveCount);
+		newNode->count = JCHUNK_CAPACITY - half;
+		node->count = half;
+
+		if(slot <= half) JChunkNodeInsertAt(node, slot, key, rank);
+		else JChunkNodeInsertAt(newNode, slot - half, key, rank);
+
+		// 새 노드는 오른쪽 하위 트리의 가장 왼쪽(다음 순서 위치)에 연결한다.
+		if(node->right == NULL) node->right = newNode;
+		else
+		{
+			JChunkNodePtr currentNode = node->right;
+			while(currentNode->left != NULL)
+			{
+				path[depth++] = currentNode;
+				currentNode = currentNode->left;
+			}
+			path[depth++] = currentNode;
+			currentNode->left = newNode;
+		}
+	}
+
+	tree->size++;
+	JChunkedAVLTreeRebalance(tree, path, depth);
+	return tree;
+}
+
+/**
+ * @fn DeleteResult JChunkedAVLTreeDeleteKey(JChunkedAVLTreePtr tree, const void *key)
+ * @brief 키 배열 노드 AVL Tree 에서 지정한 키를 삭제하는 함수
+ * 노드에 다른 키가 남아 있으면 노드 안에서만 옮기고, 노드가 비었을 때만 노드를 삭제한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 삭제할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JChunkedAVLTreeDeleteKey(JChunkedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return DeleteFail;
+
+	unsigned long long rank = _GetChunkRank(key, tree->type);
+	JChunkNodePtr path[JCHUNK_MAX_HEIGHT];
+	int depth = 0;
+	int isFound = 0;
+	int slot = 0;
+	JChunkNodePtr node = tree->root;
+
+	while(node != NULL)
+	{
+		if(_CompareChunkKey(key, rank, node, 0, tree->type) < 0)
+		{
+			path[depth++] = node;
+			node = node->left;
+		}
+		else if(_CompareChunkKey(key, rank, node, node->count - 1, tree->type) > 0)
+		{
+			path[depth++] = node;
+			node = node->right;
+		}
+		else break;
+	}
+	if(node == NULL) return DeleteFail;
+
+	slot = JChunkNodeFindSlot(node, key, rank, tree->type, &isFound);
+	if(isFound == 0) return DeleteFail;
+
+	JChunkNodeRemoveAt(node, slot);
+	tree->size--;
+	if(node->count > 0) return DeleteSuccess;
+
+	JChunkNodePtr selectedNode = node;
+	JChunkNodePtr childNode = NULL;
+
+	// 자식 노드가 두 개 다 있는 경우, 다음 노드의 키 배열을 옮기고 다음 노드를 대신 삭제
+	if(node->left != NULL && node->right != NULL)
+	{
+		path[depth++] = node;
+		selectedNode = node->right;
+		while(selectedNode->left != NULL)
+		{
+			path[depth++] = selectedNode;
+			selectedNode = selectedNode->left;
+		}
+		memcpy(node->ranks, selectedNode->ranks, sizeof(node->ranks));
+		memcpy(node->keys, selectedNode->keys, sizeof(node->keys));
+		node->count = selectedNode->count;
+	}
+
+	if(selectedNode->left != NULL) childNode = selectedNode->left;
+	else childNode = selectedNode->right;
+
+	if(depth == 0) tree->root = childNode;
+	else if(path[depth - 1]->left == selectedNode) path[depth - 1]->left = childNode;
+	else path[depth - 1]->right = childNode;
+
+	JChunkedAVLTreeFreeNode(tree, selectedNode);
+	JChunkedAVLTreeRebalance(tree, path, depth);
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void* JChunkedAVLTreeFindKey(const JChunkedAVLTreePtr tree, const void *key)
+ * @brief 키 배열 노드 AVL Tree 에서 지정한 키를 찾는 함수
+ * 노드마다 첫 번째, 마지막 키와만 비교하며 내려가고, 키를 포함하는 노드 안에서만 배열을 훑는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
+ */
+void* JChunkedAVLTreeFindKey(const JChunkedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+
+	unsigned long long rank = _GetChunkRank(key, tree->type);
+	JChunkNodePtr node = tree->root;
+	int isFound = 0;
+
+	while(node != NULL)
+	{
+		if(_CompareChunkKey(key, rank, node, 0, tree->type) < 0) node = node->left;
+		else if(_CompareChunkKey(key, rank, node, node->count - 1, tree->type) > 0) node = node->right;
+		else
+		{
+			int slot = JChunkNodeFindSlot(node, key, rank, tree->type, &isFound);
+			return (isFound == 1) ? node->keys[slot] : NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn void* JChunkedAVLTreeGetMin(const JChunkedAVLTreePtr tree)
+ * @brief 키 배열 노드 AVL Tree 에서 가장 작은 키를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 작은 키의 주소, 실패 시 NULL 반환
+ */
+void* JChunkedAVLTreeGetMin(const JChunkedAVLTreePtr tree)
+{
+	if(tree == NULL || tree->root == NULL) return NULL;
+
+	JChunkNodePtr node = tree->root;
+	while(node->left != NULL) node = node->left;
+	return node->keys[0];
+}
+
+/**
+ * @fn void* JChunkedAVLTreeGetMax(const JChunkedAVLTreePtr tree)
+ * @brief 키 배열 노드 AVL Tree 에서 가장 큰 키를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 큰 키의 주소, 실패 시 NULL 반환
+ */
+void* JChunkedAVLTreeGetMax(const JChunkedAVLTreePtr tree)
+{
+	if(tree == NULL || tree->root == NULL) return NULL;
+
+	JChunkNodePtr node = tree->root;
+	while(node->right != NULL) node = node->right;
+	return node->keys[node->count - 1];
+}
+
+/**
+ * @fn void* JChunkedAVLTreeLowerBound(const JChunkedAVLTreePtr tree, const void *key)
+ * @brief 키 배열 노드 AVL Tree 에서 지정한 키보다 크거나 같은 키 중 가장 작은 키를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 찾은 키의 주소, 실패 시 NULL 반환
+ */
+void* JChunkedAVLTreeLowerBound(const JChunkedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+
+	unsigned long long rank = _GetChunkRank(key, tree->type);
+	JChunkNodePtr node = tree->root;
+	void *candidateKey = NULL;
+	int isFound = 0;
+
+	while(node != NULL)
+	{
+		if(_CompareChunkKey(key, rank, node, 0, tree->type) < 0)
+		{
+			candidateKey = node->keys[0];
+			node = node->left;
+		}
+		else if(_CompareChunkKey(key, rank, node, node->count - 1, tree->type) > 0) node = node->right;
+		else return node->keys[JChunkNodeFindSlot(node, key, rank, tree->type, &isFound)];
+	}
+
+	return candidateKey;
+}
+
+/**
+ * @fn void JChunkedAVLTreeInorderTraverse(const JChunkedAVLTreePtr tree)
+ * @brief 키 배열 노드 AVL Tree 를 중위 순회하며 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JChunkedAVLTreeInorderTraverse(const JChunkedAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JChunkNodeInorderTraverse(tree->root, tree->type);
+	printf("\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JChunkedAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JChunkNodePtr JChunkedAVLTreeNewNode(JChunkedAVLTreePtr tree)
+ * @brief 키가 없는 새 노드를 할당하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 할당된 노드의 주소, 실패 시 NULL 반환
+ */
+static JChunkNodePtr JChunkedAVLTreeNewNode(JChunkedAVLTreePtr tree)
+{
+	JChunkNodePtr newNode = (JChunkNodePtr)malloc(sizeof(JChunkNode));
+	if(newNode == NULL)
+	{
+		return NULL;
+	}
+
+	newNode->left = NULL;
+	newNode->right = NULL;
+	newNode->height = 1;
+	newNode->count = 0;
+	memset(newNode->ranks, 0xFF, sizeof(newNode->ranks));
+	memset(newNode->keys, 0, sizeof(newNode->keys));
+
+	tree->nodeCount++;
+	return newNode;
+}
+
+/**
+ * @fn static void JChunkedAVLTreeFreeNode(JChunkedAVLTreePtr tree, JChunkNodePtr node)
+ * @brief 트리에서 분리된 노드를 해제하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param node 해제할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JChunkedAVLTreeFreeNode(JChunkedAVLTreePtr tree, JChunkNodePtr node)
+{
+	free(node);
+	tree->nodeCount--;
+}
+
+/**
+ * @fn static void JChunkedAVLTreeRebalance(JChunkedAVLTreePtr tree, JChunkNodePtr *path, int depth)
+ * @brief 탐색 경로를 거꾸로 올라가며 높이를 갱신하고 균형을 맞추는 함수
+ * 하위 트리의 높이가 바뀌지 않으면 상위 노드들은 영향을 받지 않으므로 중간에 멈춘다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param path 루트부터 변경된 노드의 부모 노드까지의 노드 주소 배열(입력)
+ * @param depth 경로 길이(입력)
+ * @return 반환값 없음
+ */
+static void JChunkedAVLTreeRebalance(JChunkedAVLTreePtr tree, JChunkNodePtr *path, int depth)
+{
+	while(depth > 0)
+	{
+		JChunkNodePtr node = path[--depth];
+		int oldHeight = node->height;
+		JChunkNodePtr subRootNode = JChunkNodeRebalance(node);
+
+		if(subRootNode != node)
+		{
+			if(depth == 0) tree->root = subRootNode;
+			else if(path[depth - 1]->left == node) path[depth - 1]->left = subRootNode;
+			else path[depth - 1]->right = subRootNode;
+		}
+
+		if(subRootNode->height == oldHeight) break;
+	}
+}
+
+/**
+ * @fn static void JChunkNodeInsertAt(JChunkNodePtr node, int slot, void *key, unsigned long long rank)
+ * @brief 가득 차지 않은 노드의 지정한 위치에 키를 끼워 넣는 함수
+ * @param node 키를 넣을 노드의 주소(출력)
+ * @param slot 키를 넣을 위치(입력)
+ * @param key 넣을 키의 주소(입력)
+ * @param rank 넣을 키의 순서 값(입력)
+ * @return 반환값 없음
+ */
+static void JChunkNodeInsertAt(JChunkNodePtr node, int slot, void *key, unsigned long long rank)
+{
+	size_t moveCount = (size_t)(node->count - slot);
+
+	memmove(node->ranks + slot + 1, node->ranks + slot, sizeof(unsigned long long) * moveCount);
+	memmove(node->keys + slot + 1, node->keys + slot, sizeof(void*) * moveCount);
+	node->ranks[slot] = rank;
+	node->keys[slot] = key;
+	node->count++;
+}
+
+/**
+ * @fn static void JChunkNodeRemoveAt(JChunkNodePtr node, int slot)
+ * @brief 노드의 지정한 위치에 있는 키를 빼는 함수
+ * @param node 키를 뺄 노드의 주소(출력)
+ * @param slot 뺄 키의 위치(입력)
+ * @return 반환값 없음
+ */
+static void JChunkNodeRemoveAt(JChunkNodePtr node, int slot)
+{
+	size_t moveCount = (size_t)(node->count - slot - 1);
+
+	memmove(node->ranks + slot, node->ranks + slot + 1, sizeof(unsigned long long) * moveCount);
+	memmove(node->keys + slot, node->keys + slot + 1, sizeof(void*) * moveCount);
+	node->count--;
+	node->ranks[node->count] = JCHUNK_EMPTY_RANK;
+	node->keys[node->count] = NULL;
+}
+
+/**
+ * @fn static int JChunkNodeFindSlot(const JChunkNodePtr node, const void *key, unsigned long long rank, KeyType type, int *isFound)
+ * @brief 노드 안에서 키보다 크거나 같은 첫 번째 키의 위치를 찾는 함수
+ * 빈 칸의 순서 값은 가장 크므로, 분기 없이 배열 전체에서 작은 순서 값의 개수를 센다(컴파일러가 SIMD 로 바꿀 수 있다).
+ * 문자열은 앞 8 바이트가 같은 키들만 다시 strcmp 로 비교한다.
+ * @param node 찾을 노드의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @param rank 찾을 키의 순서 값(입력)
+ * @param type 키 데이터 유형(입력)
+ * @param isFound 같은 키가 있으면 1, 없으면 0(출력)
+ * @return 키가 들어갈 위치 (0 ~ count)
+ */
+static int JChunkNodeFindSlot(const JChunkNodePtr node, const void *key, unsigned long long rank, KeyType type, int *isFound)
+{
+	int slot = 0;
+	int index = 0;
+
+	for(; index < JCHUNK_CAPACITY; index++) slot += (node->ranks[index] < rank);
+
+	if(type == StringType)
+	{
+		while(slot < node->count && node->ranks[slot] == rank && strcmp((const char*)node->keys[slot], (const char*)key) < 0) slot++;
+	}
+
+	*isFound = (slot < node->count && _CompareChunkKey(key, rank, node, slot, type) == 0);
+	return slot;
+}
+
+/**
+ * @fn static int JChunkNodeGetHeight(const JChunkNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이를 반환하는 함수
+ * @param node 높이를 구할 노드(입력, 읽기 전용)
+ * @return 하위 트리의 높이, 노드가 없으면 0 반환
+ */
+static int JChunkNodeGetHeight(const JChunkNodePtr node)
+{
+	if(node == NULL) return 0;
+	return node->height;
+}
+
+/**
+ * @fn static void JChunkNodeUpdateHeight(JChunkNodePtr node)
+ * @brief 자식 노드들의 높이로 지정한 노드의 높이를 다시 계산하는 함수
+ * @param node 높이를 갱신할 노드(출력)
+ * @return 반환값 없음
+ */
+static void JChunkNodeUpdateHeight(JChunkNodePtr node)
+{
+	int leftHeight = JChunkNodeGetHeight(node->left);
+	int rightHeight = JChunkNodeGetHeight(node->right);
+	node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+}
+
+/**
+ * @fn static JChunkNodePtr JChunkNodeRotateLeft(JChunkNodePtr node)
+ * @brief 지정한 노드를 기준으로 왼쪽으로 회전하는 함수 (RR 인 상황)
+ * @param node 회전하기 위한 기준 노드(입력)
+ * @return 회전된 하위 트리의 루트 노드
+ */
+static JChunkNodePtr JChunkNodeRotateLeft(JChunkNodePtr node)
+{
+	JChunkNodePtr rightNode = node->right;
+
+	node->right = rightNode->left;
+	rightNode->left = node;
+
+	JChunkNodeUpdateHeight(node);
+	JChunkNodeUpdateHeight(rightNode);
+	return rightNode;
+}
+
+/**
+ * @fn static JChunkNodePtr JChunkNodeRotateRight(JChunkNodePtr node)
+ * @brief 지정한 노드를 기준으로 오른쪽으로 회전하는 함수 (LL 인 상황)
+ * @param node 회전하기 위한 기준 노드(입력)
+ * @return 회전된 하위 트리의 루트 노드
+ */
+static JChunkNodePtr JChunkNodeRotateRight(JChunkNodePtr node)
+{
+	JChunkNodePtr leftNode = node->left;
+
+	node->left = leftNode->right;
+	leftNode->right = node;
+
+	JChunkNodeUpdateHeight(node);
+	JChunkNodeUpdateHeight(leftNode);
+	return leftNode;
+}
+
+/**
+ * @fn static JChunkNodePtr JChunkNodeRebalance(JChunkNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이 균형을 맞추는 함수
+ * @param node 균형을 맞출 하위 트리의 루트 노드(입력)
+ * @return 하위 트리의 새로운 루트 노드
+ */
+static JChunkNodePtr JChunkNodeRebalance(JChunkNodePtr node)
+{
+	JChunkNodeUpdateHeight(node);
+	int heightDiff = JChunkNodeGetHeight(node->left) - JChunkNodeGetHeight(node->right);
+
+	if(heightDiff > 1)
+	{
+		if(JChunkNodeGetHeight(node->left->left) < JChunkNodeGetHeight(node->left->right))
+		{
+			node->left = JChunkNodeRotateLeft(node->left);
+		}
+		return JChunkNodeRotateRight(node);
+	}
+
+	if(heightDiff < -1)
+	{
+		if(JChunkNodeGetHeight(node->right->right) < JChunkNodeGetHeight(node->right->left))
+		{
+			node->right = JChunkNodeRotateRight(node->right);
+		}
+		return JChunkNodeRotateLeft(node);
+	}
+
+	return node;
+}
+
+/**
+ * @fn static void JChunkNodeDeleteChilds(JChunkNodePtr node)
+ * @brief 지정한 노드의 모든 하위 노드를 해제하는 함수(재귀)
+ * @param node 기준 노드(입력)
+ * @return 반환값 없음
+ */
+static void JChunkNodeDeleteChilds(JChunkNodePtr node)
+{
+	if(node->left != NULL)
+	{
+		JChunkNodeDeleteChilds(node->left);
+		free(node->left);
+	}
+
+	if(node->right != NULL)
+	{
+		JChunkNodeDeleteChilds(node->right);
+		free(node->right);
+	}
+}
+
+/**
+ * @fn static void JChunkNodeInorderTraverse(const JChunkNodePtr node, KeyType type)
+ * @brief 지정한 노드를 기준으로 중위 순회하며 키를 출력하는 함수(재귀)
+ * @param node 순회할 기준 노드(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JChunkNodeInorderTraverse(const JChunkNodePtr node, KeyType type)
+{
+	if(node == NULL) return;
+
+	JChunkNodeInorderTraverse(node->left, type);
+
+	int index = 0;
+	for(; index < node->count; index++)
+	{
+		switch(type)
+		{
+			case IntType:
+				printf("%d ", *((int*)(node->keys[index])));
+				break;
+			case CharType:
+				printf("%c ", *((char*)(node->keys[index])));
+				break;
+			case StringType:
+				printf("%s ", (char*)(node->keys[index]));
+				break;
+			default:
+				break;
+		}
+	}
+
+	JChunkNodeInorderTraverse(node->right, type);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static unsigned long long _GetChunkRank(const void *key, KeyType type)
+ * @brief 키의 순서를 그대로 유지하는 64 비트 순서 값을 구하는 함수
+ * 정수와 문자는 부호 비트를 뒤집어서 부호 없는 비교로 순서가 같도록 하고,
+ * 문자열은 앞 8 바이트를 큰 쪽부터 채운다(짧은 문자열은 0 으로 채움).
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 순서 값
+ */
+static unsigned long long _GetChunkRank(const void *key, KeyType type)
+{
+	unsigned long long rank = 0;
+	int index = 0;
+
+	switch(type)
+	{
+		case IntType:
+			return (unsigned long long)((unsigned int)*((const int*)key) ^ 0x80000000U);
+		case CharType:
+			return (unsigned long long)((unsigned char)*((const char*)key) ^ 0x80U);
+		case StringType:
+		{
+			const unsigned char *bytes = (const unsigned char*)key;
+			for(; index < 8; index++)
+			{
+				rank <<= 8;
+				if(*bytes != '\0') rank |= *(bytes++);
+			}
+			return rank;
+		}
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static int _CompareChunkKey(const void *key, unsigned long long rank, const JChunkNodePtr node, int index, KeyType type)
+ * @brief 키와 노드의 index 번째 키를 비교하는 함수
+ * 순서 값이 다르면 키를 읽지 않고 순서 값으로만 결정한다.
+ * @param key 비교할 키의 주소(입력, 읽기 전용)
+ * @param rank 비교할 키의 순서 값(입력)
+ * @param node 비교 대상 노드(입력, 읽기 전용)
+ * @param index 비교 대상 키의 위치(입력)
+ * @param type 키 데이터 유형(입력)
+ * @return 키가 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int _CompareChunkKey(const void *key, unsigned long long rank, const JChunkNodePtr node, int index, KeyType type)
+{
+	if(rank != node->ranks[index]) return (rank < node->ranks[index]) ? -1 : 1;
+	if(type != StringType) return 0;
+	return strcmp((const char*)key, (const char*)node->keys[index]);
+}
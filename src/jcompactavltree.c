@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jcompactavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 루트부터 최하위 노드까지 경로의 최대 길이 (32 비트 인덱스로 만들 수 있는 AVL Tree 높이보다 크다)
+#define JCOMPACT_MAX_HEIGHT 64
+// 처음 생성할 때 할당할 노드 배열의 크기
+#define JCOMPACT_INITIAL_CAPACITY 16U
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JCompactAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned int JCompactAVLTreeNewNode(JCompactAVLTreePtr tree, int key);
+static void JCompactAVLTreeFreeNode(JCompactAVLTreePtr tree, unsigned int index);
+static void JCompactAVLTreeUpdateHeight(JCompactAVLTreePtr tree, unsigned int index);
+static unsigned int JCompactAVLTreeRotateLeft(JCompactAVLTreePtr tree, unsigned int index);
+static unsigned int JCompactAVLTreeRotateRight(JCompactAVLTreePtr tree, unsigned int index);
+static unsigned int JCompactAVLTreeRebalanceNode(JCompactAVLTreePtr tree, unsigned int index);
+static void JCompactAVLTreeRebalance(JCompactAVLTreePtr tree, unsigned int *path, int depth);
+static void JCompactAVLTreeInorderTraverseNode(const JCompactAVLTreePtr tree, unsigned int index);
+static int _GetCompactKey(const void *key, KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JCompactAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JCompactAVLTreePtr NewJCompactAVLTree(KeyType type)
+ * @brief 노드들을 하나의 배열에 저장하는 새로운 AVL Tree 구조체 객체를 생성하는 함수
+ * 노드는 키 값과 32 비트 자식 인덱스, 높이만 저장하는 16 바이트 구조체이다.
+ * 키를 값으로 저장하므로 IntType, CharType 만 지원한다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JCompactAVLTreePtr NewJCompactAVLTree(KeyType type)
+{
+	if(type != IntType && type != CharType) return NULL;
+
+	JCompactAVLTreePtr newTree = (JCompactAVLTreePtr)malloc(sizeof(JCompactAVLTree));
+	if(newTree == NULL)
+	{
+		return NULL;
+	}
+
+	newTree->nodes = (JCompactNodePtr)malloc(sizeof(JCompactNode) * JCOMPACT_INITIAL_CAPACITY);
+	if(newTree->nodes == NULL)
+	{
+		free(newTree);
+		return NULL;
+	}
+
+	// 0 번 노드는 높이가 0 인 빈 노드로 사용해서 자식 노드 검사를 생략한다.
+	memset(&(newTree->nodes[JCOMPACT_NULL_INDEX]), 0, sizeof(JCompactNode));
+
+	newTree->type = type;
+	newTree->capacity = JCOMPACT_INITIAL_CAPACITY;
+	newTree->used = 1;
+	newTree->size = 0;
+	newTree->root = JCOMPACT_NULL_INDEX;
+	newTree->freeList = JCOMPACT_NULL_INDEX;
+	newTree->data = NULL;
+
+	return newTree;
+}
+
+/**
+ * @fn DeleteResult DeleteJCompactAVLTree(JCompactAVLTreePtrContainer container)
+ * @brief 배열 기반 AVL Tree 구조체 객체를 삭제하는 함수
+ * 노드 배열 하나만 해제하면 된다.
+ * @param container AVL Tree 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJCompactAVLTree(JCompactAVLTreePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->nodes);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JCompactAVLTreePtr JCompactAVLTreeReserve(JCompactAVLTreePtr tree, unsigned int capacity)
+ * @brief 지정한 개수의 키를 재할당 없이 저장할 수 있도록 노드 배열을 미리 늘리는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param capacity 저장할 키 개수(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JCompactAVLTreePtr JCompactAVLTreeReserve(JCompactAVLTreePtr tree, unsigned int capacity)
+{
+	if(tree == NULL || capacity == 0xFFFFFFFFU) return NULL;
+	if(capacity + 1 <= tree->capacity) return tree;
+
+	JCompactNodePtr newNodes = (JCompactNodePtr)realloc(tree->nodes, sizeof(JCompactNode) * ((size_t)capacity + 1));
+	if(newNodes == NULL) return NULL;
+
+	tree->nodes = newNodes;
+	tree->capacity = capacity + 1;
+	return tree;
+}
+
+/**
+ * @fn unsigned int JCompactAVLTreeGetSize(const JCompactAVLTreePtr tree)
+ * @brief 배열 기반 AVL Tree 에 저장된 키 개수를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
+ */
+unsigned int JCompactAVLTreeGetSize(const JCompactAVLTreePtr tree)
+{
+	if(tree == NULL) return 0;
+	return tree->size;
+}
+
+/**
+ * @fn JCompactAVLTreePtr JCompactAVLTreeAddKey(JCompactAVLTreePtr tree, const void *key)
+ * @brief 배열 기반 AVL Tree 에 새로운 키를 추가하는 함수
+ * 키의 주소가 아닌 값을 노드에 복사하므로 호출한 쪽에서 키를 유지하지 않아도 된다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JCompactAVLTreePtr JCompactAVLTreeAddKey(JCompactAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+
+	int value = _GetCompactKey(key, tree->type);
+	unsigned int path[JCOMPACT_MAX_HEIGHT];
+	int depth = 0;
+	unsigned int currentIndex = tree->root;
+
+	while(currentIndex != JCOMPACT_NULL_INDEX)
+	{
+		int nodeKey = tree->nodes[currentIndex].key;
+		if(nodeKey == value) return NULL;
+
+		path[depth++] = currentIndex;
+		if(nodeKey > value) currentIndex = tree->nodes[currentIndex].left;
+		else currentIndex = tree->nodes[currentIndex].right;
+	}
+
+	// 노드 배열이 재할당될 수 있으므로 노드 주소는 할당 이후에 구한다.
+	unsigned int newIndex = JCompactAVLTreeNewNode(tree, value);
+	if(newIndex == JCOMPACT_NULL_INDEX) return NULL;
+
+	if(depth == 0) tree->root = newIndex;
+	else
+	{
+		JCompactNodePtr parentNode = &(tree->nodes[path[depth - 1]]);
+		if(parentNode->key > value) parentNode->left = newIndex;
+		else parentNode->right = newIndex;
+	}
+
+	tree->size++;
+	JCompactAVLTreeRebalance(tree, path, depth);
+	return tree;
+}
+
+/**
+ * @fn DeleteResult JCompactAVLTreeDeleteKey(JCompactAVLTreePtr tree, const void *key)
+ * @brief 배열 기반 AVL Tree 에서 지정한 키를 삭제하는 함수
+ * 삭제된 노드 슬롯은 빈 슬롯 목록에 넣어서 다음 삽입 시 다시 사용한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 삭제할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JCompactAVLTreeDeleteKey(JCompactAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return DeleteFail;
+
+	int value = _GetCompactKey(key, tree->type);
+	unsigned int path[JCOMPACT_MAX_HEIGHT];
+	int depth = 0;
+	unsigned int currentIndex = tree->root;
+	JCompactNodePtr nodes = tree->nodes;
+
+	while(currentIndex != JCOMPACT_NULL_INDEX && nodes[currentIndex].key != value)
+	{
+		path[depth++] = currentIndex;
+		if(nodes[currentIndex].key > value) currentIndex = nodes[currentIndex].left;
+		else currentIndex = nodes[currentIndex].right;
+	}
+	if(currentIndex == JCOMPACT_NULL_INDEX) return DeleteFail;
+
+	unsigned int selectedIndex = currentIndex;
+	unsigned int childIndex = JCOMPACT_NULL_INDEX;
+
+	// 자식 노드가 두 개 다 있는 경우, 다음 키를 복사하고 다음 키의 노드를 대신 삭제
+	if(nodes[selectedIndex].left != JCOMPACT_NULL_INDEX && nodes[selectedIndex].right != JCOMPACT_NULL_INDEX)
+	{
+		path[depth++] = selectedIndex;
+		currentIndex = nodes[selectedIndex].right;
+		while(nodes[currentIndex].left != JCOMPACT_NULL_INDEX)
+		{
+			path[depth++] = currentIndex;
+			currentIndex = nodes[currentIndex].left;
+		}
+		nodes[selectedIndex].key = nodes[currentIndex].key;
+		selectedIndex = currentIndex;
+	}
+
+	if(nodes[selectedIndex].left != JCOMPACT_NULL_INDEX) childIndex = nodes[selectedIndex].left;
+	else childIndex = nodes[selectedIndex].right;
+
+	if(depth == 0) tree->root = childIndex;
+	else if(nodes[path[depth - 1]].left == selectedIndex) nodes[path[depth - 1]].left = childIndex;
+	else nodes[path[depth - 1]].right = childIndex;
+
+	JCompactAVLTreeFreeNode(tree, selectedIndex);
+	tree->size--;
+	JCompactAVLTreeRebalance(tree, path, depth);
+	return DeleteSuccess;
+}
+
+/**
+ * @fn FindResult JCompactAVLTreeFindKey(const JCompactAVLTreePtr tree, const void *key)
+ * @brief 배열 기반 AVL Tree 에 지정한 키가 있는지 검색하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JCompactAVLTreeFindKey(const JCompactAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return FindFail;
+
+	int value = _GetCompactKey(key, tree->type);
+	const JCompactNode *nodes = tree->nodes;
+	unsigned int currentIndex = tree->root;
+
+	while(currentIndex != JCOMPACT_NULL_INDEX)
+	{
+		int nodeKey = nodes[currentIndex].key;
+		if(nodeKey == value) return FindSuccess;
+
+		if(nodeKey > value) currentIndex = nodes[currentIndex].left;
+		else currentIndex = nodes[currentIndex].right;
+	}
+
+	return FindFail;
+}
+
+/**
+ * @fn void JCompactAVLTreeInorderTraverse(const JCompactAVLTreePtr tree)
+ * @brief 배열 기반 AVL Tree 를 중위 순회하며 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JCompactAVLTreeInorderTraverse(const JCompactAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JCompactAVLTreeInorderTraverseNode(tree, tree->root);
+	printf("\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JCompactAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static unsigned int JCompactAVLTreeNewNode(JCompactAVLTreePtr tree, int key)
+ * @brief 빈 슬롯 목록이나 배열 끝에서 새로운 노드 슬롯을 할당하는 함수
+ * 배열이 가득 차면 두 배로 늘린다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키 값(입력)
+ * @return 성공 시 할당된 노드 인덱스, 실패 시 JCOMPACT_NULL_INDEX 반환
+ */
+static unsigned int JCompactAVLTreeNewNode(JCompactAVLTreePtr tree, int key)
+{
+	unsigned int newIndex = JCOMPACT_NULL_INDEX;
+
+	if(tree->freeList != JCOMPACT_NULL_INDEX)
+	{
+		newIndex = tree->freeList;
+		tree->freeList = tree->nodes[newIndex].left;
+	}
+	else
+	{
+		if(tree->used == tree->capacity)
+		{
+			if(tree->capacity >= 0x80000000U) return JCOMPACT_NULL_INDEX;
+			if(JCompactAVLTreeReserve(tree, tree->capacity * 2 - 1) == NULL) return JCOMPACT_NULL_INDEX;
+		}
+		newIndex = tree->used++;
+	}
+
+	tree->nodes[newIndex].key = key;
+	tree->nodes[newIndex].left = JCOMPACT_NULL_INDEX;
+	tree->nodes[newIndex].right = JCOMPACT_NULL_INDEX;
+	tree->nodes[newIndex].height = 1;
+	return newIndex;
+}
+
+/**
+ * @fn static void JCompactAVLTreeFreeNode(JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 노드 슬롯을 빈 슬롯 목록에 넣는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param index 반환할 노드 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void JCompactAVLTreeFreeNode(JCompactAVLTreePtr tree, unsigned int index)
+{
+	tree->nodes[index].left = tree->freeList;
+	tree->nodes[index].right = JCOMPACT_NULL_INDEX;
+	tree->nodes[index].height = 0;
+	tree->freeList = index;
+}
+
+/**
+ * @fn static void JCompactAVLTreeUpdateHeight(JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 자식 노드들의 높이로 지정한 노드의 높이를 다시 계산하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param index 높이를 갱신할 노드 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void JCompactAVLTreeUpdateHeight(JCompactAVLTreePtr tree, unsigned int index)
+{
+	JCompactNodePtr node = &(tree->nodes[index]);
+	int leftHeight = tree->nodes[node->left].height;
+	int rightHeight = tree->nodes[node->right].height;
+	node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+}
+
+/**
+ * @fn static unsigned int JCompactAVLTreeRotateLeft(JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 지정한 노드를 기준으로 왼쪽으로 회전하는 함수 (RR 인 상황)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param index 회전하기 위한 기준 노드 인덱스(입력)
+ * @return 회전된 하위 트리의 루트 노드 인덱스
+ */
+static unsigned int JCompactAVLTreeRotateLeft(JCompactAVLTreePtr tree, unsigned int index)
+{
+	unsigned int rightIndex = tree->nodes[index].right;
+
+	tree->nodes[index].right = tree->nodes[rightIndex].left;
+	tree->nodes[rightIndex].left = index;
+
+	JCompactAVLTreeUpdateHeight(tree, index);
+	JCompactAVLTreeUpdateHeight(tree, rightIndex);
+	return rightIndex;
+}
+
+/**
+ * @fn static unsigned int JCompactAVLTreeRotateRight(JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 지정한 노드를 기준으로 오른쪽으로 회전하는 함수 (LL 인 상황)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param index 회전하기 위한 기준 노드 인덱스(입력)
+ * @return 회전된 하위 트리의 루트 노드 인덱스
+ */
+static unsigned int JCompactAVLTreeRotateRight(JCompactAVLTreePtr tree, unsigned int index)
+{
+	unsigned int leftIndex = tree->nodes[index].left;
+
+	tree->nodes[index].left = tree->nodes[leftIndex].right;
+	tree->nodes[leftIndex].right = index;
+
+	JCompactAVLTreeUpdateHeight(tree, index);
+	JCompactAVLTreeUpdateHeight(tree, leftIndex);
+	return leftIndex;
+}
+
+/**
+ * @fn static unsigned int JCompactAVLTreeRebalanceNode(JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이 균형을 맞추는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param index 균형을 맞출 하위 트리의 루트 노드 인덱스(입력)
+ * @return 하위 트리의 새로운 루트 노드 인덱스
+ */
+static unsigned int JCompactAVLTreeRebalanceNode(JCompactAVLTreePtr tree, unsigned int index)
+{
+	JCompactNodePtr nodes = tree->nodes;
+
+	JCompactAVLTreeUpdateHeight(tree, index);
+	int heightDiff = nodes[nodes[index].left].height - nodes[nodes[index].right].height;
+
+	if(heightDiff > 1)
+	{
+		unsigned int leftIndex = nodes[index].left;
+		if(nodes[nodes[leftIndex].left].height < nodes[nodes[leftIndex].right].height)
+		{
+			nodes[index].left = JCompactAVLTreeRotateLeft(tree, leftIndex);
+		}
+		return JCompactAVLTreeRotateRight(tree, index);
+	}
+
+	if(heightDiff < -1)
+	{
+		unsigned int rightIndex = nodes[index].right;
+		if(nodes[nodes[rightIndex].right].height < nodes[nodes[rightIndex].left].height)
+		{
+			nodes[index].right = JCompactAVLTreeRotateRight(tree, rightIndex);
+		}
+		return JCompactAVLTreeRotateLeft(tree, index);
+	}
+
+	return index;
+}
+
+/**
+ * @fn static void JCompactAVLTreeRebalance(JCompactAVLTreePtr tree, unsigned int *path, int depth)
+ * @brief 탐색 경로를 거꾸로 올라가며 높이를 갱신하고 균형을 맞추는 함수
+ * 하위 트리의 높이가 바뀌지 않으면 상위 노드들은 영향을 받지 않으므로 중간에 멈춘다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param path 루트부터 변경된 노드의 부모 노드까지의 인덱스 배열(입력)
+ * @param depth 경로 길이(입력)
+ * @return 반환값 없음
+ */
+static void JCompactAVLTreeRebalance(JCompactAVLTreePtr tree, unsigned int *path, int depth)
+{
+	while(depth > 0)
+	{
+		unsigned int index = path[--depth];
+		int oldHeight = tree->nodes[index].height;
+		unsigned int subRootIndex = JCompactAVLTreeRebalanceNode(tree, index);
+
+		if(subRootIndex != index)
+		{
+			if(depth == 0) tree->root = subRootIndex;
+			else if(tree->nodes[path[depth - 1]].left == index) tree->nodes[path[depth - 1]].left = subRootIndex;
+			else tree->nodes[path[depth - 1]].right = subRootIndex;
+		}
+
+		if(tree->nodes[subRootIndex].height == oldHeight) break;
+	}
+}
+
+/**
+ * @fn static void JCompactAVLTreeInorderTraverseNode(const JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 지정한 노드를 기준으로 중위 순회하며 키를 출력하는 함수(재귀)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param index 순회할 기준 노드 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void JCompactAVLTreeInorderTraverseNode(const JCompactAVLTreePtr tree, unsigned int index)
+{
+	if(index == JCOMPACT_NULL_INDEX) return;
+
+	JCompactAVLTreeInorderTraverseNode(tree, tree->nodes[index].left);
+	if(tree->type == CharType) printf("%c ", (char)(tree->nodes[index].key));
+	else printf("%d ", tree->nodes[index].key);
+	JCompactAVLTreeInorderTraverseNode(tree, tree->nodes[index].right);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _GetCompactKey(const void *key, KeyType type)
+ * @brief 키 주소에서 노드에 저장할 정수 키 값을 읽는 함수
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return 노드에 저장할 키 값
+ */
+static int _GetCompactKey(const void *key, KeyType type)
+{
+	if(type == CharType) return (int)(*((const char*)key));
+	return *((const int*)key);
+}
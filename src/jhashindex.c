@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jhashindex.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JHashIndex Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JHashIndexPtr JHashIndexResize(JHashIndexPtr index, unsigned int capacity);
+static void JHashIndexPlace(JHashIndexPtr index, unsigned long long hash, JNodePtr node);
+static int JHashIndexIsSameKey(const void *key1, const void *key2, KeyType type);
+static void* JHashIndexAlloc(const JAVLTreeAllocator *allocator, size_t size);
+static void JHashIndexFree(const JAVLTreeAllocator *allocator, void *pointer);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JHashIndex
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JHashIndexPtr NewJHashIndex(KeyType type, unsigned int capacity)
+ * @brief 새로운 해시 색인 구조체 객체를 생성하는 함수
+ * @param type 키 데이터 유형, JAVLTreeHashKey 로 해시 값을 구할 수 있는 유형만 가능(입력)
+ * @param capacity 처음 칸 개수, 2 의 거듭제곱으로 올림, 0 이면 JHASH_INDEX_DEFAULT_CAPACITY(입력)
+ * @return 성공 시 생성된 해시 색인 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JHashIndexPtr NewJHashIndex(KeyType type, unsigned int capacity)
+{
+	return NewJHashIndexEx(type, capacity, NULL);
+}
+
+/**
+ * @fn JHashIndexPtr NewJHashIndexEx(KeyType type, unsigned int capacity, const JAVLTreeAllocatorPtr allocator)
+ * @brief 할당자를 지정해서 새로운 해시 색인 구조체 객체를 생성하는 함수
+ * 해시 색인 구조체와 칸 배열을 모두 지정한 할당자로 할당한다.
+ * @param type 키 데이터 유형, JAVLTreeHashKey 로 해시 값을 구할 수 있는 유형만 가능(입력)
+ * @param capacity 처음 칸 개수, 2 의 거듭제곱으로 올림, 0 이면 JHASH_INDEX_DEFAULT_CAPACITY(입력)
+ * @param allocator 메모리 할당자, NULL 이면 malloc, free(입력, 읽기 전용)
+ * @return 성공 시 생성된 해시 색인 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JHashIndexPtr NewJHashIndexEx(KeyType type, unsigned int capacity, const JAVLTreeAllocatorPtr allocator)
+{
+	if(type != IntType && type != CharType && type != StringType && type != IntervalType) return NULL;
+	if(capacity > 0x40000000U) return NULL;
+	if(capacity == 0) capacity = JHASH_INDEX_DEFAULT_CAPACITY;
+
+	JAVLTreeAllocator indexAllocator;
+	memset(&indexAllocator, 0, sizeof(JAVLTreeAllocator));
+	if(allocator != NULL) indexAllocator = *allocator;
+
+	JHashIndexPtr newIndex = (JHashIndexPtr)JHashIndexAlloc(&indexAllocator, sizeof(JHashIndex));
+	if(newIndex == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned int slotCount = JHASH_INDEX_DEFAULT_CAPACITY;
+	while(slotCount < capacity) slotCount <<= 1;
+
+	newIndex->slots = (JHashSlotPtr)JHashIndexAlloc(&indexAllocator, sizeof(JHashSlot) * slotCount);
+	if(newIndex->slots == NULL)
+	{
+		JHashIndexFree(&indexAllocator, newIndex);
+		return NULL;
+	}
+	memset(newIndex->slots, 0, sizeof(JHashSlot) * slotCount);
+
+	newIndex->allocator = indexAllocator;
+	newIndex->type = type;
+	newIndex->mask = slotCount - 1;
+	newIndex->count = 0;
+
+	return newIndex;
+}
+
+/**
+ * @fn DeleteResult DeleteJHashIndex(JHashIndexPtrContainer container)
+ * @brief 해시 색인 구조체 객체를 삭제하는 함수 (노드는 해제하지 않음)
+ * @param container 해시 색인 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJHashIndex(JHashIndexPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JAVLTreeAllocator allocator = (*container)->allocator;
+	JHashIndexFree(&allocator, (*container)->slots);
+	JHashIndexFree(&allocator, *container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JHashIndexClear(JHashIndexPtr index)
+ * @brief 해시 색인의 모든 칸을 비우는 함수 (칸 개수는 유지)
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+void JHashIndexClear(JHashIndexPtr index)
+{
+	if(index == NULL) return;
+
+	memset(index->slots, 0, sizeof(JHashSlot) * ((size_t)index->mask + 1));
+	index->count = 0;
+}
+
+/**
+ * @fn JHashIndexPtr JHashIndexAdd(JHashIndexPtr index, JNodePtr node)
+ * @brief 해시 색인에 노드를 추가하는 함수
+ * 같은 키를 가진 노드가 이미 있으면 새 노드로 바꾼다.
+ * 사용 비율이 JHASH_INDEX_MAX_LOAD_PERCENT 를 넘으면 칸 배열을 두 배로 늘리고,
+ * 늘리지 못해도 빈 칸이 남아 있으면 그대로 추가한다.
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @param node 추가할 노드, 키가 설정되어 있어야 함(입력)
+ * @return 성공 시 해시 색인 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashIndexPtr JHashIndexAdd(JHashIndexPtr index, JNodePtr node)
+{
+	if(index == NULL || node == NULL || node->key == NULL) return NULL;
+
+	unsigned long long hash = JAVLTreeHashKey(node->key, index->type);
+	unsigned int position = (unsigned int)hash & index->mask;
+
+	for(; index->slots[position].node != NULL; position = (position + 1) & index->mask)
+	{
+		JHashSlotPtr slot = &index->slots[position];
+		if(slot->hash == hash && (slot->node == node || JHashIndexIsSameKey(slot->node->key, node->key, index->type) == 1))
+		{
+			slot->node = node;
+			return index;
+		}
+	}
+
+	unsigned long long slotCount = (unsigned long long)index->mask + 1;
+	if(((unsigned long long)index->count + 1) * 100 > slotCount * JHASH_INDEX_MAX_LOAD_PERCENT)
+	{
+		if(JHashIndexResize(index, (unsigned int)(slotCount * 2)) == NULL && (unsigned long long)index->count + 1 >= slotCount)
+		{
+			return NULL;
+		}
+	}
+
+	JHashIndexPlace(index, hash, node);
+	index->count++;
+	return index;
+}
+
+/**
+ * @fn DeleteResult JHashIndexRemove(JHashIndexPtr index, const JNodePtr node)
+ * @brief 해시 색인에서 노드를 지우는 함수
+ * 지운 칸 뒤로 이어지는 칸 중 원래 위치가 지운 칸 이전인 항목을 앞으로 당겨서 탐사 순서를 유지한다.
+ * 노드를 해제하거나 키를 바꾸기 전에 호출해야 한다.
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @param node 지울 노드의 주소(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JHashIndexRemove(JHashIndexPtr index, const JNodePtr node)
+{
+	if(index == NULL || node == NULL || node->key == NULL) return DeleteFail;
+
+	unsigned long long hash = JAVLTreeHashKey(node->key, index->type);
+	unsigned int position = (unsigned int)hash & index->mask;
+
+	for(; index->slots[position].node != node; position = (position + 1) & index->mask)
+	{
+		if(index->slots[position].node == NULL) return DeleteFail;
+	}
+
+	unsigned int next = position;
+	while(1)
+	{
+		next = (next + 1) & index->mask;
+		if(index->slots[next].node == NULL) break;
+
+		unsigned int home = (unsigned int)index->slots[next].hash & index->mask;
+		if(((next - home) & index->mask) >= ((next - position) & index->mask))
+		{
+			index->slots[position] = index->slots[next];
+			position = next;
+		}
+	}
+
+	index->slots[position].node = NULL;
+	index->count--;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JHashIndexFind(const JHashIndexPtr index, const void *key)
+ * @brief 해시 색인에서 키를 가진 노드를 찾는 함수
+ * @param index 해시 색인 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 찾은 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JHashIndexFind(const JHashIndexPtr index, const void *key)
+{
+	if(index == NULL || key == NULL) return NULL;
+
+	unsigned long long hash = JAVLTreeHashKey(key, index->type);
+	unsigned int position = (unsigned int)hash & index->mask;
+
+	for(; index->slots[position].node != NULL; position = (position + 1) & index->mask)
+	{
+		JHashSlotPtr slot = &index->slots[position];
+		if(slot->hash == hash && JHashIndexIsSameKey(slot->node->key, key, index->type) == 1) return slot->node;
+	}
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JHashIndex Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JHashIndexPtr JHashIndexResize(JHashIndexPtr index, unsigned int capacity)
+ * @brief 칸 배열을 새로 할당하고 모든 노드를 다시 배치하는 함수
+ * 저장된 해시 값을 다시 사용하므로 키를 다시 읽지 않는다.
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @param capacity 새 칸 개수, 2 의 거듭제곱(입력)
+ * @return 성공 시 해시 색인 구조체의 주소, 실패 시 NULL 반환 (실패하면 그대로 유지)
+ */
+static JHashIndexPtr JHashIndexResize(JHashIndexPtr index, unsigned int capacity)
+{
+	if(capacity == 0 || capacity > 0x40000000U) return NULL;
+
+	JHashSlotPtr newSlots = (JHashSlotPtr)JHashIndexAlloc(&(index->allocator), sizeof(JHashSlot) * capacity);
+	if(newSlots == NULL) return NULL;
+	memset(newSlots, 0, sizeof(JHashSlot) * capacity);
+
+	JHashSlotPtr oldSlots = index->slots;
+	unsigned int oldCount = index->mask + 1;
+	unsigned int position = 0;
+
+	index->slots = newSlots;
+	index->mask = capacity - 1;
+	for(; position < oldCount; position++)
+	{
+		if(oldSlots[position].node != NULL) JHashIndexPlace(index, oldSlots[position].hash, oldSlots[position].node);
+	}
+
+	JHashIndexFree(&(index->allocator), oldSlots);
+	return index;
+}
+
+/**
+ * @fn static void JHashIndexPlace(JHashIndexPtr index, unsigned long long hash, JNodePtr node)
+ * @brief 해시 값의 위치부터 처음 만나는 빈 칸에 노드를 넣는 함수 (빈 칸이 있어야 함)
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @param hash 노드 키의 해시 값(입력)
+ * @param node 넣을 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JHashIndexPlace(JHashIndexPtr index, unsigned long long hash, JNodePtr node)
+{
+	unsigned int position = (unsigned int)hash & index->mask;
+	while(index->slots[position].node != NULL) position = (position + 1) & index->mask;
+
+	index->slots[position].hash = hash;
+	index->slots[position].node = node;
+}
+
+/**
+ * @fn static int JHashIndexIsSameKey(const void *key1, const void *key2, KeyType type)
+ * @brief 두 키가 같은지 검사하는 함수
+ * @param key1 비교할 키의 주소(입력, 읽기 전용)
+ * @param key2 비교할 키의 주소(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 같으면 1, 다르면 0 반환
+ */
+static int JHashIndexIsSameKey(const void *key1, const void *key2, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return *((const int*)key1) == *((const int*)key2);
+		case CharType:
+			return *((const char*)key1) == *((const char*)key2);
+		case StringType:
+			return strcmp((const char*)key1, (const char*)key2) == 0;
+		case IntervalType:
+			return ((const JInterval*)key1)->start == ((const JInterval*)key2)->start
+				&& ((const JInterval*)key1)->end == ((const JInterval*)key2)->end;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static void* JHashIndexAlloc(const JAVLTreeAllocator *allocator, size_t size)
+ * @brief 할당자로 메모리를 할당하는 함수
+ * @param allocator 메모리 할당자, 함수가 NULL 이면 malloc(입력, 읽기 전용)
+ * @param size 할당할 바이트 수(입력)
+ * @return 성공 시 할당된 메모리의 주소, 실패 시 NULL 반환
+ */
+static void* JHashIndexAlloc(const JAVLTreeAllocator *allocator, size_t size)
+{
+	if(allocator->alloc == NULL) return malloc(size);
+	return allocator->alloc(size, allocator->context);
+}
+
+/**
+ * @fn static void JHashIndexFree(const JAVLTreeAllocator *allocator, void *pointer)
+ * @brief 할당자로 할당한 메모리를 해제하는 함수
+ * @param allocator 메모리 할당자, 함수가 NULL 이면 free(입력, 읽기 전용)
+ * @param pointer 해제할 메모리의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JHashIndexFree(const JAVLTreeAllocator *allocator, void *pointer)
+{
+	if(allocator->free == NULL) free(pointer);
+	else allocator->free(pointer, allocator->context);
+}
@@ -0,0 +1,275 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jingestqueue.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JIngestQueue Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void* JIngestQueueRunWriter(void *userData);
+static int JIngestQueueApplyBatch(JIngestQueuePtr queue);
+static void JIngestQueueWakeWriter(JIngestQueuePtr queue);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JIngestQueue
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JIngestQueuePtr NewJIngestQueue(JAVLTreePtr tree, unsigned int capacity, int batchSize)
+ * @brief 작업 큐를 생성하고 작업을 반영할 쓰기 스레드를 시작하는 함수
+ * 큐가 살아 있는 동안 트리는 쓰기 스레드만 사용하므로, 다른 스레드는 IngestFind 작업으로 검색해야 한다.
+ * @param tree 작업을 반영할 AVL Tree 구조체 객체의 주소(입력)
+ * @param capacity 칸 개수, 2 의 거듭제곱으로 올림, 0 이면 JINGEST_QUEUE_DEFAULT_CAPACITY(입력)
+ * @param batchSize 한 번에 꺼내서 반영할 최대 작업 개수, 0 이면 JINGEST_QUEUE_DEFAULT_BATCH_SIZE(입력)
+ * @return 성공 시 생성된 작업 큐 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JIngestQueuePtr NewJIngestQueue(JAVLTreePtr tree, unsigned int capacity, int batchSize)
+{
+	if(tree == NULL || batchSize < 0 || capacity > 0x40000000U) return NULL;
+	if(capacity == 0) capacity = JINGEST_QUEUE_DEFAULT_CAPACITY;
+	if(batchSize == 0) batchSize = JINGEST_QUEUE_DEFAULT_BATCH_SIZE;
+
+	JIngestQueuePtr newQueue = (JIngestQueuePtr)malloc(sizeof(JIngestQueue));
+	if(newQueue == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned long long slotCount = 2;
+	unsigned long long position = 0;
+	while(slotCount < capacity) slotCount <<= 1;
+
+	newQueue->slots = (JIngestSlotPtr)malloc(sizeof(JIngestSlot) * (size_t)slotCount);
+	if(newQueue->slots == NULL)
+	{
+		free(newQueue);
+		return NULL;
+	}
+	for(; position < slotCount; position++) newQueue->slots[position].sequence = position;
+
+	newQueue->tree = tree;
+	newQueue->mask = slotCount - 1;
+	newQueue->tail = 0;
+	newQueue->head = 0;
+	newQueue->batchSize = batchSize;
+	newQueue->appliedCount = 0;
+	newQueue->isSleeping = 0;
+	newQueue->isStopping = 0;
+
+	pthread_mutex_init(&(newQueue->waitLock), NULL);
+	pthread_cond_init(&(newQueue->wakeCond), NULL);
+	pthread_cond_init(&(newQueue->doneCond), NULL);
+	if(pthread_create(&(newQueue->writer), NULL, JIngestQueueRunWriter, newQueue) != 0)
+	{
+		pthread_cond_destroy(&(newQueue->doneCond));
+		pthread_cond_destroy(&(newQueue->wakeCond));
+		pthread_mutex_destroy(&(newQueue->waitLock));
+		free(newQueue->slots);
+		free(newQueue);
+		return NULL;
+	}
+
+	return newQueue;
+}
+
+/**
+ * @fn DeleteResult DeleteJIngestQueue(JIngestQueuePtrContainer container)
+ * @brief 남은 작업을 모두 반영하고 쓰기 스레드를 끝낸 뒤 작업 큐 구조체 객체를 삭제하는 함수
+ * 다른 스레드가 더 이상 작업을 넣지 않을 때 호출해야 하며, 트리는 해제하지 않는다.
+ * @param container 작업 큐 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJIngestQueue(JIngestQueuePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JIngestQueuePtr queue = *container;
+
+	pthread_mutex_lock(&(queue->waitLock));
+	__atomic_store_n(&(queue->isStopping), 1, __ATOMIC_SEQ_CST);
+	pthread_cond_signal(&(queue->wakeCond));
+	pthread_mutex_unlock(&(queue->waitLock));
+	pthread_join(queue->writer, NULL);
+
+	pthread_cond_destroy(&(queue->doneCond));
+	pthread_cond_destroy(&(queue->wakeCond));
+	pthread_mutex_destroy(&(queue->waitLock));
+	free(queue->slots);
+	free(queue);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JIngestQueuePtr JIngestQueueSubmit(JIngestQueuePtr queue, JIngestOperation operation, void *key, JIngestCallback callback, void *userData)
+ * @brief 작업 큐에 작업을 넣는 함수 (여러 스레드에서 잠금 없이 동시에 호출 가능)
+ * 빈 칸을 CAS 로 잡아서 채운 뒤 순서 번호를 바꿔서 쓰기 스레드에 넘긴다.
+ * 쓰기 스레드가 기다리고 있을 때만 잠금을 잡고 깨운다.
+ * @param queue 작업 큐 구조체 객체의 주소(출력)
+ * @param operation 작업 종류(입력)
+ * @param key 작업할 키의 주소, 작업이 반영될 때까지 유지되어야 함(입력)
+ * @param callback 작업이 반영되면 쓰기 스레드에서 호출할 함수, 필요 없으면 NULL(입력)
+ * @param userData 작업 완료 함수에 전달할 사용자 데이터(입력)
+ * @return 성공 시 작업 큐 구조체의 주소, 큐가 가득 찼거나 실패 시 NULL 반환 (가득 차면 나중에 다시 넣어야 함)
+ */
+JIngestQueuePtr JIngestQueueSubmit(JIngestQueuePtr queue, JIngestOperation operation, void *key, JIngestCallback callback, void *userData)
+{
+	if(queue == NULL || key == NULL) return NULL;
+	if(operation != IngestInsert && operation != IngestDelete && operation != IngestFind) return NULL;
+
+	JIngestSlotPtr slot = NULL;
+	unsigned long long position = __atomic_load_n(&(queue->tail), __ATOMIC_RELAXED);
+
+	while(1)
+	{
+		slot = &(queue->slots[position & queue->mask]);
+		long long diff = (long long)(__atomic_load_n(&(slot->sequence), __ATOMIC_ACQUIRE) - position);
+
+		if(diff == 0)
+		{
+			// 실패하면 position 이 현재 값으로 바뀌므로 다시 시도한다.
+			if(__atomic_compare_exchange_n(&(queue->tail), &position, position + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+		}
+		else if(diff < 0) return NULL;
+		else position = __atomic_load_n(&(queue->tail), __ATOMIC_RELAXED);
+	}
+
+	slot->operation = operation;
+	slot->key = key;
+	slot->callback = callback;
+	slot->userData = userData;
+	// 칸 공개와 isSleeping 확인 순서가 바뀌면 잠들려는 쓰기 스레드를 놓칠 수 있으므로 SEQ_CST 로 저장한다.
+	__atomic_store_n(&(slot->sequence), position + 1, __ATOMIC_SEQ_CST);
+
+	if(__atomic_load_n(&(queue->isSleeping), __ATOMIC_SEQ_CST) == 1) JIngestQueueWakeWriter(queue);
+	return queue;
+}
+
+/**
+ * @fn void JIngestQueueSync(JIngestQueuePtr queue)
+ * @brief 호출하기 전에 넣은 작업이 모두 반영될 때까지 기다리는 함수
+ * @param queue 작업 큐 구조체 객체의 주소(입력)
+ * @return 반환값 없음
+ */
+void JIngestQueueSync(JIngestQueuePtr queue)
+{
+	if(queue == NULL) return;
+
+	unsigned long long target = __atomic_load_n(&(queue->tail), __ATOMIC_SEQ_CST);
+
+	pthread_mutex_lock(&(queue->waitLock));
+	while(__atomic_load_n(&(queue->appliedCount), __ATOMIC_ACQUIRE) < target)
+	{
+		pthread_cond_signal(&(queue->wakeCond));
+		pthread_cond_wait(&(queue->doneCond), &(queue->waitLock));
+	}
+	pthread_mutex_unlock(&(queue->waitLock));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JIngestQueue Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void* JIngestQueueRunWriter(void *userData)
+ * @brief 큐에서 작업을 꺼내 트리에 반영하는 쓰기 스레드 함수
+ * 큐가 비면 isSleeping 을 켜고 다시 확인한 뒤 기다리므로, 그 사이에 들어온 작업을 놓치지 않는다.
+ * 끝내라는 요청을 받으면 남은 작업을 모두 반영하고 끝난다.
+ * @param userData 작업 큐 구조체 객체의 주소(입력)
+ * @return 항상 NULL 반환
+ */
+static void* JIngestQueueRunWriter(void *userData)
+{
+	JIngestQueuePtr queue = (JIngestQueuePtr)userData;
+
+	while(1)
+	{
+		if(JIngestQueueApplyBatch(queue) > 0) continue;
+
+		pthread_mutex_lock(&(queue->waitLock));
+		__atomic_store_n(&(queue->isSleeping), 1, __ATOMIC_SEQ_CST);
+		JIngestSlotPtr slot = &(queue->slots[queue->head & queue->mask]);
+		int isEmpty = (__atomic_load_n(&(slot->sequence), __ATOMIC_SEQ_CST) != queue->head + 1);
+		int isStopping = __atomic_load_n(&(queue->isStopping), __ATOMIC_SEQ_CST);
+
+		if(isEmpty && isStopping == 1)
+		{
+			pthread_mutex_unlock(&(queue->waitLock));
+			break;
+		}
+		if(isEmpty) pthread_cond_wait(&(queue->wakeCond), &(queue->waitLock));
+		__atomic_store_n(&(queue->isSleeping), 0, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(queue->waitLock));
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static int JIngestQueueApplyBatch(JIngestQueuePtr queue)
+ * @brief 큐에서 batchSize 개까지 작업을 꺼내 넣은 순서대로 트리에 반영하고 완료 함수를 호출하는 함수 (쓰기 스레드 전용)
+ * @param queue 작업 큐 구조체 객체의 주소(출력)
+ * @return 반영한 작업 개수
+ */
+static int JIngestQueueApplyBatch(JIngestQueuePtr queue)
+{
+	int appliedCount = 0;
+
+	for(; appliedCount < queue->batchSize; appliedCount++)
+	{
+		JIngestSlotPtr slot = &(queue->slots[queue->head & queue->mask]);
+		if(__atomic_load_n(&(slot->sequence), __ATOMIC_ACQUIRE) != queue->head + 1) break;
+
+		JIngestOperation operation = slot->operation;
+		void *key = slot->key;
+		JIngestCallback callback = slot->callback;
+		void *callbackData = slot->userData;
+		int result = 0;
+
+		// 칸을 먼저 돌려주어서 완료 함수가 실행되는 동안에도 넣는 쪽이 기다리지 않게 한다.
+		__atomic_store_n(&(slot->sequence), queue->head + queue->mask + 1, __ATOMIC_RELEASE);
+		queue->head++;
+
+		if(operation == IngestInsert) result = (JAVLTreeAddNode(queue->tree, key) != NULL);
+		else if(operation == IngestDelete) result = (JAVLTreeDeleteNodeKey(queue->tree, key) == DeleteSuccess);
+		else
+		{
+			JNodePtr node = JAVLTreeFindNode(queue->tree, key);
+			if(node != NULL)
+			{
+				key = JNodeGetKey(node);
+				result = 1;
+			}
+		}
+
+		if(callback != NULL) callback(operation, key, result, callbackData);
+	}
+
+	if(appliedCount > 0)
+	{
+		// 반영을 기다리는 스레드가 있을 수 있으므로 배치마다 알린다.
+		pthread_mutex_lock(&(queue->waitLock));
+		__atomic_add_fetch(&(queue->appliedCount), (unsigned long long)appliedCount, __ATOMIC_RELEASE);
+		pthread_cond_broadcast(&(queue->doneCond));
+		pthread_mutex_unlock(&(queue->waitLock));
+	}
+
+	return appliedCount;
+}
+
+/**
+ * @fn static void JIngestQueueWakeWriter(JIngestQueuePtr queue)
+ * @brief 기다리고 있는 쓰기 스레드를 깨우는 함수
+ * @param queue 작업 큐 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JIngestQueueWakeWriter(JIngestQueuePtr queue)
+{
+	pthread_mutex_lock(&(queue->waitLock));
+	pthread_cond_signal(&(queue->wakeCond));
+	pthread_mutex_unlock(&(queue->waitLock));
+}
+
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "../include/jintervaltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Interval Tree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JIntervalTreeIdentity(void *aggregate, void *userData);
+static void JIntervalTreeLift(void *aggregate, const void *key, void *userData);
+static void JIntervalTreeCombine(void *result, const void *left, const void *right, void *userData);
+static int JIntervalTreeIsIntervalTree(const JAVLTreePtr tree);
+static JNodePtr JIntervalIteratorDescend(const JIntervalIteratorPtr iterator, JNodePtr node);
+static JNodePtr JIntervalIteratorStep(const JIntervalIteratorPtr iterator, JNodePtr node);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Interval Tree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JAVLTreePtr NewJIntervalTree()
+ * @brief 구간(JInterval)을 키로 저장하는 새로운 구간 트리 객체를 생성하는 함수
+ * IntervalType AVL Tree 에 하위 트리의 가장 큰 끝 값을 집계 값으로 설정한 것이며,
+ * 추가, 삭제, 해제는 JAVLTreeAddNode, JAVLTreeDeleteNodeKey, DeleteJAVLTree 를 그대로 사용한다.
+ * 집계 값은 회전과 균형을 맞추는 경로에서 함께 갱신된다. (JAVLTreeSetAugment 참고)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr NewJIntervalTree()
+{
+	JAVLTreePtr newTree = NewJAVLTree(IntervalType);
+	if(newTree == NULL)
+	{
+		return NULL;
+	}
+
+	JAVLTreeAugment augment;
+	augment.aggregateSize = sizeof(int);
+	augment.identity = JIntervalTreeIdentity;
+	augment.lift = JIntervalTreeLift;
+	augment.combine = JIntervalTreeCombine;
+	augment.userData = NULL;
+
+	if(JAVLTreeSetAugment(newTree, &augment) == NULL)
+	{
+		DeleteJAVLTree(&newTree);
+		return NULL;
+	}
+
+	return newTree;
+}
+
+/**
+ * @fn int JIntervalTreeGetMaxEnd(const JAVLTreePtr tree, const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리에 있는 구간들의 가장 큰 끝 값을 반환하는 함수
+ * @param tree 구간 트리 객체의 주소(입력, 읽기 전용)
+ * @param node 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @return 성공 시 가장 큰 끝 값, 실패 또는 빈 하위 트리이면 INT_MIN 반환
+ */
+int JIntervalTreeGetMaxEnd(const JAVLTreePtr tree, const JNodePtr node)
+{
+	if(JIntervalTreeIsIntervalTree(tree) == 0 || node == NULL) return INT_MIN;
+	return *((const int*)JAVLTreeGetAggregate(tree, node));
+}
+
+/**
+ * @fn JIntervalIteratorPtr JIntervalTreeStab(const JAVLTreePtr tree, int point, JIntervalIteratorPtr iterator)
+ * @brief 지정한 값을 포함하는 구간들을 찾는 반복자를 준비하는 함수
+ * @param tree 구간 트리 객체의 주소(입력, 읽기 전용)
+ * @param point 찾을 값(입력)
+ * @param iterator 준비할 반복자의 주소(출력)
+ * @return 성공 시 반복자의 주소, 실패 시 NULL 반환
+ */
+JIntervalIteratorPtr JIntervalTreeStab(const JAVLTreePtr tree, int point, JIntervalIteratorPtr iterator)
+{
+	return JIntervalTreeFindOverlap(tree, point, point, iterator);
+}
+
+/**
+ * @fn JIntervalIteratorPtr JIntervalTreeFindOverlap(const JAVLTreePtr tree, int low, int high, JIntervalIteratorPtr iterator)
+ * @brief [low, high] 와 겹치는 구간들을 찾는 반복자를 준비하는 함수
+ * 반복자는 호출한 쪽의 메모리를 사용하므로 검색마다 할당하지 않는다.
+ * 반복하는 동안 트리를 변경하면 안 된다.
+ * @param tree 구간 트리 객체의 주소(입력, 읽기 전용)
+ * @param low 검색 범위 하한(입력)
+ * @param high 검색 범위 상한(입력)
+ * @param iterator 준비할 반복자의 주소(출력)
+ * @return 성공 시 반복자의 주소, 실패 시 NULL 반환
+ */
+JIntervalIteratorPtr JIntervalTreeFindOverlap(const JAVLTreePtr tree, int low, int high, JIntervalIteratorPtr iterator)
+{
+	if(JIntervalTreeIsIntervalTree(tree) == 0 || iterator == NULL || low > high) return NULL;
+
+	iterator->tree = tree;
+	iterator->low = low;
+	iterator->high = high;
+	iterator->node = NULL;
+	iterator->isDone = 0;
+
+	return iterator;
+}
+
+/**
+ * @fn JNodePtr JIntervalIteratorNext(JIntervalIteratorPtr iterator)
+ * @brief 다음으로 겹치는 구간을 가진 노드를 시작 값 순서로 찾는 함수
+ * 하위 트리의 가장 큰 끝 값이 하한보다 작으면 그 하위 트리를 건너뛰고,
+ * 시작 값이 상한보다 큰 노드를 만나면 끝낸다.
+ * 부모 노드 연결로 다음 위치를 찾으므로 반복자는 스택 없이 노드 하나만 기억한다.
+ * @param iterator 반복자의 주소(입력, 출력)
+ * @return 성공 시 찾은 노드의 주소, 더 이상 없으면 NULL 반환
+ */
+JNodePtr JIntervalIteratorNext(JIntervalIteratorPtr iterator)
+{
+	if(iterator == NULL || iterator->isDone == 1) return NULL;
+
+	JNodePtr node = NULL;
+	if(iterator->node == NULL) node = JIntervalIteratorDescend(iterator, iterator->tree->root);
+	else node = JIntervalIteratorStep(iterator, iterator->node);
+
+	while(node != NULL)
+	{
+		const JInterval *interval = (const JInterval*)node->key;
+		if(interval->start > iterator->high) break;
+
+		if((node->flags & JNODE_FLAG_TOMBSTONE) == 0 && interval->end >= iterator->low)
+		{
+			iterator->node = node;
+			return node;
+		}
+		node = JIntervalIteratorStep(iterator, node);
+	}
+
+	iterator->node = NULL;
+	iterator->isDone = 1;
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interval Tree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JIntervalTreeIdentity(void *aggregate, void *userData)
+ * @brief 빈 하위 트리의 가장 큰 끝 값(INT_MIN)을 저장하는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void JIntervalTreeIdentity(void *aggregate, void *userData)
+{
+	(void)userData;
+	*((int*)aggregate) = INT_MIN;
+}
+
+/**
+ * @fn static void JIntervalTreeLift(void *aggregate, const void *key, void *userData)
+ * @brief 구간 하나의 끝 값을 저장하는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param key 구간 키의 주소(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void JIntervalTreeLift(void *aggregate, const void *key, void *userData)
+{
+	(void)userData;
+	*((int*)aggregate) = ((const JInterval*)key)->end;
+}
+
+/**
+ * @fn static void JIntervalTreeCombine(void *result, const void *left, const void *right, void *userData)
+ * @brief 두 끝 값 중 큰 값을 저장하는 함수
+ * @param result 결합한 집계 값을 저장할 주소(출력)
+ * @param left 왼쪽 집계 값(입력, 읽기 전용)
+ * @param right 오른쪽 집계 값(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void JIntervalTreeCombine(void *result, const void *left, const void *right, void *userData)
+{
+	int leftEnd = *((const int*)left);
+	int rightEnd = *((const int*)right);
+	(void)userData;
+	*((int*)result) = (leftEnd > rightEnd) ? leftEnd : rightEnd;
+}
+
+/**
+ * @fn static int JIntervalTreeIsIntervalTree(const JAVLTreePtr tree)
+ * @brief NewJIntervalTree 로 만든 구간 트리인지 검사하는 함수
+ * @param tree 검사할 AVL Tree 객체의 주소(입력, 읽기 전용)
+ * @return 구간 트리이면 1, 아니면 0 반환
+ */
+static int JIntervalTreeIsIntervalTree(const JAVLTreePtr tree)
+{
+	if(tree == NULL || tree->type != IntervalType) return 0;
+	return tree->augment.lift == JIntervalTreeLift;
+}
+
+/**
+ * @fn static JNodePtr JIntervalIteratorDescend(const JIntervalIteratorPtr iterator, JNodePtr node)
+ * @brief 하위 트리에서 건너뛰지 않는 노드 중 중위 순회 순서가 가장 빠른 노드를 찾는 함수
+ * 왼쪽 하위 트리의 가장 큰 끝 값이 하한 이상이면 왼쪽으로 내려간다.
+ * @param iterator 반복자의 주소(입력, 읽기 전용)
+ * @param node 하위 트리의 루트 노드(입력)
+ * @return 성공 시 찾은 노드의 주소, 하위 트리 전체를 건너뛰면 NULL 반환
+ */
+static JNodePtr JIntervalIteratorDescend(const JIntervalIteratorPtr iterator, JNodePtr node)
+{
+	if(node == NULL || JIntervalTreeGetMaxEnd(iterator->tree, node) < iterator->low) return NULL;
+
+	while(node->left != NULL && JIntervalTreeGetMaxEnd(iterator->tree, node->left) >= iterator->low) node = node->left;
+	return node;
+}
+
+/**
+ * @fn static JNodePtr JIntervalIteratorStep(const JIntervalIteratorPtr iterator, JNodePtr node)
+ * @brief 건너뛸 하위 트리를 제외하고 중위 순회 순서에서 다음 노드를 찾는 함수
+ * @param iterator 반복자의 주소(입력, 읽기 전용)
+ * @param node 기준 노드(입력)
+ * @return 성공 시 다음 노드의 주소, 없으면 NULL 반환
+ */
+static JNodePtr JIntervalIteratorStep(const JIntervalIteratorPtr iterator, JNodePtr node)
+{
+	JNodePtr nextNode = JIntervalIteratorDescend(iterator, node->right);
+	if(nextNode != NULL) return nextNode;
+
+	// 왼쪽 자식으로 올라가는 첫 번째 부모 노드가 다음 노드이다.
+	while(node->parent != NULL && node->parent->right == node) node = node->parent;
+	return node->parent;
+}
+
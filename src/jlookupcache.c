@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jlookupcache.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 노드 주소를 읽고 쓸 때 한 번에 보이도록 하는 연산
+// 읽는 쪽이 반쯤 쓰인 주소를 보지 않으므로, 노드 해제를 미루는 환경에서는
+// 쓰는 스레드 하나와 JLookupCacheFind 를 부르는 여러 스레드가 잠금 없이 함께 사용할 수 있다.
+// 해시 값과 통계는 순서가 필요 없으므로 relaxed 로 읽고 쓴다. (해시 값이 맞지 않으면 노드의 키로 다시 확인함)
+#if defined(__GNUC__)
+#define JLOOKUP_CACHE_LOAD(address) __atomic_load_n(address, __ATOMIC_ACQUIRE)
+#define JLOOKUP_CACHE_STORE(address, value) __atomic_store_n(address, value, __ATOMIC_RELEASE)
+#define JLOOKUP_CACHE_LOAD_RELAXED(address) __atomic_load_n(address, __ATOMIC_RELAXED)
+#define JLOOKUP_CACHE_STORE_RELAXED(address, value) __atomic_store_n(address, value, __ATOMIC_RELAXED)
+#define JLOOKUP_CACHE_COUNT(address) __atomic_fetch_add(address, 1, __ATOMIC_RELAXED)
+#else
+#define JLOOKUP_CACHE_LOAD(address) (*(address))
+#define JLOOKUP_CACHE_STORE(address, value) (*(address) = (value))
+#define JLOOKUP_CACHE_LOAD_RELAXED(address) (*(address))
+#define JLOOKUP_CACHE_STORE_RELAXED(address, value) (*(address) = (value))
+#define JLOOKUP_CACHE_COUNT(address) ((*(address))++)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JLookupCache Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JLookupEntryPtr JLookupCacheGetSet(const JLookupCachePtr cache, unsigned long long hash);
+static int JLookupCacheIsSameKey(const void *key1, const void *key2, KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JLookupCache
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JLookupCachePtr NewJLookupCache(KeyType type, unsigned int entryCount)
+ * @brief 새로운 검색 캐시 구조체 객체를 생성하는 함수
+ * 집합 두 개가 캐시 라인 하나에 들어가므로 검색할 때 캐시 라인 하나만 읽는다.
+ * @param type 키 데이터 유형(입력)
+ * @param entryCount 기억할 노드 개수, 2 의 거듭제곱으로 올림(입력)
+ * @return 성공 시 생성된 검색 캐시 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JLookupCachePtr NewJLookupCache(KeyType type, unsigned int entryCount)
+{
+	if(type != IntType && type != CharType && type != StringType) return NULL;
+	if(entryCount == 0 || entryCount > 0x40000000U) return NULL;
+
+	JLookupCachePtr newCache = (JLookupCachePtr)malloc(sizeof(JLookupCache));
+	if(newCache == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned int setCount = 1;
+	while(setCount * JLOOKUP_CACHE_WAY_COUNT < entryCount) setCount <<= 1;
+
+	size_t entriesSize = sizeof(JLookupEntry) * JLOOKUP_CACHE_WAY_COUNT * setCount;
+	if(entriesSize < JLOOKUP_CACHE_ALIGNMENT) entriesSize = JLOOKUP_CACHE_ALIGNMENT;
+
+	newCache->entries = (JLookupEntryPtr)aligned_alloc(JLOOKUP_CACHE_ALIGNMENT, entriesSize);
+	if(newCache->entries == NULL)
+	{
+		free(newCache);
+		return NULL;
+	}
+
+	newCache->type = type;
+	newCache->setMask = setCount - 1;
+	JLookupCacheClear(newCache);
+
+	return newCache;
+}
+
+/**
+ * @fn DeleteResult DeleteJLookupCache(JLookupCachePtrContainer container)
+ * @brief 검색 캐시 구조체 객체를 삭제하는 함수
+ * @param container 검색 캐시 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJLookupCache(JLookupCachePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->entries);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JLookupCacheClear(JLookupCachePtr cache)
+ * @brief 검색 캐시의 모든 항목과 통계를 지우는 함수
+ * @param cache 검색 캐시 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+void JLookupCacheClear(JLookupCachePtr cache)
+{
+	if(cache == NULL) return;
+
+	unsigned int index = 0;
+	unsigned int entryCount = (cache->setMask + 1) * JLOOKUP_CACHE_WAY_COUNT;
+	for(; index < entryCount; index++)
+	{
+		JLOOKUP_CACHE_STORE(&cache->entries[index].node, NULL);
+		JLOOKUP_CACHE_STORE_RELAXED(&cache->entries[index].hash, 0ULL);
+	}
+	JLOOKUP_CACHE_STORE_RELAXED(&cache->hitCount, 0ULL);
+	JLOOKUP_CACHE_STORE_RELAXED(&cache->missCount, 0ULL);
+}
+
+/**
+ * @fn JNodePtr JLookupCacheFind(JLookupCachePtr cache, const void *key)
+ * @brief 검색 캐시에서 키를 가진 노드를 찾는 함수
+ * 항목의 해시 값이 같아도 노드의 키와 직접 비교해서 확인하므로 잘못된 노드를 반환하지 않는다.
+ * 항목을 바꾸지 않으므로 여러 스레드가 함께 호출할 수 있다. (노드 해제를 미루는 경우 쓰는 스레드 하나와도 함께 사용 가능)
+ * @param cache 검색 캐시 구조체 객체의 주소(입력)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 캐시에 있으면 노드의 주소, 없으면 NULL 반환
+ */
+JNodePtr JLookupCacheFind(JLookupCachePtr cache, const void *key)
+{
+	if(cache == NULL || key == NULL) return NULL;
+
+	unsigned long long hash = JAVLTreeHashKey(key, cache->type);
+	JLookupEntryPtr set = JLookupCacheGetSet(cache, hash);
+	int way = 0;
+
+	for(; way < JLOOKUP_CACHE_WAY_COUNT; way++)
+	{
+		JNodePtr node = JLOOKUP_CACHE_LOAD(&set[way].node);
+		if(node != NULL && JLOOKUP_CACHE_LOAD_RELAXED(&set[way].hash) == hash
+			&& JLookupCacheIsSameKey(node->key, key, cache->type) == 1)
+		{
+			JLOOKUP_CACHE_COUNT(&cache->hitCount);
+			return node;
+		}
+	}
+
+	JLOOKUP_CACHE_COUNT(&cache->missCount);
+	return NULL;
+}
+
+/**
+ * @fn void JLookupCacheFill(JLookupCachePtr cache, JNodePtr node)
+ * @brief 트리에서 찾은 노드를 검색 캐시에 기억하는 함수
+ * 새 노드는 집합의 첫 번째 항목에 넣고, 원래 첫 번째 항목은 두 번째로 밀어낸다(LRU).
+ * 항목을 바꾸므로 JLookupCacheInvalidate 와 마찬가지로 한 번에 한 스레드만 호출해야 한다.
+ * @param cache 검색 캐시 구조체 객체의 주소(출력)
+ * @param node 기억할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+void JLookupCacheFill(JLookupCachePtr cache, JNodePtr node)
+{
+	if(cache == NULL || node == NULL || node->key == NULL) return;
+
+	unsigned long long hash = JAVLTreeHashKey(node->key, cache->type);
+	JLookupEntryPtr set = JLookupCacheGetSet(cache, hash);
+
+	if(JLOOKUP_CACHE_LOAD(&set[0].node) == node) return;
+
+	JLOOKUP_CACHE_STORE(&set[1].node, NULL);
+	JLOOKUP_CACHE_STORE_RELAXED(&set[1].hash, JLOOKUP_CACHE_LOAD_RELAXED(&set[0].hash));
+	JLOOKUP_CACHE_STORE(&set[1].node, JLOOKUP_CACHE_LOAD(&set[0].node));
+
+	JLOOKUP_CACHE_STORE(&set[0].node, NULL);
+	JLOOKUP_CACHE_STORE_RELAXED(&set[0].hash, hash);
+	JLOOKUP_CACHE_STORE(&set[0].node, node);
+}
+
+/**
+ * @fn void JLookupCacheInvalidate(JLookupCachePtr cache, const void *key)
+ * @brief 키에 해당하는 검색 캐시 항목을 지우는 함수
+ * 노드를 해제하기 전에 호출해야 한다.
+ * @param cache 검색 캐시 구조체 객체의 주소(출력)
+ * @param key 지울 키의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JLookupCacheInvalidate(JLookupCachePtr cache, const void *key)
+{
+	if(cache == NULL || key == NULL) return;
+
+	unsigned long long hash = JAVLTreeHashKey(key, cache->type);
+	JLookupEntryPtr set = JLookupCacheGetSet(cache, hash);
+	int way = 0;
+
+	for(; way < JLOOKUP_CACHE_WAY_COUNT; way++)
+	{
+		if(JLOOKUP_CACHE_LOAD_RELAXED(&set[way].hash) == hash) JLOOKUP_CACHE_STORE(&set[way].node, NULL);
+	}
+}
+
+/**
+ * @fn double JLookupCacheGetHitRatio(const JLookupCachePtr cache)
+ * @brief 지금까지 검색한 횟수 중 검색 캐시에서 찾은 비율을 반환하는 함수
+ * @param cache 검색 캐시 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 적중 비율(0 ~ 1), 검색한 적이 없으면 0 반환
+ */
+double JLookupCacheGetHitRatio(const JLookupCachePtr cache)
+{
+	if(cache == NULL) return 0.0;
+
+	unsigned long long hitCount = JLOOKUP_CACHE_LOAD_RELAXED(&cache->hitCount);
+	unsigned long long lookupCount = hitCount + JLOOKUP_CACHE_LOAD_RELAXED(&cache->missCount);
+	if(lookupCount == 0) return 0.0;
+	return (double)hitCount / (double)lookupCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JLookupCache Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JLookupEntryPtr JLookupCacheGetSet(const JLookupCachePtr cache, unsigned long long hash)
+ * @brief 해시 값의 하위 비트로 키가 들어갈 집합을 고르는 함수
+ * @param cache 검색 캐시 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 해시 값(입력)
+ * @return 집합의 첫 번째 항목 주소
+ */
+static JLookupEntryPtr JLookupCacheGetSet(const JLookupCachePtr cache, unsigned long long hash)
+{
+	return cache->entries + (hash & cache->setMask) * JLOOKUP_CACHE_WAY_COUNT;
+}
+
+/**
+ * @fn static int JLookupCacheIsSameKey(const void *key1, const void *key2, KeyType type)
+ * @brief 두 키가 같은지 검사하는 함수
+ * @param key1 비교할 키의 주소(입력, 읽기 전용)
+ * @param key2 비교할 키의 주소(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 같으면 1, 다르면 0 반환
+ */
+static int JLookupCacheIsSameKey(const void *key1, const void *key2, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return *((const int*)key1) == *((const int*)key2);
+		case CharType:
+			return *((const char*)key1) == *((const char*)key2);
+		case StringType:
+			return strcmp((const char*)key1, (const char*)key2) == 0;
+		default:
+			return 0;
+	}
+}
@@ -0,0 +1,642 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/jmappedavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 파일 식별자
+#define JMAPPED_MAGIC "JMAV"
+// 파일 형식 버전
+#define JMAPPED_VERSION 1U
+// 루트부터 최하위 노드까지 경로의 최대 길이 (64 비트 오프셋으로 만들 수 있는 AVL Tree 높이보다 크다)
+#define JMAPPED_MAX_HEIGHT 96
+// 새 파일의 크기
+#define JMAPPED_INITIAL_SIZE 4096ULL
+
+// 오프셋에 있는 노드의 주소
+#define JMAPPED_NODE(tree, offset) ((JMappedNodePtr)((tree)->base + (offset)))
+// 파일 헤더의 주소 (파일이 커지면 매핑 주소가 바뀌므로 매번 구한다)
+#define JMAPPED_HEADER(tree) ((JMappedHeaderPtr)((tree)->base))
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JMappedAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JMappedAVLTreeCheckHeader(const JMappedAVLTreePtr tree);
+static int JMappedAVLTreeGrow(JMappedAVLTreePtr tree);
+static unsigned long long JMappedAVLTreeNewNode(JMappedAVLTreePtr tree, int key);
+static void JMappedAVLTreeFreeNode(JMappedAVLTreePtr tree, unsigned long long offset);
+static int JMappedAVLTreeSearchPath(const JMappedAVLTreePtr tree, int key, unsigned long long *path, int *depth, unsigned long long *offset);
+static int JMappedAVLTreeGetHeight(const JMappedAVLTreePtr tree, unsigned long long offset);
+static void JMappedAVLTreeUpdateHeight(JMappedAVLTreePtr tree, unsigned long long offset);
+static unsigned long long JMappedAVLTreeRotateLeft(JMappedAVLTreePtr tree, unsigned long long offset);
+static unsigned long long JMappedAVLTreeRotateRight(JMappedAVLTreePtr tree, unsigned long long offset);
+static unsigned long long JMappedAVLTreeRebalanceNode(JMappedAVLTreePtr tree, unsigned long long offset);
+static void JMappedAVLTreeRebalance(JMappedAVLTreePtr tree, unsigned long long *path, int depth);
+static void JMappedAVLTreeInorderTraverseNode(const JMappedAVLTreePtr tree, unsigned long long offset, int depth);
+static int _IsValidOffset(const JMappedAVLTreePtr tree, unsigned long long offset);
+static int _GetMappedKey(const void *key, KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JMappedAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JMappedAVLTreePtr NewJMappedAVLTree(const char *path, KeyType type, JMappedMode mode)
+ * @brief 노드들이 mmap 된 파일에 있는 AVL Tree 를 열거나 새로 만드는 함수
+ * 파일을 매핑하고 헤더만 검사하므로 트리 크기와 관계없이 O(1) 에 열리고,
+ * 노드가 있는 페이지는 처음 접근할 때 읽힌다.
+ * 읽기 전용으로 열면 MAP_SHARED 로 매핑하므로 여러 프로세스가 같은 페이지 캐시를 공유한다.
+ * 파일은 호스트의 바이트 순서로 저장되며, 동시에 쓰는 프로세스에 대한 잠금은 제공하지 않는다.
+ * 키를 값으로 저장하므로 IntType, CharType 만 지원한다.
+ * @param path 파일 경로(입력)
+ * @param type 저장할 키 데이터 유형, 기존 파일의 유형과 같아야 함(입력)
+ * @param mode 파일을 여는 방식(입력)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JMappedAVLTreePtr NewJMappedAVLTree(const char *path, KeyType type, JMappedMode mode)
+{
+	if(path == NULL || (type != IntType && type != CharType)) return NULL;
+	if(mode != MappedReadWrite && mode != MappedReadOnly) return NULL;
+
+	JMappedAVLTreePtr newTree = (JMappedAVLTreePtr)malloc(sizeof(JMappedAVLTree));
+	if(newTree == NULL)
+	{
+		return NULL;
+	}
+
+	newTree->fd = (mode == MappedReadWrite) ? open(path, O_RDWR | O_CREAT, 0644) : open(path, O_RDONLY);
+	if(newTree->fd < 0)
+	{
+		free(newTree);
+		return NULL;
+	}
+
+	// 비어 있는 새 파일은 헤더를 쓸 수 있는 크기로 늘린다.
+	struct stat fileStat;
+	int isNewFile = 0;
+	if(fstat(newTree->fd, &fileStat) != 0
+		|| (fileStat.st_size == 0 && mode == MappedReadOnly)
+		|| (fileStat.st_size == 0 && ftruncate(newTree->fd, (off_t)JMAPPED_INITIAL_SIZE) != 0))
+	{
+		close(newTree->fd);
+		free(newTree);
+		return NULL;
+	}
+	if(fileStat.st_size == 0)
+	{
+		isNewFile = 1;
+		fileStat.st_size = (off_t)JMAPPED_INITIAL_SIZE;
+	}
+
+	newTree->mode = mode;
+	newTree->type = type;
+	newTree->mappedSize = (size_t)fileStat.st_size;
+	newTree->data = NULL;
+
+	int protection = (mode == MappedReadWrite) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+	void *base = mmap(NULL, newTree->mappedSize, protection, MAP_SHARED, newTree->fd, 0);
+	if(base == MAP_FAILED)
+	{
+		close(newTree->fd);
+		free(newTree);
+		return NULL;
+	}
+	newTree->base = (unsigned char*)base;
+
+	if(isNewFile == 1)
+	{
+		JMappedHeaderPtr header = JMAPPED_HEADER(newTree);
+		memset(header, 0, sizeof(JMappedHeader));
+		memcpy(header->magic, JMAPPED_MAGIC, 4);
+		header->version = JMAPPED_VERSION;
+		header->type = (int)type;
+		header->nodeSize = (unsigned int)sizeof(JMappedNode);
+		header->root = JMAPPED_NULL_OFFSET;
+		header->freeList = JMAPPED_NULL_OFFSET;
+		header->end = sizeof(JMappedHeader);
+		header->size = 0;
+	}
+	else if(JMappedAVLTreeCheckHeader(newTree) == 0)
+	{
+		munmap(newTree->base, newTree->mappedSize);
+		close(newTree->fd);
+		free(newTree);
+		return NULL;
+	}
+
+	return newTree;
+}
+
+/**
+ * @fn DeleteResult DeleteJMappedAVLTree(JMappedAVLTreePtrContainer container)
+ * @brief 파일 매핑을 해제하고 AVL Tree 구조체 객체를 삭제하는 함수
+ * 파일은 지우지 않는다. 변경 내용은 운영체제가 나중에 파일에 쓰므로,
+ * 바로 디스크에 남겨야 하면 먼저 JMappedAVLTreeSync 를 호출한다.
+ * @param container AVL Tree 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJMappedAVLTree(JMappedAVLTreePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	munmap((*container)->base, (*container)->mappedSize);
+	close((*container)->fd);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JMappedAVLTreePtr JMappedAVLTreeSync(JMappedAVLTreePtr tree)
+ * @brief 매핑된 파일의 변경 내용을 디스크에 쓰는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JMappedAVLTreePtr JMappedAVLTreeSync(JMappedAVLTreePtr tree)
+{
+	if(tree == NULL || tree->mode != MappedReadWrite) return NULL;
+	if(msync(tree->base, tree->mappedSize, MS_SYNC) != 0) return NULL;
+	return tree;
+}
+
+/**
+ * @fn unsigned long long JMappedAVLTreeGetSize(const JMappedAVLTreePtr tree)
+ * @brief 파일 기반 AVL Tree 에 저장된 키 개수를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
+ */
+unsigned long long JMappedAVLTreeGetSize(const JMappedAVLTreePtr tree)
+{
+	if(tree == NULL) return 0;
+	return JMAPPED_HEADER(tree)->size;
+}
+
+/**
+ * @fn JMappedAVLTreePtr JMappedAVLTreeAddKey(JMappedAVLTreePtr tree, const void *key)
+ * @brief 파일 기반 AVL Tree 에 새로운 키를 추가하는 함수
+ * 빈 슬롯 목록에 슬롯이 없고 파일이 가득 차면 파일을 두 배로 늘리고 다시 매핑한다.
+ * 손상된 파일(매핑 범위 밖의 오프셋, 순환 연결)을 만나면 아무것도 바꾸지 않고 실패한다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환 (읽기 전용이면 항상 실패)
+ */
+JMappedAVLTreePtr JMappedAVLTreeAddKey(JMappedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL || tree->mode != MappedReadWrite) return NULL;
+
+	int value = _GetMappedKey(key, tree->type);
+	unsigned long long path[JMAPPED_MAX_HEIGHT];
+	int depth = 0;
+	unsigned long long currentOffset = JMAPPED_NULL_OFFSET;
+
+	if(JMappedAVLTreeSearchPath(tree, value, path, &depth, &currentOffset) != 0) return NULL;
+
+	// 파일이 다시 매핑될 수 있으므로 노드 주소는 할당 이후에 구한다.
+	unsigned long long newOffset = JMappedAVLTreeNewNode(tree, value);
+	if(newOffset == JMAPPED_NULL_OFFSET) return NULL;
+
+	if(depth == 0) JMAPPED_HEADER(tree)->root = newOffset;
+	else
+	{
+		JMappedNodePtr parentNode = JMAPPED_NODE(tree, path[depth - 1]);
+		if(parentNode->key > value) parentNode->left = newOffset;
+		else parentNode->right = newOffset;
+	}
+
+	JMAPPED_HEADER(tree)->size++;
+	JMappedAVLTreeRebalance(tree, path, depth);
+	return tree;
+}
+
+/**
+ * @fn DeleteResult JMappedAVLTreeDeleteKey(JMappedAVLTreePtr tree, const void *key)
+ * @brief 파일 기반 AVL Tree 에서 지정한 키를 삭제하는 함수
+ * 삭제된 노드 슬롯은 파일에 저장된 빈 슬롯 목록에 넣어서 다음 삽입 시 다시 사용한다.
+ * 손상된 파일(매핑 범위 밖의 오프셋, 순환 연결)을 만나면 아무것도 바꾸지 않고 실패한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 삭제할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JMappedAVLTreeDeleteKey(JMappedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL || tree->mode != MappedReadWrite) return DeleteFail;
+
+	int value = _GetMappedKey(key, tree->type);
+	unsigned long long path[JMAPPED_MAX_HEIGHT];
+	int depth = 0;
+	unsigned long long currentOffset = JMAPPED_NULL_OFFSET;
+
+	if(JMappedAVLTreeSearchPath(tree, value, path, &depth, &currentOffset) != 1) return DeleteFail;
+
+	JMappedNodePtr selectedNode = JMAPPED_NODE(tree, currentOffset);
+	unsigned long long selectedOffset = currentOffset;
+	unsigned long long childOffset = JMAPPED_NULL_OFFSET;
+
+	// 자식 노드가 두 개 다 있는 경우, 다음 키를 복사하고 다음 키의 노드를 대신 삭제
+	// 파일을 바꾸기 전에 다음 키까지의 경로를 먼저 검사한다.
+	if(selectedNode->left != JMAPPED_NULL_OFFSET && selectedNode->right != JMAPPED_NULL_OFFSET)
+	{
+		path[depth++] = selectedOffset;
+		currentOffset = selectedNode->right;
+		while(1)
+		{
+			if(depth == JMAPPED_MAX_HEIGHT || _IsValidOffset(tree, currentOffset) == 0) return DeleteFail;
+			if(JMAPPED_NODE(tree, currentOffset)->left == JMAPPED_NULL_OFFSET) break;
+
+			path[depth++] = currentOffset;
+			currentOffset = JMAPPED_NODE(tree, currentOffset)->left;
+		}
+		selectedNode->key = JMAPPED_NODE(tree, currentOffset)->key;
+		selectedOffset = currentOffset;
+		selectedNode = JMAPPED_NODE(tree, selectedOffset);
+	}
+
+	if(selectedNode->left != JMAPPED_NULL_OFFSET) childOffset = selectedNode->left;
+	else childOffset = selectedNode->right;
+
+	if(depth == 0) JMAPPED_HEADER(tree)->root = childOffset;
+	else if(JMAPPED_NODE(tree, path[depth - 1])->left == selectedOffset) JMAPPED_NODE(tree, path[depth - 1])->left = childOffset;
+	else JMAPPED_NODE(tree, path[depth - 1])->right = childOffset;
+
+	JMappedAVLTreeFreeNode(tree, selectedOffset);
+	JMAPPED_HEADER(tree)->size--;
+	JMappedAVLTreeRebalance(tree, path, depth);
+	return DeleteSuccess;
+}
+
+/**
+ * @fn FindResult JMappedAVLTreeFindKey(const JMappedAVLTreePtr tree, const void *key)
+ * @brief 파일 기반 AVL Tree 에 지정한 키가 있는지 검색하는 함수
+ * 매핑 범위를 벗어나는 오프셋(손상된 파일이나 연 이후 다른 프로세스가 늘린 파일)은 찾지 못한 것으로 본다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @return 찾으면 FindSuccess, 없으면 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JMappedAVLTreeFindKey(const JMappedAVLTreePtr tree, const void *key)
+{
+	if(tree == NULL || key == NULL) return FindFail;
+
+	int value = _GetMappedKey(key, tree->type);
+	unsigned long long currentOffset = JMAPPED_HEADER(tree)->root;
+
+	while(_IsValidOffset(tree, currentOffset) == 1)
+	{
+		const JMappedNode *currentNode = JMAPPED_NODE(tree, currentOffset);
+		if(currentNode->key == value) return FindSuccess;
+
+		if(currentNode->key > value) currentOffset = currentNode->left;
+		else currentOffset = currentNode->right;
+	}
+
+	return FindFail;
+}
+
+/**
+ * @fn void JMappedAVLTreeInorderTraverse(const JMappedAVLTreePtr tree)
+ * @brief 파일 기반 AVL Tree 를 중위 순회하며 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JMappedAVLTreeInorderTraverse(const JMappedAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	JMappedAVLTreeInorderTraverseNode(tree, JMAPPED_HEADER(tree)->root, 0);
+	printf("\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JMappedAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JMappedAVLTreeCheckHeader(const JMappedAVLTreePtr tree)
+ * @brief 매핑된 파일의 헤더가 이 구현과 열려는 키 데이터 유형에 맞는지 검사하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 맞으면 1, 다르면 0 반환
+ */
+static int JMappedAVLTreeCheckHeader(const JMappedAVLTreePtr tree)
+{
+	if(tree->mappedSize < sizeof(JMappedHeader)) return 0;
+
+	const JMappedHeader *header = JMAPPED_HEADER(tree);
+	if(memcmp(header->magic, JMAPPED_MAGIC, 4) != 0) return 0;
+	if(header->version != JMAPPED_VERSION || header->nodeSize != sizeof(JMappedNode)) return 0;
+	if(header->type != (int)tree->type) return 0;
+	if(header->end < sizeof(JMappedHeader) || header->end > tree->mappedSize) return 0;
+	if(header->root != JMAPPED_NULL_OFFSET && _IsValidOffset(tree, header->root) == 0) return 0;
+	return 1;
+}
+
+/**
+ * @fn static int JMappedAVLTreeGrow(JMappedAVLTreePtr tree)
+ * @brief 파일을 두 배로 늘리고 다시 매핑하는 함수
+ * 새로 매핑한 다음 기존 매핑을 해제하므로 실패해도 기존 매핑은 그대로 남는다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 1, 실패 시 0 반환
+ */
+static int JMappedAVLTreeGrow(JMappedAVLTreePtr tree)
+{
+	size_t newSize = tree->mappedSize * 2;
+	if(newSize < tree->mappedSize) return 0;
+	if(ftruncate(tree->fd, (off_t)newSize) != 0) return 0;
+
+	void *newBase = mmap(NULL, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, tree->fd, 0);
+	if(newBase == MAP_FAILED) return 0;
+
+	munmap(tree->base, tree->mappedSize);
+	tree->base = (unsigned char*)newBase;
+	tree->mappedSize = newSize;
+	return 1;
+}
+
+/**
+ * @fn static unsigned long long JMappedAVLTreeNewNode(JMappedAVLTreePtr tree, int key)
+ * @brief 빈 슬롯 목록이나 파일의 사용하지 않은 공간에서 새로운 노드 슬롯을 할당하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키 값(입력)
+ * @return 성공 시 할당된 노드 오프셋, 실패 시 JMAPPED_NULL_OFFSET 반환
+ */
+static unsigned long long JMappedAVLTreeNewNode(JMappedAVLTreePtr tree, int key)
+{
+	JMappedHeaderPtr header = JMAPPED_HEADER(tree);
+	unsigned long long newOffset = JMAPPED_NULL_OFFSET;
+
+	if(header->freeList != JMAPPED_NULL_OFFSET)
+	{
+		// 손상된 빈 슬롯 목록은 따라가지 않는다.
+		if(_IsValidOffset(tree, header->freeList) == 0) return JMAPPED_NULL_OFFSET;
+		newOffset = header->freeList;
+		header->freeList = JMAPPED_NODE(tree, newOffset)->left;
+	}
+	else
+	{
+		if(header->end + sizeof(JMappedNode) > tree->mappedSize)
+		{
+			if(JMappedAVLTreeGrow(tree) == 0) return JMAPPED_NULL_OFFSET;
+			header = JMAPPED_HEADER(tree);
+		}
+		newOffset = header->end;
+		header->end += sizeof(JMappedNode);
+	}
+
+	JMappedNodePtr newNode = JMAPPED_NODE(tree, newOffset);
+	newNode->key = key;
+	newNode->height = 1;
+	newNode->left = JMAPPED_NULL_OFFSET;
+	newNode->right = JMAPPED_NULL_OFFSET;
+	return newOffset;
+}
+
+/**
+ * @fn static void JMappedAVLTreeFreeNode(JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 노드 슬롯을 파일에 저장된 빈 슬롯 목록에 넣는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param offset 반환할 노드 오프셋(입력)
+ * @return 반환값 없음
+ */
+static void JMappedAVLTreeFreeNode(JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	JMappedNodePtr node = JMAPPED_NODE(tree, offset);
+	node->left = JMAPPED_HEADER(tree)->freeList;
+	node->right = JMAPPED_NULL_OFFSET;
+	node->height = 0;
+	JMAPPED_HEADER(tree)->freeList = offset;
+}
+
+/**
+ * @fn static int JMappedAVLTreeSearchPath(const JMappedAVLTreePtr tree, int key, unsigned long long *path, int *depth, unsigned long long *offset)
+ * @brief 루트부터 키를 찾아 내려가며 지나간 노드의 오프셋을 기록하는 함수
+ * 파일을 바꾸는 쪽이 사용하므로, 매핑 범위 밖의 오프셋이나 경로 배열보다 긴 경로(순환 연결)를 만나면 손상된 것으로 본다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키 값(입력)
+ * @param path 루트부터 찾은 노드(없으면 새 노드의 부모)까지의 오프셋을 저장할 배열, JMAPPED_MAX_HEIGHT 개(출력)
+ * @param depth 기록한 경로 길이(출력)
+ * @param offset 찾은 노드 오프셋, 없으면 JMAPPED_NULL_OFFSET(출력)
+ * @return 찾으면 1, 없으면 0, 파일이 손상되었으면 -1 반환
+ */
+static int JMappedAVLTreeSearchPath(const JMappedAVLTreePtr tree, int key, unsigned long long *path, int *depth, unsigned long long *offset)
+{
+	unsigned long long currentOffset = JMAPPED_HEADER(tree)->root;
+
+	*depth = 0;
+	while(currentOffset != JMAPPED_NULL_OFFSET)
+	{
+		if(*depth == JMAPPED_MAX_HEIGHT || _IsValidOffset(tree, currentOffset) == 0) return -1;
+
+		const JMappedNode *currentNode = JMAPPED_NODE(tree, currentOffset);
+		if(currentNode->key == key)
+		{
+			*offset = currentOffset;
+			return 1;
+		}
+
+		path[(*depth)++] = currentOffset;
+		if(currentNode->key > key) currentOffset = currentNode->left;
+		else currentOffset = currentNode->right;
+	}
+
+	*offset = JMAPPED_NULL_OFFSET;
+	return 0;
+}
+
+/**
+ * @fn static int JMappedAVLTreeGetHeight(const JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이를 반환하는 함수
+ * 매핑 범위 밖의 오프셋은 0, 저장된 높이는 0 ~ JMAPPED_MAX_HEIGHT 로 제한하므로,
+ * 높이가 1 이상인 자식만 회전에 쓰이는 균형 맞추기는 손상된 파일에서도 매핑 범위 밖을 읽지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param offset 노드 오프셋(입력)
+ * @return 하위 트리의 높이, 노드가 없으면 0 반환
+ */
+static int JMappedAVLTreeGetHeight(const JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	if(_IsValidOffset(tree, offset) == 0) return 0;
+
+	int height = JMAPPED_NODE(tree, offset)->height;
+	if(height < 0) return 0;
+	if(height > JMAPPED_MAX_HEIGHT) return JMAPPED_MAX_HEIGHT;
+	return height;
+}
+
+/**
+ * @fn static void JMappedAVLTreeUpdateHeight(JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 자식 노드들의 높이로 지정한 노드의 높이를 다시 계산하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param offset 높이를 갱신할 노드 오프셋(입력)
+ * @return 반환값 없음
+ */
+static void JMappedAVLTreeUpdateHeight(JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	JMappedNodePtr node = JMAPPED_NODE(tree, offset);
+	int leftHeight = JMappedAVLTreeGetHeight(tree, node->left);
+	int rightHeight = JMappedAVLTreeGetHeight(tree, node->right);
+	node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+}
+
+/**
+ * @fn static unsigned long long JMappedAVLTreeRotateLeft(JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 지정한 노드를 기준으로 왼쪽으로 회전하는 함수 (RR 인 상황)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param offset 회전하기 위한 기준 노드 오프셋(입력)
+ * @return 회전된 하위 트리의 루트 노드 오프셋
+ */
+static unsigned long long JMappedAVLTreeRotateLeft(JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	JMappedNodePtr node = JMAPPED_NODE(tree, offset);
+	unsigned long long rightOffset = node->right;
+	JMappedNodePtr rightNode = JMAPPED_NODE(tree, rightOffset);
+
+	node->right = rightNode->left;
+	rightNode->left = offset;
+
+	JMappedAVLTreeUpdateHeight(tree, offset);
+	JMappedAVLTreeUpdateHeight(tree, rightOffset);
+	return rightOffset;
+}
+
+/**
+ * @fn static unsigned long long JMappedAVLTreeRotateRight(JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 지정한 노드를 기준으로 오른쪽으로 회전하는 함수 (LL 인 상황)
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param offset 회전하기 위한 기준 노드 오프셋(입력)
+ * @return 회전된 하위 트리의 루트 노드 오프셋
+ */
+static unsigned long long JMappedAVLTreeRotateRight(JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	JMappedNodePtr node = JMAPPED_NODE(tree, offset);
+	unsigned long long leftOffset = node->left;
+	JMappedNodePtr leftNode = JMAPPED_NODE(tree, leftOffset);
+
+	node->left = leftNode->right;
+	leftNode->right = offset;
+
+	JMappedAVLTreeUpdateHeight(tree, offset);
+	JMappedAVLTreeUpdateHeight(tree, leftOffset);
+	return leftOffset;
+}
+
+/**
+ * @fn static unsigned long long JMappedAVLTreeRebalanceNode(JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 높이 균형을 맞추는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param offset 균형을 맞출 하위 트리의 루트 노드 오프셋(입력)
+ * @return 하위 트리의 새로운 루트 노드 오프셋
+ */
+static unsigned long long JMappedAVLTreeRebalanceNode(JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	JMappedNodePtr node = JMAPPED_NODE(tree, offset);
+
+	JMappedAVLTreeUpdateHeight(tree, offset);
+	int heightDiff = JMappedAVLTreeGetHeight(tree, node->left) - JMappedAVLTreeGetHeight(tree, node->right);
+
+	if(heightDiff > 1)
+	{
+		JMappedNodePtr leftNode = JMAPPED_NODE(tree, node->left);
+		if(JMappedAVLTreeGetHeight(tree, leftNode->left) < JMappedAVLTreeGetHeight(tree, leftNode->right))
+		{
+			node->left = JMappedAVLTreeRotateLeft(tree, node->left);
+		}
+		return JMappedAVLTreeRotateRight(tree, offset);
+	}
+
+	if(heightDiff < -1)
+	{
+		JMappedNodePtr rightNode = JMAPPED_NODE(tree, node->right);
+		if(JMappedAVLTreeGetHeight(tree, rightNode->right) < JMappedAVLTreeGetHeight(tree, rightNode->left))
+		{
+			node->right = JMappedAVLTreeRotateRight(tree, node->right);
+		}
+		return JMappedAVLTreeRotateLeft(tree, offset);
+	}
+
+	return offset;
+}
+
+/**
+ * @fn static void JMappedAVLTreeRebalance(JMappedAVLTreePtr tree, unsigned long long *path, int depth)
+ * @brief 탐색 경로를 거꾸로 올라가며 높이를 갱신하고 균형을 맞추는 함수
+ * 하위 트리의 높이가 바뀌지 않으면 상위 노드들은 영향을 받지 않으므로 중간에 멈춘다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param path 루트부터 변경된 노드의 부모 노드까지의 오프셋 배열(입력)
+ * @param depth 경로 길이(입력)
+ * @return 반환값 없음
+ */
+static void JMappedAVLTreeRebalance(JMappedAVLTreePtr tree, unsigned long long *path, int depth)
+{
+	while(depth > 0)
+	{
+		unsigned long long offset = path[--depth];
+		int oldHeight = JMAPPED_NODE(tree, offset)->height;
+		unsigned long long subRootOffset = JMappedAVLTreeRebalanceNode(tree, offset);
+
+		if(subRootOffset != offset)
+		{
+			if(depth == 0) JMAPPED_HEADER(tree)->root = subRootOffset;
+			else if(JMAPPED_NODE(tree, path[depth - 1])->left == offset) JMAPPED_NODE(tree, path[depth - 1])->left = subRootOffset;
+			else JMAPPED_NODE(tree, path[depth - 1])->right = subRootOffset;
+		}
+
+		if(JMAPPED_NODE(tree, subRootOffset)->height == oldHeight) break;
+	}
+}
+
+/**
+ * @fn static void JMappedAVLTreeInorderTraverseNode(const JMappedAVLTreePtr tree, unsigned long long offset, int depth)
+ * @brief 지정한 노드를 기준으로 중위 순회하며 키를 출력하는 함수(재귀)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param offset 순회할 기준 노드 오프셋(입력)
+ * @param depth 현재 깊이, 손상된 파일의 순환 연결을 막기 위해 사용(입력)
+ * @return 반환값 없음
+ */
+static void JMappedAVLTreeInorderTraverseNode(const JMappedAVLTreePtr tree, unsigned long long offset, int depth)
+{
+	if(depth >= JMAPPED_MAX_HEIGHT || _IsValidOffset(tree, offset) == 0) return;
+
+	const JMappedNode *node = JMAPPED_NODE(tree, offset);
+	JMappedAVLTreeInorderTraverseNode(tree, node->left, depth + 1);
+	if(tree->type == CharType) printf("%c ", (char)(node->key));
+	else printf("%d ", node->key);
+	JMappedAVLTreeInorderTraverseNode(tree, node->right, depth + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _IsValidOffset(const JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 오프셋이 매핑된 범위 안의 노드 슬롯을 가리키는지 검사하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param offset 검사할 노드 오프셋(입력)
+ * @return 유효하면 1, 아니면 0 반환
+ */
+static int _IsValidOffset(const JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	if(offset < sizeof(JMappedHeader)) return 0;
+	if((offset - sizeof(JMappedHeader)) % sizeof(JMappedNode) != 0) return 0;
+	return offset + sizeof(JMappedNode) <= tree->mappedSize;
+}
+
+/**
+ * @fn static int _GetMappedKey(const void *key, KeyType type)
+ * @brief 키 주소에서 노드에 저장할 정수 키 값을 읽는 함수
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return 노드에 저장할 키 값
+ */
+static int _GetMappedKey(const void *key, KeyType type)
+{
+	if(type == CharType) return (int)(*((const char*)key));
+	return *((const int*)key);
+}
@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jsmallavltree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JSmallAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JSmallAVLTreeFindSlot(const JSmallAVLTreePtr tree, const void *key, int *isFound);
+static JSmallAVLTreePtr JSmallAVLTreePromote(JSmallAVLTreePtr tree, void *key);
+static void JSmallAVLTreeDemote(JSmallAVLTreePtr tree);
+static void JSmallAVLTreePrintKey(const void *key, KeyType type);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int _CompareSmallKey(const void *key1, const void *key2, KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JSmallAVLTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JSmallAVLTreePtr NewJSmallAVLTree(KeyType type)
+ * @brief 정렬된 배열로 시작하는 새로운 작은 AVL Tree 구조체 객체를 생성하는 함수
+ * 키가 JSMALL_CAPACITY 개를 넘으면 노드 기반 AVL Tree 로 바꾸고, JSMALL_DEMOTE_SIZE 개 이하로 줄면 다시 배열로 바꾼다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JSmallAVLTreePtr NewJSmallAVLTree(KeyType type)
+{
+	if(type != IntType && type != CharType && type != StringType) return NULL;
+
+	JSmallAVLTreePtr newTree = (JSmallAVLTreePtr)malloc(sizeof(JSmallAVLTree));
+	if(newTree == NULL)
+	{
+		return NULL;
+	}
+
+	newTree->type = type;
+	newTree->size = 0;
+	newTree->tree = NULL;
+	newTree->data = NULL;
+
+	return newTree;
+}
+
+/**
+ * @fn DeleteResult DeleteJSmallAVLTree(JSmallAVLTreePtrContainer container)
+ * @brief 작은 AVL Tree 구조체 객체를 삭제하는 함수
+ * @param container AVL Tree 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJSmallAVLTree(JSmallAVLTreePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	DeleteJAVLTree(&((*container)->tree));
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn unsigned int JSmallAVLTreeGetSize(const JSmallAVLTreePtr tree)
+ * @brief 작은 AVL Tree 에 저장된 키 개수를 반환하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키 개수, 실패 시 0 반환
+ */
+unsigned int JSmallAVLTreeGetSize(const JSmallAVLTreePtr tree)
+{
+	if(tree == NULL) return 0;
+	return tree->size;
+}
+
+/**
+ * @fn int JSmallAVLTreeIsPromoted(const JSmallAVLTreePtr tree)
+ * @brief 작은 AVL Tree 가 노드 기반 AVL Tree 로 바뀌어 있는지 검사하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 노드 기반이면 1, 배열이거나 실패 시 0 반환
+ */
+int JSmallAVLTreeIsPromoted(const JSmallAVLTreePtr tree)
+{
+	if(tree == NULL) return 0;
+	return (tree->tree != NULL) ? 1 : 0;
+}
+
+/**
+ * @fn JSmallAVLTreePtr JSmallAVLTreeAddKey(JSmallAVLTreePtr tree, void *key)
+ * @brief 작은 AVL Tree 에 키를 추가하는 함수
+ * 배열이 가득 찬 상태에서 추가하면 노드 기반 AVL Tree 로 바꾼 뒤 추가한다.
+ * 중복 허용하지 않음
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JSmallAVLTreePtr JSmallAVLTreeAddKey(JSmallAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+
+	if(tree->tree != NULL)
+	{
+		if(JAVLTreeAddNode(tree->tree, key) == NULL) return NULL;
+		tree->size++;
+		return tree;
+	}
+
+	int isFound = 0;
+	int slot = JSmallAVLTreeFindSlot(tree, key, &isFound);
+	if(isFound == 1) return NULL;
+	if(tree->size == JSMALL_CAPACITY) return JSmallAVLTreePromote(tree, key);
+
+	memmove(&(tree->keys[slot + 1]), &(tree->keys[slot]), sizeof(void*) * (tree->size - (unsigned int)slot));
+	tree->keys[slot] = key;
+	tree->size++;
+	return tree;
+}
+
+/**
+ * @fn DeleteResult JSmallAVLTreeDeleteKey(JSmallAVLTreePtr tree, void *key)
+ * @brief 작은 AVL Tree 에서 지정한 키를 삭제하는 함수
+ * 노드 기반 AVL Tree 의 키가 JSMALL_DEMOTE_SIZE 개 이하로 줄면 배열로 바꾸고 노드를 모두 해제한다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 삭제할 키의 주소(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JSmallAVLTreeDeleteKey(JSmallAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return DeleteFail;
+
+	if(tree->tree != NULL)
+	{
+		if(JAVLTreeDeleteNodeKey(tree->tree, key) == DeleteFail) return DeleteFail;
+		tree->size--;
+		if(tree->size <= JSMALL_DEMOTE_SIZE) JSmallAVLTreeDemote(tree);
+		return DeleteSuccess;
+	}
+
+	int isFound = 0;
+	int slot = JSmallAVLTreeFindSlot(tree, key, &isFound);
+	if(isFound == 0) return DeleteFail;
+
+	tree->size--;
+	memmove(&(tree->keys[slot]), &(tree->keys[slot + 1]), sizeof(void*) * (tree->size - (unsigned int)slot));
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void* JSmallAVLTreeFindKey(const JSmallAVLTreePtr tree, void *key)
+ * @brief 작은 AVL Tree 에서 지정한 키를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력)
+ * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
+ */
+void* JSmallAVLTreeFindKey(const JSmallAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	if(tree->tree != NULL) return JNodeGetKey(JAVLTreeFindNode(tree->tree, key));
+
+	int isFound = 0;
+	int slot = JSmallAVLTreeFindSlot(tree, key, &isFound);
+	return (isFound == 1) ? tree->keys[slot] : NULL;
+}
+
+/**
+ * @fn void* JSmallAVLTreeGetMin(const JSmallAVLTreePtr tree)
+ * @brief 작은 AVL Tree 에서 가장 작은 키를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 작은 키의 주소, 실패 시 NULL 반환
+ */
+void* JSmallAVLTreeGetMin(const JSmallAVLTreePtr tree)
+{
+	if(tree == NULL || tree->size == 0) return NULL;
+	if(tree->tree != NULL) return JNodeGetKey(JAVLTreeGetMin(tree->tree));
+	return tree->keys[0];
+}
+
+/**
+ * @fn void* JSmallAVLTreeGetMax(const JSmallAVLTreePtr tree)
+ * @brief 작은 AVL Tree 에서 가장 큰 키를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 가장 큰 키의 주소, 실패 시 NULL 반환
+ */
+void* JSmallAVLTreeGetMax(const JSmallAVLTreePtr tree)
+{
+	if(tree == NULL || tree->size == 0) return NULL;
+	if(tree->tree != NULL) return JNodeGetKey(JAVLTreeGetMax(tree->tree));
+	return tree->keys[tree->size - 1];
+}
+
+/**
+ * @fn void* JSmallAVLTreeLowerBound(const JSmallAVLTreePtr tree, void *key)
+ * @brief 작은 AVL Tree 에서 지정한 키보다 크거나 같은 키 중 가장 작은 키를 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 기준 키의 주소(입력)
+ * @return 성공 시 찾은 키의 주소, 실패 시 NULL 반환
+ */
+void* JSmallAVLTreeLowerBound(const JSmallAVLTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	if(tree->tree != NULL) return JNodeGetKey(JAVLTreeLowerBound(tree->tree, key));
+
+	int isFound = 0;
+	int slot = JSmallAVLTreeFindSlot(tree, key, &isFound);
+	return ((unsigned int)slot < tree->size) ? tree->keys[slot] : NULL;
+}
+
+/**
+ * @fn void JSmallAVLTreeInorderTraverse(const JSmallAVLTreePtr tree)
+ * @brief 작은 AVL Tree 를 키 순서로 순회하며 키를 출력하는 함수
+ * @param tree 순회할 AVL Tree (입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JSmallAVLTreeInorderTraverse(const JSmallAVLTreePtr tree)
+{
+	if(tree == NULL) return;
+	if(tree->tree != NULL)
+	{
+		JAVLTreeInorderTraverse(tree->tree);
+		return;
+	}
+
+	unsigned int index = 0;
+	for(; index < tree->size; index++) JSmallAVLTreePrintKey(tree->keys[index], tree->type);
+	printf("\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JSmallAVLTree Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JSmallAVLTreeFindSlot(const JSmallAVLTreePtr tree, const void *key, int *isFound)
+ * @brief 정렬된 키 배열에서 지정한 키보다 크거나 같은 첫 번째 위치를 이진 탐색으로 찾는 함수
+ * @param tree AVL Tree 구조체 객체의 주소, 배열 모드여야 함(입력, 읽기 전용)
+ * @param key 찾을 키의 주소(입력, 읽기 전용)
+ * @param isFound 같은 키가 있으면 1, 없으면 0 저장(출력)
+ * @return 찾은 위치 (모든 키보다 크면 키 개수)
+ */
+static int JSmallAVLTreeFindSlot(const JSmallAVLTreePtr tree, const void *key, int *isFound)
+{
+	int low = 0;
+	int high = (int)tree->size;
+
+	// 정수 키는 찾는 값을 한 번만 읽고, 분기 없이 범위를 절반씩 줄여서(조건부 이동) 분기 예측 실패를 피한다.
+	if(tree->type == IntType)
+	{
+		int value = *((const int*)key);
+		int count = high;
+		while(count > 1)
+		{
+			int half = count / 2;
+			low = (*((const int*)tree->keys[low + half - 1]) < value) ? low + half : low;
+			count -= half;
+		}
+		if(count == 1 && *((const int*)tree->keys[low]) < value) low++;
+		*isFound = (low < high && *((const int*)tree->keys[low]) == value) ? 1 : 0;
+		return low;
+	}
+
+	while(low < high)
+	{
+		int middle = (low + high) / 2;
+		if(_CompareSmallKey(tree->keys[middle], key, tree->type) < 0) low = middle + 1;
+		else high = middle;
+	}
+
+	*isFound = (low < (int)tree->size && _CompareSmallKey(tree->keys[low], key, tree->type) == 0) ? 1 : 0;
+	return low;
+}
+
+/**
+ * @fn static JSmallAVLTreePtr JSmallAVLTreePromote(JSmallAVLTreePtr tree, void *key)
+ * @brief 가득 찬 키 배열을 노드 기반 AVL Tree 로 옮기고 새 키를 추가하는 함수
+ * 배열은 정렬되어 있으므로 직전에 추가한 노드를 힌트로 주어 루트부터 내려가지 않는다.
+ * 실패하면 만든 트리를 버리므로 배열은 그대로 남는다.
+ * @param tree AVL Tree 구조체 객체의 주소(출력)
+ * @param key 추가할 키의 주소(입력)
+ * @return 성공 시 AVL Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+static JSmallAVLTreePtr JSmallAVLTreePromote(JSmallAVLTreePtr tree, void *key)
+{
+	JAVLTreePtr nodeTree = NewJAVLTree(tree->type);
+	if(nodeTree == NULL) return NULL;
+
+	JNodePtr hint = NULL;
+	unsigned int index = 0;
+	for(; index < tree->size; index++)
+	{
+		hint = JAVLTreeAddNodeHint(nodeTree, hint, tree->keys[index]);
+		if(hint == NULL) break;
+	}
+
+	if(hint == NULL || JAVLTreeAddNode(nodeTree, key) == NULL)
+	{
+		DeleteJAVLTree(&nodeTree);
+		return NULL;
+	}
+
+	tree->tree = nodeTree;
+	tree->size++;
+	return tree;
+}
+
+/**
+ * @fn static void JSmallAVLTreeDemote(JSmallAVLTreePtr tree)
+ * @brief 노드 기반 AVL Tree 의 키를 키 순서대로 배열에 옮기고 트리를 삭제하는 함수
+ * 할당하지 않으므로 실패하지 않는다.
+ * @param tree AVL Tree 구조체 객체의 주소, 키가 JSMALL_CAPACITY 개 이하여야 함(출력)
+ * @return 반환값 없음
+ */
+static void JSmallAVLTreeDemote(JSmallAVLTreePtr tree)
+{
+	unsigned int index = 0;
+	JNodePtr node = JAVLTreeGetMin(tree->tree);
+	for(; node != NULL; node = JNodeGetNext(node)) tree->keys[index++] = JNodeGetKey(node);
+
+	DeleteJAVLTree(&(tree->tree));
+}
+
+/**
+ * @fn static void JSmallAVLTreePrintKey(const void *key, KeyType type)
+ * @brief 키 데이터 유형에 맞게 키를 출력하는 함수
+ * @param key 출력할 키의 주소(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void JSmallAVLTreePrintKey(const void *key, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			printf("%d ", *((const int*)key));
+			break;
+		case CharType:
+			printf("%c ", *((const char*)key));
+			break;
+		case StringType:
+			printf("%s ", (const char*)key);
+			break;
+		default:
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _CompareSmallKey(const void *key1, const void *key2, KeyType type)
+ * @brief 지정한 키 데이터 유형에 따라 두 키를 비교하는 함수 (노드 기반 AVL Tree 와 같은 순서)
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return key1 이 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int _CompareSmallKey(const void *key1, const void *key2, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return (*((const int*)key1) > *((const int*)key2)) - (*((const int*)key1) < *((const int*)key2));
+		case CharType:
+			return (*((const char*)key1) > *((const char*)key2)) - (*((const char*)key1) < *((const char*)key2));
+		case StringType:
+			return strcmp((const char*)key1, (const char*)key2);
+		default:
+			return 0;
+	}
+}
@@ -0,0 +1,871 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../include/jwal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Macros
+////////////////////////////////////////////////////////////////////////////////
+
+// 로그 파일 식별자
+#define JWAL_MAGIC "JWAL"
+// 스냅샷 파일 식별자
+#define JWAL_SNAPSHOT_MAGIC "JAVS"
+// 파일 헤더 크기 (식별자 4 바이트 + 키 데이터 유형 4 바이트)
+#define JWAL_HEADER_SIZE 8
+// 기록 하나의 고정 크기 (본문 길이 4 바이트 + 체크섬 4 바이트)
+#define JWAL_RECORD_OVERHEAD 8
+// 복구 시 허용하는 기록 본문의 최대 길이 (이보다 크면 손상된 기록으로 판단)
+#define JWAL_MAX_RECORD_LENGTH (1U << 30)
+
+// 파일 내용을 디스크까지 내려보냄 (리눅스는 메타데이터 갱신을 생략하는 fdatasync 사용)
+#if defined(__linux__)
+#define JWAL_FSYNC(fd) fdatasync(fd)
+#else
+#define JWAL_FSYNC(fd) fsync(fd)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JWAL Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static WALResult JWALCommit(JWALPtr wal);
+static WALResult JWALAbort(JWALPtr wal);
+static WALResult JWALFlushBuffer(JWALPtr wal);
+static WALResult JWALReserveBuffer(JWALPtr wal, size_t length);
+static WALResult JWALLoadSnapshot(JAVLTreePtr tree, const char *snapshotPath);
+static WALResult JWALReplay(JAVLTreePtr tree, const char *walPath);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static WALResult _WriteAll(int fd, const unsigned char *bytes, size_t length);
+static WALResult _SyncDirectory(const char *path);
+static WALResult _ReserveBuffer(const JAVLTreePtr tree, unsigned char **buffer, size_t *capacity, size_t length);
+static WALResult _ReadHeader(FILE *file, const char *magic, KeyType type);
+static void _EncodeHeader(unsigned char *bytes, const char *magic, KeyType type);
+static size_t _GetEncodedKeySize(const void *key, KeyType type);
+static void _EncodeKey(unsigned char *bytes, const void *key, KeyType type);
+static size_t _DecodeKey(const unsigned char *bytes, size_t length, KeyType type, unsigned char *key);
+static void _WriteUInt32(unsigned char *bytes, unsigned int value);
+static unsigned int _ReadUInt32(const unsigned char *bytes);
+static unsigned int _Checksum(unsigned int hash, const unsigned char *bytes, size_t length);
+static long long _GetMonotonicMicros();
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JWAL
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JWALPtr NewJWAL(const char *path, KeyType type, JWALPolicy policy)
+ * @brief 추가 전용 변경 기록 로그를 열거나 새로 만드는 함수
+ * 기존 파일이 있으면 그 뒤에 이어서 기록하므로, 먼저 JWALRecover 로 복구한 다음 열어야 한다.
+ * 기록은 버퍼에 모았다가 정책(기록 개수 또는 시간)을 만족할 때 한 번에 쓰고 fsync 한다(그룹 커밋).
+ * 따라서 장애 시 마지막 fsync 이후의 기록은 잃을 수 있고, 잃는 양은 정책으로 제한된다.
+ * @param path 로그 파일 경로(입력)
+ * @param type 기록할 키 데이터 유형(입력)
+ * @param policy 그룹 커밋 정책(입력)
+ * @return 성공 시 생성된 로그 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JWALPtr NewJWAL(const char *path, KeyType type, JWALPolicy policy)
+{
+	if(path == NULL || (type != IntType && type != CharType && type != StringType)) return NULL;
+	if(policy.batchSize < 1 || policy.windowMicros < 0) return NULL;
+
+	JWALPtr newWAL = (JWALPtr)malloc(sizeof(JWAL));
+	if(newWAL == NULL)
+	{
+		return NULL;
+	}
+
+	newWAL->buffer = (unsigned char*)malloc(JWAL_BUFFER_SIZE);
+	if(newWAL->buffer == NULL)
+	{
+		free(newWAL);
+		return NULL;
+	}
+
+	newWAL->fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+	if(newWAL->fd < 0)
+	{
+		free(newWAL->buffer);
+		free(newWAL);
+		return NULL;
+	}
+
+	// 헤더가 없거나 중간에 끊긴 파일은 비우고 헤더를 새로 쓰고, 있으면 키 데이터 유형을 확인한다.
+	unsigned char header[JWAL_HEADER_SIZE];
+	unsigned char expectedHeader[JWAL_HEADER_SIZE];
+	_EncodeHeader(expectedHeader, JWAL_MAGIC, type);
+
+	struct stat fileStat;
+	WALResult result = WALFail;
+	if(fstat(newWAL->fd, &fileStat) == 0)
+	{
+		if(fileStat.st_size < JWAL_HEADER_SIZE)
+		{
+			if(ftruncate(newWAL->fd, 0) == 0
+				&& _WriteAll(newWAL->fd, expectedHeader, JWAL_HEADER_SIZE) == WALSuccess
+				&& JWAL_FSYNC(newWAL->fd) == 0) result = WALSuccess;
+		}
+		else if(pread(newWAL->fd, header, JWAL_HEADER_SIZE, 0) == JWAL_HEADER_SIZE
+			&& memcmp(header, expectedHeader, JWAL_HEADER_SIZE) == 0) result = WALSuccess;
+	}
+
+	if(result == WALFail)
+	{
+		close(newWAL->fd);
+		free(newWAL->buffer);
+		free(newWAL);
+		return NULL;
+	}
+
+	newWAL->type = type;
+	newWAL->policy = policy;
+	newWAL->bufferLength = 0;
+	newWAL->bufferCapacity = JWAL_BUFFER_SIZE;
+	newWAL->pendingCount = 0;
+	newWAL->lastSyncMicros = _GetMonotonicMicros();
+	newWAL->recordCount = 0;
+	newWAL->syncCount = 0;
+	newWAL->fileLength = (fileStat.st_size < JWAL_HEADER_SIZE) ? JWAL_HEADER_SIZE : (long long)fileStat.st_size;
+	newWAL->syncedLength = newWAL->fileLength;
+	newWAL->isFailed = 0;
+
+	return newWAL;
+}
+
+/**
+ * @fn DeleteResult DeleteJWAL(JWALPtrContainer container)
+ * @brief 남은 기록을 fsync 하고 로그 구조체 객체를 삭제하는 함수
+ * @param container 로그 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJWAL(JWALPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	WALResult result = JWALSync(*container);
+	if(close((*container)->fd) != 0) result = WALFail;
+
+	free((*container)->buffer);
+	free(*container);
+	*container = NULL;
+
+	return (result == WALSuccess) ? DeleteSuccess : DeleteFail;
+}
+
+/**
+ * @fn WALResult JWALAppend(JWALPtr wal, WALOperation operation, const void *key)
+ * @brief 로그에 노드 추가, 삭제 기록을 하나 추가하는 함수
+ * 기록 형식은 [본문 길이 4][기록 종류 1][키][체크섬 4] 이고,
+ * 키는 정수 4 바이트, 문자 1 바이트, 문자열은 [길이 4][문자들] 로 저장한다. (리틀 엔디언)
+ * 기록은 버퍼에 쌓이고, 그룹 커밋 정책을 만족하면 버퍼를 파일에 쓰고 fsync 한다.
+ * 쓰기나 fsync 에 실패하면 로그를 마지막 fsync 시점으로 되돌리고 실패 상태로 만들며, 이후의 기록은 모두 거절한다.
+ * WALFail 이면 이번 기록은 로그에 남지 않으므로 호출한 쪽은 변경을 되돌리고,
+ * WALNotDurable 이면(되돌리기마저 실패) 복구 시 적용될 수 있으므로 변경을 유지해야 한다.
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @param operation 기록 종류(입력)
+ * @param key 추가 또는 삭제된 노드의 키 주소(입력, 읽기 전용)
+ * @return 성공 시 WALSuccess, 기록하지 못했으면 WALFail, 디스크에 남았는지 알 수 없으면 WALNotDurable 반환(WALResult 열거형 참고)
+ */
+WALResult JWALAppend(JWALPtr wal, WALOperation operation, const void *key)
+{
+	if(wal == NULL || key == NULL || wal->isFailed == 1) return WALFail;
+	if(operation != WALAddNode && operation != WALDeleteNode) return WALFail;
+
+	size_t bodyLength = 1 + _GetEncodedKeySize(key, wal->type);
+	size_t recordLength = bodyLength + JWAL_RECORD_OVERHEAD;
+	if(bodyLength > JWAL_MAX_RECORD_LENGTH) return WALFail;
+	if(JWALReserveBuffer(wal, recordLength) == WALFail) return WALFail;
+
+	unsigned char *record = wal->buffer + wal->bufferLength;
+	unsigned char *body = record + 4;
+	_WriteUInt32(record, (unsigned int)bodyLength);
+	body[0] = (unsigned char)operation;
+	_EncodeKey(body + 1, key, wal->type);
+	_WriteUInt32(body + bodyLength, _Checksum(2166136261U, body, bodyLength));
+
+	wal->bufferLength += recordLength;
+	wal->pendingCount++;
+	wal->recordCount++;
+
+	if(wal->pendingCount < wal->policy.batchSize
+		&& (wal->policy.windowMicros == 0
+			|| _GetMonotonicMicros() - wal->lastSyncMicros < wal->policy.windowMicros)) return WALSuccess;
+
+	WALResult result = JWALCommit(wal);
+	if(result == WALFail) wal->recordCount--;
+	return result;
+}
+
+/**
+ * @fn WALResult JWALSync(JWALPtr wal)
+ * @brief 버퍼에 쌓인 기록을 파일에 쓰고 fsync 하는 함수
+ * 그룹 커밋 정책과 관계없이 지금까지의 기록을 디스크에 남겨야 할 때 호출한다.
+ * 실패하면 로그는 실패 상태가 되고, fsync 되지 않았던 기록은 버려진다.
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+WALResult JWALSync(JWALPtr wal)
+{
+	if(wal == NULL || wal->isFailed == 1) return WALFail;
+	return (JWALCommit(wal) == WALSuccess) ? WALSuccess : WALFail;
+}
+
+/**
+ * @fn WALResult JWALCheckpoint(JWALPtr wal, const JAVLTreePtr tree, const char *snapshotPath)
+ * @brief 트리의 스냅샷을 저장하고 로그를 비우는 함수
+ * 스냅샷이 저장된 뒤 로그를 비우기 전에 장애가 나도, 로그를 다시 적용하면 같은 결과가 되므로 안전하다.
+ * (키마다 마지막 기록이 최종 상태를 결정하기 때문)
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @param tree 스냅샷을 저장할 AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param snapshotPath 스냅샷 파일 경로(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+WALResult JWALCheckpoint(JWALPtr wal, const JAVLTreePtr tree, const char *snapshotPath)
+{
+	if(wal == NULL || tree == NULL || snapshotPath == NULL) return WALFail;
+	if(wal->type != tree->type) return WALFail;
+
+	if(JWALSync(wal) == WALFail) return WALFail;
+	if(JWALSaveSnapshot(tree, snapshotPath) == WALFail) return WALFail;
+
+	if(ftruncate(wal->fd, JWAL_HEADER_SIZE) != 0) return WALFail;
+	wal->fileLength = JWAL_HEADER_SIZE;
+	if(JWAL_FSYNC(wal->fd) != 0)
+	{
+		wal->isFailed = 1;
+		return WALFail;
+	}
+	wal->syncedLength = JWAL_HEADER_SIZE;
+	wal->syncCount++;
+	return WALSuccess;
+}
+
+/**
+ * @fn WALResult JWALSaveSnapshot(const JAVLTreePtr tree, const char *snapshotPath)
+ * @brief 트리의 모든 키를 정렬된 순서로 스냅샷 파일에 저장하는 함수
+ * 형식은 [헤더 8][키 개수 4][키들][체크섬 4] 이다.
+ * 임시 파일에 쓰고 fsync 한 다음 이름을 바꾸므로, 장애가 나도 이전 스냅샷이나 새 스냅샷 중 하나가 남는다.
+ * 쓰기 버퍼는 트리의 할당자로 할당한다.
+ * @param tree 저장할 AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param snapshotPath 스냅샷 파일 경로(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+WALResult JWALSaveSnapshot(const JAVLTreePtr tree, const char *snapshotPath)
+{
+	if(tree == NULL || snapshotPath == NULL) return WALFail;
+
+	size_t pathLength = strlen(snapshotPath);
+	char *tempPath = (char*)JAVLTreeAlloc(tree, pathLength + 5);
+	unsigned char *buffer = (unsigned char*)JAVLTreeAlloc(tree, JWAL_BUFFER_SIZE);
+	if(tempPath == NULL || buffer == NULL)
+	{
+		JAVLTreeFree(tree, tempPath);
+		JAVLTreeFree(tree, buffer);
+		return WALFail;
+	}
+	memcpy(tempPath, snapshotPath, pathLength);
+	memcpy(tempPath + pathLength, ".tmp", 5);
+
+	int fd = open(tempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd < 0)
+	{
+		JAVLTreeFree(tree, tempPath);
+		JAVLTreeFree(tree, buffer);
+		return WALFail;
+	}
+
+	unsigned int keyCount = 0;
+	JNodePtr node = JAVLTreeGetMin(tree);
+	for(; node != NULL; node = JNodeGetNext(node)) keyCount++;
+
+	_EncodeHeader(buffer, JWAL_SNAPSHOT_MAGIC, tree->type);
+	_WriteUInt32(buffer + JWAL_HEADER_SIZE, keyCount);
+	size_t bufferLength = JWAL_HEADER_SIZE + 4;
+
+	WALResult result = WALSuccess;
+	unsigned int checksum = 2166136261U;
+	for(node = JAVLTreeGetMin(tree); node != NULL && result == WALSuccess; node = JNodeGetNext(node))
+	{
+		size_t keyLength = _GetEncodedKeySize(node->key, tree->type);
+		if(bufferLength + keyLength > JWAL_BUFFER_SIZE)
+		{
+			result = _WriteAll(fd, buffer, bufferLength);
+			bufferLength = 0;
+		}
+
+		if(keyLength > JWAL_BUFFER_SIZE)
+		{
+			// 버퍼보다 큰 문자열 키는 따로 인코딩해서 바로 쓴다.
+			unsigned char *largeKey = (unsigned char*)JAVLTreeAlloc(tree, keyLength);
+			if(largeKey == NULL) result = WALFail;
+			else
+			{
+				_EncodeKey(largeKey, node->key, tree->type);
+				checksum = _Checksum(checksum, largeKey, keyLength);
+				if(result == WALSuccess) result = _WriteAll(fd, largeKey, keyLength);
+				JAVLTreeFree(tree, largeKey);
+			}
+			continue;
+		}
+
+		_EncodeKey(buffer + bufferLength, node->key, tree->type);
+		checksum = _Checksum(checksum, buffer + bufferLength, keyLength);
+		bufferLength += keyLength;
+	}
+
+	if(result == WALSuccess && bufferLength + 4 > JWAL_BUFFER_SIZE)
+	{
+		result = _WriteAll(fd, buffer, bufferLength);
+		bufferLength = 0;
+	}
+	_WriteUInt32(buffer + bufferLength, checksum);
+	bufferLength += 4;
+
+	if(result == WALSuccess) result = _WriteAll(fd, buffer, bufferLength);
+	if(result == WALSuccess && fsync(fd) != 0) result = WALFail;
+	if(close(fd) != 0) result = WALFail;
+	if(result == WALSuccess && rename(tempPath, snapshotPath) != 0) result = WALFail;
+	if(result == WALSuccess) result = _SyncDirectory(snapshotPath);
+	if(result == WALFail) unlink(tempPath);
+
+	JAVLTreeFree(tree, tempPath);
+	JAVLTreeFree(tree, buffer);
+	return result;
+}
+
+/**
+ * @fn JAVLTreePtr JWALRecover(KeyType type, const char *snapshotPath, const char *walPath)
+ * @brief 마지막 스냅샷을 읽고 그 위에 로그를 다시 적용해서 트리를 복구하는 함수
+ * 복구된 키는 트리가 소유하는 저장 공간에 복사되므로 트리를 삭제할 때 함께 해제된다.
+ * 로그 끝의 끊기거나 체크섬이 맞지 않는 기록은 장애로 쓰다 만 기록으로 보고 버리고,
+ * 이후 기록이 이어지도록 로그 파일을 마지막 정상 기록까지 잘라낸다.
+ * 파일이 없으면 비어 있는 것으로 본다.
+ * @param type 키 데이터 유형(입력)
+ * @param snapshotPath 스냅샷 파일 경로, 없으면 NULL(입력)
+ * @param walPath 로그 파일 경로, 없으면 NULL(입력)
+ * @return 성공 시 복구된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JWALRecover(KeyType type, const char *snapshotPath, const char *walPath)
+{
+	return JWALRecoverEx(type, NULL, snapshotPath, walPath);
+}
+
+/**
+ * @fn JAVLTreePtr JWALRecoverEx(KeyType type, const JAVLTreeOptionsPtr options, const char *snapshotPath, const char *walPath)
+ * @brief 지정한 옵션으로 만든 트리에 스냅샷과 로그를 적용해서 복구하는 함수
+ * 장애 전과 같은 옵션(키 소유 방식, 점 검색 방식, 할당자 등)의 트리로 복구할 때 사용한다.
+ * 스냅샷과 로그를 읽는 임시 버퍼도 복구하는 트리의 할당자로 할당한다.
+ * KeyOwnerTree 트리는 키를 추가할 때 직접 복사하므로 따로 키 저장 블록에 복사하지 않는다.
+ * @param type 키 데이터 유형(입력)
+ * @param options 트리 생성 옵션, NULL 이면 JWALRecover 와 같음(입력, 읽기 전용)
+ * @param snapshotPath 스냅샷 파일 경로, 없으면 NULL(입력)
+ * @param walPath 로그 파일 경로, 없으면 NULL(입력)
+ * @return 성공 시 복구된 AVL Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JAVLTreePtr JWALRecoverEx(KeyType type, const JAVLTreeOptionsPtr options, const char *snapshotPath, const char *walPath)
+{
+	JAVLTreePtr tree = NewJAVLTreeEx(type, options);
+	if(tree == NULL) return NULL;
+
+	if((snapshotPath != NULL && JWALLoadSnapshot(tree, snapshotPath) == WALFail)
+		|| (walPath != NULL && JWALReplay(tree, walPath) == WALFail))
+	{
+		DeleteJAVLTree(&tree);
+		return NULL;
+	}
+
+	return tree;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for JWAL
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static WALResult JWALCommit(JWALPtr wal)
+ * @brief 버퍼에 쌓인 기록을 파일에 쓰고 fsync 하는 함수, 실패하면 JWALAbort 로 로그를 되돌린다.
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @return 성공 시 WALSuccess, 실패 시 JWALAbort 의 결과 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALCommit(JWALPtr wal)
+{
+	if(JWALFlushBuffer(wal) == WALFail) return JWALAbort(wal);
+
+	if(wal->pendingCount > 0)
+	{
+		if(JWAL_FSYNC(wal->fd) != 0) return JWALAbort(wal);
+		wal->syncCount++;
+		wal->pendingCount = 0;
+	}
+
+	wal->syncedLength = wal->fileLength;
+	wal->lastSyncMicros = _GetMonotonicMicros();
+	return WALSuccess;
+}
+
+/**
+ * @fn static WALResult JWALAbort(JWALPtr wal)
+ * @brief 쓰기 또는 fsync 에 실패한 로그를 마지막 fsync 시점의 길이로 잘라내고 실패 상태로 만드는 함수
+ * 일부만 쓰인 기록이나 디스크에 남았는지 알 수 없는 기록이 로그 끝에 남지 않게 하고,
+ * 이후의 기록은 거절하므로 로그는 fsync 에 성공한 시점까지의 변경만 담는다.
+ * (버퍼에 남은 기록과 fsync 되지 않은 기록도 함께 버려지며, 이는 그룹 커밋 정책에서 잃을 수 있는 범위이다)
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @return 잘라냈으면 WALFail, 잘라내지 못했으면 WALNotDurable 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALAbort(JWALPtr wal)
+{
+	wal->isFailed = 1;
+	wal->bufferLength = 0;
+	wal->pendingCount = 0;
+
+	if(ftruncate(wal->fd, (off_t)wal->syncedLength) != 0) return WALNotDurable;
+	wal->fileLength = wal->syncedLength;
+	if(JWAL_FSYNC(wal->fd) != 0) return WALNotDurable;
+	return WALFail;
+}
+
+/**
+ * @fn static WALResult JWALFlushBuffer(JWALPtr wal)
+ * @brief 버퍼에 쌓인 기록을 파일에 쓰는 함수 (fsync 하지 않음)
+ * 실패하면 기록 일부만 파일에 쓰였을 수 있으므로 호출한 쪽에서 JWALAbort 로 되돌려야 한다.
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALFlushBuffer(JWALPtr wal)
+{
+	if(wal->bufferLength == 0) return WALSuccess;
+	if(_WriteAll(wal->fd, wal->buffer, wal->bufferLength) == WALFail) return WALFail;
+	wal->fileLength += (long long)wal->bufferLength;
+	wal->bufferLength = 0;
+	return WALSuccess;
+}
+
+/**
+ * @fn static WALResult JWALReserveBuffer(JWALPtr wal, size_t length)
+ * @brief 버퍼에 지정한 길이의 기록을 추가할 공간을 확보하는 함수
+ * 공간이 부족하면 먼저 버퍼를 파일에 쓰고, 그래도 부족하면(큰 문자열 키) 버퍼를 늘린다.
+ * @param wal 로그 구조체 객체의 주소(출력)
+ * @param length 추가할 기록의 길이(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALReserveBuffer(JWALPtr wal, size_t length)
+{
+	if(wal->bufferCapacity - wal->bufferLength >= length) return WALSuccess;
+	if(JWALFlushBuffer(wal) == WALFail)
+	{
+		JWALAbort(wal);
+		return WALFail;
+	}
+	if(wal->bufferCapacity >= length) return WALSuccess;
+
+	unsigned char *newBuffer = (unsigned char*)realloc(wal->buffer, length);
+	if(newBuffer == NULL) return WALFail;
+
+	wal->buffer = newBuffer;
+	wal->bufferCapacity = length;
+	return WALSuccess;
+}
+
+/**
+ * @fn static WALResult JWALLoadSnapshot(JAVLTreePtr tree, const char *snapshotPath)
+ * @brief 스냅샷 파일의 키들을 트리에 추가하는 함수
+ * 키가 정렬된 순서로 저장되어 있으므로 마지막 삽입 위치에서 이어서 추가한다.
+ * @param tree 키를 추가할 AVL Tree 구조체 객체의 주소(출력)
+ * @param snapshotPath 스냅샷 파일 경로(입력)
+ * @return 성공 시 WALSuccess, 파일이 손상되었으면 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALLoadSnapshot(JAVLTreePtr tree, const char *snapshotPath)
+{
+	FILE *file = fopen(snapshotPath, "rb");
+	if(file == NULL) return (errno == ENOENT) ? WALSuccess : WALFail;
+
+	unsigned char lengthBytes[4];
+	unsigned char *keyBytes = NULL;
+	unsigned char *key = NULL;
+	size_t keyBytesCapacity = 0;
+	size_t keyCapacity = 0;
+	unsigned int keyCount = 0;
+	unsigned int checksum = 2166136261U;
+	WALResult result = _ReadHeader(file, JWAL_SNAPSHOT_MAGIC, tree->type);
+
+	if(result == WALSuccess && fread(lengthBytes, 1, 4, file) == 4) keyCount = _ReadUInt32(lengthBytes);
+	else result = WALFail;
+
+	size_t fixedLength = (tree->type == IntType) ? 4 : 1;
+	if(_ReserveBuffer(tree, &keyBytes, &keyBytesCapacity, sizeof(int)) != WALSuccess || _ReserveBuffer(tree, &key, &keyCapacity, sizeof(int)) != WALSuccess) result = WALFail;
+
+	unsigned int index = 0;
+	for(; index < keyCount && result == WALSuccess; index++)
+	{
+		size_t keyLength = fixedLength;
+		size_t headerLength = 0;
+		if(tree->type == StringType)
+		{
+			// 문자열은 길이를 먼저 읽고 키 전체를 담을 수 있도록 버퍼를 늘린다.
+			if(fread(lengthBytes, 1, 4, file) != 4) { result = WALFail; break; }
+			checksum = _Checksum(checksum, lengthBytes, 4);
+			keyLength = _ReadUInt32(lengthBytes);
+			headerLength = 4;
+			if(keyLength > JWAL_MAX_RECORD_LENGTH) { result = WALFail; break; }
+
+			if(_ReserveBuffer(tree, &keyBytes, &keyBytesCapacity, keyLength + headerLength) != WALSuccess) { result = WALFail; break; }
+			if(_ReserveBuffer(tree, &key, &keyCapacity, keyLength + 1) != WALSuccess) { result = WALFail; break; }
+			memcpy(keyBytes, lengthBytes, 4);
+		}
+
+		if(fread(keyBytes + headerLength, 1, keyLength, file) != keyLength) { result = WALFail; break; }
+		checksum = _Checksum(checksum, keyBytes + headerLength, keyLength);
+		if(_DecodeKey(keyBytes, keyLength + headerLength, tree->type, key) == 0) { result = WALFail; break; }
+
+		// 키를 소유하는 트리는 추가할 때 복사하므로 따로 저장하지 않는다.
+		void *storedKey = (tree->keyOwner == KeyOwnerTree) ? key : JAVLTreeStoreKey(tree, key);
+		if(storedKey == NULL || JAVLTreeAddNodeHint(tree, NULL, storedKey) == NULL) result = WALFail;
+	}
+
+	if(result == WALSuccess && (fread(lengthBytes, 1, 4, file) != 4 || _ReadUInt32(lengthBytes) != checksum)) result = WALFail;
+
+	JAVLTreeFree(tree, keyBytes);
+	JAVLTreeFree(tree, key);
+	fclose(file);
+	return result;
+}
+
+/**
+ * @fn static WALResult JWALReplay(JAVLTreePtr tree, const char *walPath)
+ * @brief 로그 파일의 기록들을 순서대로 트리에 다시 적용하는 함수
+ * 이미 있는 키의 추가, 없는 키의 삭제는 무시하므로 같은 기록을 여러 번 적용해도 결과가 같다.
+ * @param tree 기록을 적용할 AVL Tree 구조체 객체의 주소(출력)
+ * @param walPath 로그 파일 경로(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult JWALReplay(JAVLTreePtr tree, const char *walPath)
+{
+	FILE *file = fopen(walPath, "rb");
+	if(file == NULL) return (errno == ENOENT) ? WALSuccess : WALFail;
+
+	// 헤더까지 끊긴 로그는 아무 기록도 없는 것으로 본다.
+	struct stat fileStat;
+	if(fstat(fileno(file), &fileStat) != 0)
+	{
+		fclose(file);
+		return WALFail;
+	}
+	if(fileStat.st_size < JWAL_HEADER_SIZE)
+	{
+		fclose(file);
+		return WALSuccess;
+	}
+
+	WALResult result = _ReadHeader(file, JWAL_MAGIC, tree->type);
+	long validLength = JWAL_HEADER_SIZE;
+	unsigned char lengthBytes[4];
+	unsigned char *body = NULL;
+	unsigned char *key = NULL;
+	size_t bodyCapacity = 0;
+	size_t keyCapacity = 0;
+
+	while(result == WALSuccess && fread(lengthBytes, 1, 4, file) == 4)
+	{
+		size_t bodyLength = _ReadUInt32(lengthBytes);
+		if(bodyLength < 2 || bodyLength > JWAL_MAX_RECORD_LENGTH) break;
+
+		if(_ReserveBuffer(tree, &body, &bodyCapacity, bodyLength + 4) != WALSuccess) { result = WALFail; break; }
+		if(_ReserveBuffer(tree, &key, &keyCapacity, bodyLength + sizeof(int)) != WALSuccess) { result = WALFail; break; }
+
+		if(fread(body, 1, bodyLength + 4, file) != bodyLength + 4) break;
+		if(_ReadUInt32(body + bodyLength) != _Checksum(2166136261U, body, bodyLength)) break;
+		if(_DecodeKey(body + 1, bodyLength - 1, tree->type, key) == 0) break;
+
+		if(body[0] == WALAddNode)
+		{
+			if(JAVLTreeFindNode(tree, key) == NULL)
+			{
+				void *storedKey = (tree->keyOwner == KeyOwnerTree) ? key : JAVLTreeStoreKey(tree, key);
+				if(storedKey == NULL || JAVLTreeAddNode(tree, storedKey) == NULL) result = WALFail;
+			}
+		}
+		else if(body[0] == WALDeleteNode) JAVLTreeDeleteNodeKey(tree, key);
+		else break;
+
+		validLength += (long)(bodyLength + JWAL_RECORD_OVERHEAD);
+	}
+
+	JAVLTreeFree(tree, body);
+	JAVLTreeFree(tree, key);
+	fclose(file);
+
+	if(result == WALSuccess && fileStat.st_size > validLength)
+	{
+		if(truncate(walPath, validLength) != 0) result = WALFail;
+	}
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static WALResult _WriteAll(int fd, const unsigned char *bytes, size_t length)
+ * @brief 지정한 바이트들을 모두 파일에 쓰는 함수 (일부만 쓰이면 나머지를 이어서 쓴다)
+ * @param fd 파일 디스크립터(입력)
+ * @param bytes 쓸 바이트 배열(입력, 읽기 전용)
+ * @param length 쓸 바이트 수(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult _WriteAll(int fd, const unsigned char *bytes, size_t length)
+{
+	while(length > 0)
+	{
+		ssize_t written = write(fd, bytes, length);
+		if(written < 0)
+		{
+			if(errno == EINTR) continue;
+			return WALFail;
+		}
+		bytes += written;
+		length -= (size_t)written;
+	}
+	return WALSuccess;
+}
+
+/**
+ * @fn static WALResult _ReserveBuffer(const JAVLTreePtr tree, unsigned char **buffer, size_t *capacity, size_t length)
+ * @brief 복구용 임시 버퍼가 지정한 길이 이상이 되도록 트리의 할당자로 다시 할당하는 함수
+ * 할당자에 realloc 이 없으므로 새로 할당하고 이전 버퍼를 해제한다. 버퍼는 매번 새로 읽어서 채우므로 내용은 옮기지 않는다.
+ * @param tree 할당자를 사용할 AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param buffer 버퍼 주소(입력, 출력)
+ * @param capacity 버퍼 크기(입력, 출력)
+ * @param length 필요한 바이트 수(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(기존 버퍼는 그대로 유지)
+ */
+static WALResult _ReserveBuffer(const JAVLTreePtr tree, unsigned char **buffer, size_t *capacity, size_t length)
+{
+	if(length <= *capacity) return WALSuccess;
+
+	unsigned char *newBuffer = (unsigned char*)JAVLTreeAlloc(tree, length);
+	if(newBuffer == NULL) return WALFail;
+
+	JAVLTreeFree(tree, *buffer);
+	*buffer = newBuffer;
+	*capacity = length;
+	return WALSuccess;
+}
+
+/**
+ * @fn static WALResult _SyncDirectory(const char *path)
+ * @brief 지정한 파일이 있는 디렉토리를 fsync 해서 이름 변경을 디스크에 남기는 함수
+ * @param path 파일 경로(입력)
+ * @return 성공 시 WALSuccess, 실패 시 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult _SyncDirectory(const char *path)
+{
+	const char *slash = strrchr(path, '/');
+	size_t length = (slash == NULL) ? 1 : (size_t)(slash - path);
+	if(length == 0) length = 1;
+
+	char *directory = (char*)malloc(length + 1);
+	if(directory == NULL) return WALFail;
+	if(slash == NULL) directory[0] = '.';
+	else memcpy(directory, (slash == path) ? "/" : path, length);
+	directory[length] = '\0';
+
+	WALResult result = WALFail;
+	int fd = open(directory, O_RDONLY);
+	if(fd >= 0)
+	{
+		if(fsync(fd) == 0) result = WALSuccess;
+		close(fd);
+	}
+
+	free(directory);
+	return result;
+}
+
+/**
+ * @fn static WALResult _ReadHeader(FILE *file, const char *magic, KeyType type)
+ * @brief 파일 헤더를 읽고 식별자와 키 데이터 유형이 맞는지 검사하는 함수
+ * @param file 읽을 파일(입력)
+ * @param magic 기대하는 파일 식별자(입력, 읽기 전용)
+ * @param type 기대하는 키 데이터 유형(입력)
+ * @return 맞으면 WALSuccess, 다르면 WALFail 반환(WALResult 열거형 참고)
+ */
+static WALResult _ReadHeader(FILE *file, const char *magic, KeyType type)
+{
+	unsigned char header[JWAL_HEADER_SIZE];
+	unsigned char expectedHeader[JWAL_HEADER_SIZE];
+
+	_EncodeHeader(expectedHeader, magic, type);
+	if(fread(header, 1, JWAL_HEADER_SIZE, file) != JWAL_HEADER_SIZE) return WALFail;
+	if(memcmp(header, expectedHeader, JWAL_HEADER_SIZE) != 0) return WALFail;
+	return WALSuccess;
+}
+
+/**
+ * @fn static void _EncodeHeader(unsigned char *bytes, const char *magic, KeyType type)
+ * @brief 파일 식별자와 키 데이터 유형으로 파일 헤더를 만드는 함수
+ * @param bytes 헤더를 저장할 바이트 배열(출력)
+ * @param magic 파일 식별자(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ */
+static void _EncodeHeader(unsigned char *bytes, const char *magic, KeyType type)
+{
+	memcpy(bytes, magic, 4);
+	_WriteUInt32(bytes + 4, (unsigned int)type);
+}
+
+/**
+ * @fn static size_t _GetEncodedKeySize(const void *key, KeyType type)
+ * @brief 키를 인코딩했을 때의 바이트 수를 구하는 함수
+ * @param key 인코딩할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return 인코딩된 키의 바이트 수 반환
+ */
+static size_t _GetEncodedKeySize(const void *key, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return 4;
+		case CharType:
+			return 1;
+		case StringType:
+			return 4 + strlen((const char*)key);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static void _EncodeKey(unsigned char *bytes, const void *key, KeyType type)
+ * @brief 키를 바이트 배열로 인코딩하는 함수
+ * @param bytes 인코딩된 키를 저장할 바이트 배열(출력)
+ * @param key 인코딩할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ */
+static void _EncodeKey(unsigned char *bytes, const void *key, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			_WriteUInt32(bytes, (unsigned int)*((const int*)key));
+			break;
+		case CharType:
+			bytes[0] = (unsigned char)*((const char*)key);
+			break;
+		case StringType:
+		{
+			size_t length = strlen((const char*)key);
+			_WriteUInt32(bytes, (unsigned int)length);
+			memcpy(bytes + 4, key, length);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+/**
+ * @fn static size_t _DecodeKey(const unsigned char *bytes, size_t length, KeyType type, unsigned char *key)
+ * @brief 인코딩된 바이트 배열에서 키를 복원하는 함수
+ * @param bytes 인코딩된 키(입력, 읽기 전용)
+ * @param length 인코딩된 키의 바이트 수(입력)
+ * @param type 키의 데이터 유형(입력)
+ * @param key 복원한 키를 저장할 공간, 정수 크기와 length + 1 중 큰 값 이상(출력)
+ * @return 성공 시 사용한 바이트 수, 길이가 맞지 않으면 0 반환
+ */
+static size_t _DecodeKey(const unsigned char *bytes, size_t length, KeyType type, unsigned char *key)
+{
+	switch(type)
+	{
+		case IntType:
+		{
+			if(length != 4) return 0;
+			int value = (int)_ReadUInt32(bytes);
+			memcpy(key, &value, sizeof(int));
+			return 4;
+		}
+		case CharType:
+			if(length != 1) return 0;
+			key[0] = bytes[0];
+			return 1;
+		case StringType:
+		{
+			if(length < 4 || _ReadUInt32(bytes) != length - 4) return 0;
+			memcpy(key, bytes + 4, length - 4);
+			key[length - 4] = '\0';
+			return length;
+		}
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static void _WriteUInt32(unsigned char *bytes, unsigned int value)
+ * @brief 32 비트 값을 리틀 엔디언으로 저장하는 함수
+ * @param bytes 값을 저장할 바이트 배열(출력)
+ * @param value 저장할 값(입력)
+ */
+static void _WriteUInt32(unsigned char *bytes, unsigned int value)
+{
+	bytes[0] = (unsigned char)(value & 0xFFU);
+	bytes[1] = (unsigned char)((value >> 8) & 0xFFU);
+	bytes[2] = (unsigned char)((value >> 16) & 0xFFU);
+	bytes[3] = (unsigned char)((value >> 24) & 0xFFU);
+}
+
+/**
+ * @fn static unsigned int _ReadUInt32(const unsigned char *bytes)
+ * @brief 리틀 엔디언으로 저장된 32 비트 값을 읽는 함수
+ * @param bytes 값이 저장된 바이트 배열(입력, 읽기 전용)
+ * @return 읽은 값 반환
+ */
+static unsigned int _ReadUInt32(const unsigned char *bytes)
+{
+	return (unsigned int)bytes[0]
+		| ((unsigned int)bytes[1] << 8)
+		| ((unsigned int)bytes[2] << 16)
+		| ((unsigned int)bytes[3] << 24);
+}
+
+/**
+ * @fn static unsigned int _Checksum(unsigned int hash, const unsigned char *bytes, size_t length)
+ * @brief 바이트 배열의 FNV-1a 32 비트 체크섬을 이어서 계산하는 함수
+ * @param hash 이전까지 계산한 체크섬, 처음에는 2166136261(입력)
+ * @param bytes 체크섬을 계산할 바이트 배열(입력, 읽기 전용)
+ * @param length 바이트 수(입력)
+ * @return 계산한 체크섬 반환
+ */
+static unsigned int _Checksum(unsigned int hash, const unsigned char *bytes, size_t length)
+{
+	size_t index = 0;
+	for(; index < length; index++)
+	{
+		hash ^= bytes[index];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+/**
+ * @fn static long long _GetMonotonicMicros()
+ * @brief 단조 시계의 현재 시각을 마이크로초 단위로 반환하는 함수
+ * @return 현재 시각(마이크로초) 반환
+ */
+static long long _GetMonotonicMicros()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long)now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+}
@@ -1,5 +1,23 @@
+#include <limits.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+
 #include "../include/ttlib.h"
 #include "../include/javltree.h"
+#include "../include/jcompactavltree.h"
+#include "../include/jwal.h"
+#include "../include/jmappedavltree.h"
+#include "../include/jbloomfilter.h"
+#include "../include/jlookupcache.h"
+#include "../include/jchunkedavltree.h"
+#include "../include/jintervaltree.h"
+#include "../include/jbufferedavltree.h"
+#include "../include/jingestqueue.h"
+#include "../include/jhashindex.h"
+#include "../include/jcharbitmap.h"
+#include "../include/jsmallavltree.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Definitions of Test
@@ -7,6 +25,379 @@
 
 DECLARE_TEST();
 
+/**
+ * @fn static int CheckAVLNode(const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리가 AVL Tree 조건을 만족하는지 검사하는 함수(재귀)
+ * 저장된 높이, 부모 노드 연결, 높이 차이를 모두 검사한다.
+ * @param node 검사할 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @return 조건을 만족하면 하위 트리의 높이, 만족하지 않으면 -1 반환
+ */
+static int CheckAVLNode(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+	if(node->left != NULL && node->left->parent != node) return -1;
+	if(node->right != NULL && node->right->parent != node) return -1;
+
+	int leftHeight = CheckAVLNode(node->left);
+	int rightHeight = CheckAVLNode(node->right);
+	if(leftHeight < 0 || rightHeight < 0) return -1;
+	if(leftHeight - rightHeight > 1 || rightHeight - leftHeight > 1) return -1;
+
+	int height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+	if(node->height != height) return -1;
+	return height;
+}
+
+/**
+ * @fn static int CheckWAVLNode(const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리가 WAVL 랭크 조건을 만족하는지 검사하는 함수(재귀)
+ * 자식과의 랭크 차이는 1 또는 2 이고, 자식이 없는 노드의 랭크는 1 이어야 한다. (없는 노드의 랭크는 0)
+ * @param node 검사할 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @return 조건을 만족하면 노드의 랭크, 만족하지 않으면 -1 반환
+ */
+static int CheckWAVLNode(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+	if(node->left != NULL && node->left->parent != node) return -1;
+	if(node->right != NULL && node->right->parent != node) return -1;
+
+	int leftRank = CheckWAVLNode(node->left);
+	int rightRank = CheckWAVLNode(node->right);
+	if(leftRank < 0 || rightRank < 0) return -1;
+	if(node->height - leftRank < 1 || node->height - leftRank > 2) return -1;
+	if(node->height - rightRank < 1 || node->height - rightRank > 2) return -1;
+	if(node->left == NULL && node->right == NULL && node->height != 1) return -1;
+	return node->height;
+}
+
+/**
+ * @fn static int CheckRedBlackNode(const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 하위 트리가 Red-Black 조건을 만족하는지 검사하는 함수(재귀)
+ * 빨간 노드(height 1)의 자식은 검은색이고, 모든 경로의 검은 노드 수가 같아야 한다.
+ * @param node 검사할 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @return 조건을 만족하면 검은 노드 수, 만족하지 않으면 -1 반환
+ */
+static int CheckRedBlackNode(const JNodePtr node)
+{
+	if(node == NULL) return 0;
+	if(node->left != NULL && node->left->parent != node) return -1;
+	if(node->right != NULL && node->right->parent != node) return -1;
+	if(node->height != 0 && node->height != 1) return -1;
+	if(node->height == 1 && ((node->left != NULL && node->left->height == 1) || (node->right != NULL && node->right->height == 1))) return -1;
+
+	int leftBlackCount = CheckRedBlackNode(node->left);
+	int rightBlackCount = CheckRedBlackNode(node->right);
+	if(leftBlackCount < 0 || leftBlackCount != rightBlackCount) return -1;
+	return leftBlackCount + (node->height == 0 ? 1 : 0);
+}
+
+/**
+ * @fn static int CheckBalancedTree(const JAVLTreePtr tree)
+ * @brief AVL Tree 가 균형 정책의 조건을 만족하고 정수 키가 순서대로 연결되어 있는지 검사하는 함수
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 만족하면 1, 만족하지 않으면 0 반환
+ */
+static int CheckBalancedTree(const JAVLTreePtr tree)
+{
+	JNodePtr node = JAVLTreeGetMin(tree);
+
+	for(; node != NULL && JNodeGetNext(node) != NULL; node = JNodeGetNext(node))
+	{
+		if(*((int*)JNodeGetKey(node)) >= *((int*)JNodeGetKey(JNodeGetNext(node)))) return 0;
+	}
+
+	switch(tree->balance)
+	{
+		case BalanceWAVL:
+			return CheckWAVLNode(tree->root) >= 0;
+		case BalanceRedBlack:
+			return CheckRedBlackNode(tree->root) >= 0 && (tree->root == NULL || tree->root->height == 0);
+		default:
+			return CheckAVLNode(tree->root) >= 0;
+	}
+}
+
+// 정수 키의 합, 최소, 최대, 개수를 저장하는 집계 값 구조체
+typedef struct _test_aggregate_t {
+	long long sum;
+	int min;
+	int max;
+	int count;
+} TestAggregate, *TestAggregatePtr;
+
+/**
+ * @fn static void TestAggregateIdentity(void *aggregate, void *userData)
+ * @brief 빈 범위의 집계 값(항등원)을 만드는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void TestAggregateIdentity(void *aggregate, void *userData)
+{
+	(void)userData;
+	memset(aggregate, 0, sizeof(TestAggregate));
+}
+
+/**
+ * @fn static void TestAggregateLift(void *aggregate, const void *key, void *userData)
+ * @brief 키 하나의 집계 값을 만드는 함수
+ * @param aggregate 집계 값을 저장할 주소(출력)
+ * @param key 정수 키의 주소(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void TestAggregateLift(void *aggregate, const void *key, void *userData)
+{
+	TestAggregatePtr result = (TestAggregatePtr)aggregate;
+	(void)userData;
+
+	result->sum = *((const int*)key);
+	result->min = *((const int*)key);
+	result->max = *((const int*)key);
+	result->count = 1;
+}
+
+/**
+ * @fn static void TestAggregateCombine(void *result, const void *left, const void *right, void *userData)
+ * @brief 왼쪽 범위와 오른쪽 범위의 집계 값을 결합하는 함수 (result 는 left 또는 right 와 같을 수 있음)
+ * @param result 결합한 집계 값을 저장할 주소(출력)
+ * @param left 왼쪽 범위의 집계 값(입력, 읽기 전용)
+ * @param right 오른쪽 범위의 집계 값(입력, 읽기 전용)
+ * @param userData 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void TestAggregateCombine(void *result, const void *left, const void *right, void *userData)
+{
+	TestAggregate leftValue = *((const TestAggregate*)left);
+	TestAggregate rightValue = *((const TestAggregate*)right);
+	TestAggregatePtr output = (TestAggregatePtr)result;
+	(void)userData;
+
+	if(leftValue.count == 0) *output = rightValue;
+	else if(rightValue.count == 0) *output = leftValue;
+	else
+	{
+		output->sum = leftValue.sum + rightValue.sum;
+		output->min = leftValue.min < rightValue.min ? leftValue.min : rightValue.min;
+		output->max = leftValue.max > rightValue.max ? leftValue.max : rightValue.max;
+		output->count = leftValue.count + rightValue.count;
+	}
+}
+
+/**
+ * @fn static int CheckAggregateNode(const JAVLTreePtr tree, const JNodePtr node, TestAggregatePtr aggregate)
+ * @brief 지정한 노드를 루트로 하는 하위 트리의 모든 집계 값이 직접 계산한 값과 같은지 검사하는 함수(재귀)
+ * @param tree AVL Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 검사할 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @param aggregate 직접 계산한 하위 트리의 집계 값(출력)
+ * @return 모두 같으면 1, 다르면 0 반환
+ */
+static int CheckAggregateNode(const JAVLTreePtr tree, const JNodePtr node, TestAggregatePtr aggregate)
+{
+	TestAggregate leftValue;
+	TestAggregate rightValue;
+
+	TestAggregateIdentity(aggregate, NULL);
+	if(node == NULL) return 1;
+	if(CheckAggregateNode(tree, node->left, &leftValue) == 0) return 0;
+	if(CheckAggregateNode(tree, node->right, &rightValue) == 0) return 0;
+
+	if((node->flags & JNODE_FLAG_TOMBSTONE) == 0) TestAggregateLift(aggregate, node->key, NULL);
+	TestAggregateCombine(aggregate, &leftValue, aggregate, NULL);
+	TestAggregateCombine(aggregate, aggregate, &rightValue, NULL);
+
+	const TestAggregate *stored = (const TestAggregate*)JAVLTreeGetAggregate(tree, node);
+	if(stored == NULL || stored->count != aggregate->count || stored->sum != aggregate->sum) return 0;
+	if(aggregate->count > 0 && (stored->min != aggregate->min || stored->max != aggregate->max)) return 0;
+	return 1;
+}
+
+/**
+ * @fn static int CompareReverseInt(const void *key1, const void *key2, void *userData)
+ * @brief 정수 키를 내림차순으로 비교하고 호출 횟수를 세는 CustomType 비교 함수
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @param userData 호출 횟수를 저장할 정수의 주소(출력)
+ * @return key1 이 크면 음수, 같으면 0, 작으면 양수 반환
+ */
+static int CompareReverseInt(const void *key1, const void *key2, void *userData)
+{
+	int value1 = *((const int*)key1);
+	int value2 = *((const int*)key2);
+	(*((int*)userData))++;
+	return (value1 < value2) - (value1 > value2);
+}
+
+/**
+ * @fn static void CountReleasedNode(JNodePtr node, void *userData)
+ * @brief JAVLTreeClear 가 떼어낸 노드 수를 세는 함수 (노드는 호출한 쪽 메모리이므로 해제하지 않음)
+ * @param node 떼어낸 노드(입력)
+ * @param userData 개수를 저장할 정수의 주소(출력)
+ * @return 반환값 없음
+ */
+static void CountReleasedNode(JNodePtr node, void *userData)
+{
+	(void)node;
+	(*((int*)userData))++;
+}
+
+/**
+ * @fn static long long TestClock(void *userData)
+ * @brief 테스트에서 지정한 현재 시각을 반환하는 함수
+ * @param userData 현재 시각을 저장한 정수의 주소(입력)
+ * @return 현재 시각
+ */
+static long long TestClock(void *userData)
+{
+	return *((long long*)userData);
+}
+
+// 삽입 버퍼 스레드 테스트에서 스레드 하나가 추가할 키 범위
+typedef struct _test_buffer_work_t {
+	// 앞단 구조체
+	JBufferedAVLTreePtr front;
+	// 전체 키 배열
+	int *keys;
+	// 처음 키 위치
+	int start;
+	// 키 위치 간격
+	int step;
+	// 추가할 키 개수
+	int count;
+} TestBufferWork, *TestBufferWorkPtr;
+
+/**
+ * @fn static void* TestBufferInsertThread(void *userData)
+ * @brief 자신의 삽입 버퍼를 만들어서 키를 추가하고, 끝나면 버퍼를 합치고 삭제하는 스레드 함수
+ * @param userData 추가할 키 범위(TestBufferWork)(입력)
+ * @return 항상 NULL 반환
+ */
+static void* TestBufferInsertThread(void *userData)
+{
+	TestBufferWorkPtr work = (TestBufferWorkPtr)userData;
+	JInsertBufferPtr buffer = NewJInsertBuffer(work->front);
+	int index = 0;
+
+	for(; index < work->count; index++)
+	{
+		int *key = &(work->keys[work->start + index * work->step]);
+		JInsertBufferAddKey(buffer, key);
+		// 다른 스레드의 버퍼에 있거나 이미 합쳐졌어도 자신이 추가한 키는 항상 찾을 수 있어야 한다.
+		if(JBufferedAVLTreeFindKey(work->front, key) != key) work->count = -1;
+	}
+
+	DeleteJInsertBuffer(&buffer);
+	return NULL;
+}
+
+// 작업 큐 테스트에서 완료 함수가 모으는 결과 구조체 (쓰기 스레드에서만 갱신)
+typedef struct _test_ingest_result_t {
+	// 성공한 작업 개수 (IngestInsert, IngestDelete, IngestFind 순서)
+	int successCounts[3];
+	// 실패한 작업 개수
+	int failCount;
+	// 마지막으로 찾은 키 주소
+	void *foundKey;
+} TestIngestResult, *TestIngestResultPtr;
+
+// 작업 큐 스레드 테스트에서 스레드 하나가 넣을 키 범위
+typedef struct _test_ingest_work_t {
+	// 작업 큐
+	JIngestQueuePtr queue;
+	// 완료 결과
+	TestIngestResultPtr result;
+	// 전체 키 배열
+	int *keys;
+	// 처음 키 위치
+	int start;
+	// 키 위치 간격
+	int step;
+	// 넣을 키 개수
+	int count;
+} TestIngestWork, *TestIngestWorkPtr;
+
+/**
+ * @fn static void TestIngestCallback(JIngestOperation operation, void *key, int result, void *userData)
+ * @brief 작업 결과를 종류별로 세는 작업 완료 함수
+ * @param operation 작업 종류(입력)
+ * @param key 작업한 키 주소(입력)
+ * @param result 성공 또는 찾았으면 1(입력)
+ * @param userData 결과를 모을 TestIngestResult 주소(출력)
+ * @return 반환값 없음
+ */
+static void TestIngestCallback(JIngestOperation operation, void *key, int result, void *userData)
+{
+	TestIngestResultPtr ingestResult = (TestIngestResultPtr)userData;
+
+	if(result == 0)
+	{
+		ingestResult->failCount++;
+		return;
+	}
+
+	ingestResult->successCounts[operation - IngestInsert]++;
+	if(operation == IngestFind) ingestResult->foundKey = key;
+}
+
+/**
+ * @fn static void* TestIngestSubmitThread(void *userData)
+ * @brief 작업 큐에 키 추가 작업을 넣는 스레드 함수 (큐가 가득 차면 양보하고 다시 넣음)
+ * @param userData 넣을 키 범위(TestIngestWork)(입력)
+ * @return 항상 NULL 반환
+ */
+static void* TestIngestSubmitThread(void *userData)
+{
+	TestIngestWorkPtr work = (TestIngestWorkPtr)userData;
+	int index = 0;
+
+	for(; index < work->count; index++)
+	{
+		int *key = &(work->keys[work->start + index * work->step]);
+		while(JIngestQueueSubmit(work->queue, IngestInsert, key, TestIngestCallback, work->result) == NULL) sched_yield();
+	}
+
+	return NULL;
+}
+
+// 할당자 테스트에서 할당, 해제 횟수를 세는 구조체
+typedef struct _test_allocator_count_t {
+	// 할당 횟수
+	int allocCount;
+	// 해제 횟수 (NULL 해제는 세지 않음)
+	int freeCount;
+	// 0 이 아니면 할당 횟수가 이 값에 이른 뒤의 할당은 실패
+	int allocLimit;
+} TestAllocatorCount, *TestAllocatorCountPtr;
+
+/**
+ * @fn static void* TestCountingAlloc(size_t size, void *context)
+ * @brief 할당 횟수를 세고 malloc 으로 할당하는 할당 함수
+ * @param size 할당할 바이트 수(입력)
+ * @param context 횟수를 저장할 TestAllocatorCount 주소(출력)
+ * @return 성공 시 할당된 메모리의 주소, 실패 시 NULL 반환
+ */
+static void* TestCountingAlloc(size_t size, void *context)
+{
+	TestAllocatorCountPtr count = (TestAllocatorCountPtr)context;
+	if(count->allocLimit > 0 && count->allocCount >= count->allocLimit) return NULL;
+	count->allocCount++;
+	return malloc(size);
+}
+
+/**
+ * @fn static void TestCountingFree(void *pointer, void *context)
+ * @brief 해제 횟수를 세고 free 로 해제하는 해제 함수
+ * @param pointer 해제할 메모리의 주소(입력)
+ * @param context 횟수를 저장할 TestAllocatorCount 주소(출력)
+ * @return 반환값 없음
+ */
+static void TestCountingFree(void *pointer, void *context)
+{
+	if(pointer == NULL) return;
+	((TestAllocatorCountPtr)context)->freeCount++;
+	free(pointer);
+}
+
 // ---------- Common Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +425,44 @@ TEST(AVLTree, CreateAndDeleteAVLTree, {
 	EXPECT_NUM_EQUAL(DeleteJAVLTree(NULL), DeleteFail, int);
 })
 
+TEST(AVLTree, CustomCompare, {
+	JAVLTreePtr tree = NewJAVLTree(CustomType);
+	JAVLTreePtr intTree = NewJAVLTree(IntType);
+	int keys[100];
+	int compareCount = 0;
+	int index = 0;
+	int key = 0;
+
+	// 비교 함수를 설정하기 전에는 추가할 수 없다.
+	keys[0] = 0;
+	EXPECT_NULL(JAVLTreeAddNode(tree, &keys[0]));
+	EXPECT_NULL(JAVLTreeSetCompare(intTree, CompareReverseInt, &compareCount));
+	EXPECT_NULL(JAVLTreeSetCompare(tree, NULL, NULL));
+	EXPECT_PTR_EQUAL(JAVLTreeSetCompare(tree, CompareReverseInt, &compareCount), tree);
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[index]));
+	}
+	EXPECT_NUM_EQUAL(compareCount > 0, 1, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NULL(JAVLTreeSetCompare(tree, CompareReverseInt, &compareCount));
+
+	// 비교 함수의 순서(내림차순)대로 정렬된다.
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 99, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 0, int);
+	key = 50;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeFindNode(tree, &key))), 50, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeUpperBound(tree, &key))), 49, int);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeLowerBound(tree, &key))), 49, int);
+	EXPECT_NULL(JAVLTreeStoreKey(tree, &key));
+
+	DeleteJAVLTree(&tree);
+	DeleteJAVLTree(&intTree);
+})
+
 // ---------- AVL Tree int Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -86,7 +515,8 @@ TEST(AVLTree_INT, AddNode, {
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected3));
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected4));
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected5));
-	EXPECT_NUM_EQUAL(*((int*)(tree->root->key)), expected3, int);
+	// 1~5 순서로 삽입하면 3 을 기준으로 RR 회전이 일어나서 2 가 루트 노드가 된다.
+	EXPECT_NUM_EQUAL(*((int*)(tree->root->key)), expected2, int);
 	
 	JAVLTreeInorderTraverse(tree);
 
@@ -159,6 +589,911 @@ TEST(AVLTree_INT, DeleteNodeKey, {
 	DeleteJAVLTree(&tree);
 })
 
+TEST(AVLTree_INT, BoundQuery, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[5];
+	int index = 0;
+	for(; index < 5; index++)
+	{
+		keys[index] = (index + 1) * 10;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	int target = 30;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeLowerBound(tree, &target))), 30, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeUpperBound(tree, &target))), 40, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeFloor(tree, &target))), 30, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeCeiling(tree, &target))), 30, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreePredecessor(tree, &target))), 20, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeSuccessor(tree, &target))), 40, int);
+
+	// 저장되지 않은 키 기준
+	target = 35;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeLowerBound(tree, &target))), 40, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeFloor(tree, &target))), 30, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreePredecessor(tree, &target))), 30, int);
+
+	// 범위를 벗어난 키 기준
+	target = 5;
+	EXPECT_NULL(JAVLTreeFloor(tree, &target));
+	EXPECT_NULL(JAVLTreePredecessor(tree, &target));
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeCeiling(tree, &target))), 10, int);
+	target = 50;
+	EXPECT_NULL(JAVLTreeUpperBound(tree, &target));
+	EXPECT_NULL(JAVLTreeSuccessor(tree, &target));
+
+	EXPECT_NULL(JAVLTreeLowerBound(NULL, &target));
+	EXPECT_NULL(JAVLTreeLowerBound(tree, NULL));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, Balance, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[1000];
+	int index = 0;
+
+	// 정렬된 순서와 뒤섞인 순서로 삽입해도 균형이 유지되는지 확인
+	for(index = 0; index < 1000; index++)
+	{
+		keys[index] = (index * 7919) % 1000;
+		EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[index]));
+	}
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(tree->root->height <= 15, 1, int);
+
+	// 값이 같은 다른 주소의 키도 중복으로 처리
+	int duplicated = 500;
+	EXPECT_NULL(JAVLTreeAddNode(tree, &duplicated));
+
+	for(index = 0; index < 1000; index += 2)
+	{
+		EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[index]), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NULL(tree->root->parent);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, MinMax, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[100];
+	int index = 0;
+
+	EXPECT_NULL(JAVLTreeGetMin(tree));
+	EXPECT_NULL(JAVLTreeGetMax(tree));
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = (index * 37) % 100;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 0, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 99, int);
+
+	// 최소, 최대 노드 삭제 시 다음 노드로 갱신
+	int target = 0;
+	JAVLTreeDeleteNodeKey(tree, &target);
+	target = 99;
+	JAVLTreeDeleteNodeKey(tree, &target);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 1, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 98, int);
+
+	EXPECT_NULL(JAVLTreeGetMin(NULL));
+	EXPECT_NULL(JAVLTreeGetMax(NULL));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, PopMinMax, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[100];
+	int index = 0;
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = (index * 37) % 100;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	// 우선순위 큐처럼 양쪽 끝에서 순서대로 꺼낸다.
+	for(index = 0; index < 50; index++)
+	{
+		EXPECT_NUM_EQUAL(*((int*)JAVLTreePopMin(tree)), index, int);
+		EXPECT_NUM_EQUAL(*((int*)JAVLTreePopMax(tree)), 99 - index, int);
+		if(CheckAVLNode(tree->root) < 0) break;
+	}
+	EXPECT_NUM_EQUAL(index, 50, int);
+	EXPECT_NULL(tree->root);
+	EXPECT_NULL(JAVLTreeGetMin(tree));
+	EXPECT_NULL(JAVLTreeGetMax(tree));
+
+	EXPECT_NULL(JAVLTreePopMin(tree));
+	EXPECT_NULL(JAVLTreePopMax(tree));
+	EXPECT_NULL(JAVLTreePopMin(NULL));
+	EXPECT_NULL(JAVLTreePopMax(NULL));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, AddNodeHint, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[1000];
+	int index = 0;
+	JNodePtr hint = NULL;
+
+	// 거의 정렬된 순서(인접한 두 키가 뒤바뀜)로 직전 삽입 노드를 힌트로 사용
+	for(index = 0; index < 1000; index++) keys[index] = (index % 2 == 0) ? index + 1 : index - 1;
+	for(index = 0; index < 500; index++)
+	{
+		hint = JAVLTreeAddNodeHint(tree, hint, &keys[index]);
+		EXPECT_NOT_NULL(hint);
+		EXPECT_PTR_EQUAL(JNodeGetKey(hint), &keys[index]);
+	}
+
+	// 힌트가 NULL 이면 마지막으로 추가된 노드부터 탐색
+	for(; index < 1000; index++)
+	{
+		EXPECT_NOT_NULL(JAVLTreeAddNodeHint(tree, NULL, &keys[index]));
+	}
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	// 중위 순회 순서 확인
+	JNodePtr node = JAVLTreeGetMin(tree);
+	for(index = 0; node != NULL; index++, node = JNodeGetNext(node))
+	{
+		if(*((int*)JNodeGetKey(node)) != index) break;
+	}
+	EXPECT_NUM_EQUAL(index, 1000, int);
+
+	// 힌트와 멀리 떨어진 키, 중복 키
+	int target = 500;
+	int farKey = -10;
+	hint = JAVLTreeLowerBound(tree, &target);
+	EXPECT_NOT_NULL(JAVLTreeAddNodeHint(tree, hint, &farKey));
+	EXPECT_PTR_EQUAL(JNodeGetKey(JAVLTreeGetMin(tree)), &farKey);
+	EXPECT_NULL(JAVLTreeAddNodeHint(tree, hint, &target));
+	EXPECT_NULL(JAVLTreeAddNodeHint(tree, JAVLTreeGetMax(tree), &keys[10]));
+
+	EXPECT_NULL(JAVLTreeAddNodeHint(NULL, hint, &target));
+	EXPECT_NULL(JAVLTreeAddNodeHint(tree, hint, NULL));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, FindNode, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[100];
+	int index = 0;
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index * 2;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	int target = 42;
+	EXPECT_PTR_EQUAL(JNodeGetKey(JAVLTreeFindNode(tree, &target)), &keys[21]);
+	target = 43;
+	EXPECT_NULL(JAVLTreeFindNode(tree, &target));
+
+	EXPECT_NULL(JAVLTreeFindNode(NULL, &target));
+	EXPECT_NULL(JAVLTreeFindNode(tree, NULL));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, FindBatch, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[100];
+	int targets[40];
+	void *targetKeys[40];
+	JNodePtr results[40];
+	int index = 0;
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index * 2;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	// 그룹 크기보다 많은 키, 있는 키와 없는 키를 섞어서 검색
+	for(index = 0; index < 40; index++)
+	{
+		targets[index] = index * 5;
+		targetKeys[index] = &targets[index];
+	}
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, targetKeys, 40, results), 20, int);
+	for(index = 0; index < 40; index++)
+	{
+		if(index % 2 == 0)
+		{
+			EXPECT_PTR_EQUAL(JNodeGetKey(results[index]), &keys[index * 5 / 2]);
+		}
+		else
+		{
+			EXPECT_NULL(results[index]);
+		}
+	}
+
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, targetKeys, 0, results), 0, int);
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(NULL, targetKeys, 40, results), -1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, NULL, 40, results), -1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, targetKeys, 40, NULL), -1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, LazyDelete, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int keys[100];
+	int index = 0;
+	int key = 0;
+
+	EXPECT_NULL(JAVLTreeSetLazyDelete(tree, 101));
+	EXPECT_NOT_NULL(JAVLTreeSetLazyDelete(tree, 50));
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	// 삭제 표시만 하므로 트리 구조는 바뀌지 않는다.
+	JNodePtr rootNode = tree->root;
+	for(index = 0; index < 40; index += 2) EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[index]), DeleteSuccess, int);
+	EXPECT_PTR_EQUAL(tree->root, rootNode);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 20, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 80, int);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[0]), DeleteFail, int);
+
+	// 검색, 경계 검색, 순회는 삭제 표시된 노드를 건너뛴다.
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[2]));
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 1, int);
+	key = 2;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeLowerBound(tree, &key))), 3, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeFloor(tree, &key))), 1, int);
+	key = 5;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeSuccessor(tree, &key))), 7, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreePredecessor(tree, &key))), 3, int);
+
+	int count = 0;
+	JNodePtr node = JAVLTreeGetMin(tree);
+	for(; node != NULL; node = JNodeGetNext(node)) count++;
+	EXPECT_NUM_EQUAL(count, 80, int);
+
+	// 삭제 표시된 키를 다시 추가하면 같은 노드를 되살린다.
+	key = 2;
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &key));
+	EXPECT_NUM_EQUAL(tree->nodeCount, 100, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 19, int);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JAVLTreeFindNode(tree, &keys[2])), &key);
+	EXPECT_NULL(JAVLTreeAddNodeHint(tree, NULL, &keys[2]));
+
+	// 가장자리의 삭제 표시된 노드는 꺼낼 때 실제로 삭제된다.
+	EXPECT_NUM_EQUAL(*((int*)JAVLTreePopMin(tree)), 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 18, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 80, int);
+
+	// 삭제 표시된 노드 비율이 50% 가 되면 트리를 다시 만든다.
+	for(index = 40; index < 100 && JAVLTreeGetTombstoneCount(tree) > 0; index++) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	EXPECT_NUM_EQUAL(index, 71, int);
+	EXPECT_NUM_EQUAL(tree->nodeCount, JAVLTreeGetSize(tree), int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 2, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 99, int);
+
+	// 지연 삭제 모드를 끄면 남은 삭제 표시 노드를 정리하고 바로 삭제한다.
+	JAVLTreeDeleteNodeKey(tree, &keys[99]);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 1, int);
+	EXPECT_NOT_NULL(JAVLTreeSetLazyDelete(tree, 0));
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 0, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 98, int);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[98]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 0, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, Aggregate, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JAVLTreeAugment augment;
+	TestAggregate aggregate;
+	TestAggregate expected;
+	int keys[1000];
+	int isPresent[1000];
+	int index = 0;
+	int round = 0;
+	int lowKey = 0;
+	int highKey = 0;
+
+	augment.aggregateSize = sizeof(TestAggregate);
+	augment.identity = TestAggregateIdentity;
+	augment.lift = TestAggregateLift;
+	augment.combine = TestAggregateCombine;
+	augment.userData = NULL;
+
+	EXPECT_NULL(JAVLTreeAggregateRange(tree, &lowKey, &highKey, &aggregate));
+	EXPECT_NOT_NULL(JAVLTreeSetAugment(tree, &augment));
+	srand(37);
+
+	// 임의 순서로 추가, 삭제하면서 모든 노드의 집계 값을 검사한다.
+	for(index = 0; index < 1000; index++)
+	{
+		keys[index] = index * 3;
+		isPresent[index] = 0;
+	}
+	for(round = 0; round < 4000; round++)
+	{
+		index = rand() % 1000;
+		if(round == 2000) JAVLTreeSetLazyDelete(tree, 50);
+		if(isPresent[index] == 0)
+		{
+			EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[index]));
+			isPresent[index] = 1;
+		}
+		else
+		{
+			EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[index]), DeleteSuccess, int);
+			isPresent[index] = 0;
+		}
+		if(round % 500 == 0) EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	}
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL(aggregate.count, JAVLTreeGetSize(tree), int);
+
+	// 범위 집계 값을 직접 계산한 값과 비교한다. (경계 키가 없는 경우, 빈 범위 포함)
+	for(round = 0; round < 300; round++)
+	{
+		lowKey = rand() % 3100 - 50;
+		highKey = lowKey + rand() % 1500 - 100;
+
+		TestAggregateIdentity(&expected, NULL);
+		for(index = 0; index < 1000; index++)
+		{
+			if(isPresent[index] == 0 || keys[index] < lowKey || keys[index] > highKey) continue;
+			TestAggregateLift(&aggregate, &keys[index], NULL);
+			TestAggregateCombine(&expected, &expected, &aggregate, NULL);
+		}
+
+		EXPECT_PTR_EQUAL(JAVLTreeAggregateRange(tree, &lowKey, &highKey, &aggregate), tree);
+		EXPECT_NUM_EQUAL(aggregate.count, expected.count, int);
+		EXPECT_NUM_EQUAL(aggregate.sum == expected.sum, 1, int);
+		if(expected.count > 0)
+		{
+			EXPECT_NUM_EQUAL(aggregate.min, expected.min, int);
+			EXPECT_NUM_EQUAL(aggregate.max, expected.max, int);
+		}
+	}
+
+	// 지연 삭제 모드를 끄면 트리를 다시 만들어도 집계 값이 유지된다.
+	EXPECT_NOT_NULL(JAVLTreeSetLazyDelete(tree, 0));
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+
+	// 노드가 있는 트리에는 설정을 바꿀 수 없다.
+	EXPECT_NULL(JAVLTreeSetAugment(tree, NULL));
+	EXPECT_NULL(JAVLTreeAggregateRange(tree, NULL, &highKey, &aggregate));
+
+	DeleteJAVLTree(&tree);
+
+	tree = NewJAVLTree(IntType);
+	augment.combine = NULL;
+	EXPECT_NULL(JAVLTreeSetAugment(tree, &augment));
+	EXPECT_NUM_EQUAL(JAVLTreeGetAggregate(tree, tree->root) == NULL, 1, int);
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, InsertExtractNode, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JNode nodes[64];
+	JNode duplicateNode;
+	int keys[64];
+	int releaseCount = 0;
+	int index = 0;
+
+	for(index = 0; index < 64; index++)
+	{
+		keys[index] = (index * 37) % 64;
+		nodes[index].key = &keys[index];
+		EXPECT_PTR_EQUAL(JAVLTreeInsertNode(tree, &nodes[index]), &nodes[index]);
+	}
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 64, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_PTR_EQUAL(JAVLTreeFindNode(tree, &keys[10]), &nodes[10]);
+
+	// 같은 키는 연결하지 않는다.
+	duplicateNode.key = &keys[5];
+	EXPECT_NULL(JAVLTreeInsertNode(tree, &duplicateNode));
+	EXPECT_NULL(JAVLTreeInsertNode(tree, NULL));
+
+	// 떼어낸 노드는 해제되지 않으므로 다시 연결할 수 있다.
+	for(index = 0; index < 64; index += 2)
+	{
+		EXPECT_PTR_EQUAL(JAVLTreeExtractNode(tree, &nodes[index]), &nodes[index]);
+	}
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 32, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[0]));
+	EXPECT_PTR_EQUAL(JAVLTreeInsertNode(tree, &nodes[0]), &nodes[0]);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 0, int);
+
+	// 연결한 노드가 남아 있으면 삭제 표시 후 트리의 할당자로 해제될 수 있으므로 지연 삭제 모드를 켤 수 없다.
+	EXPECT_NUM_EQUAL(tree->externalCount, 33, int);
+	EXPECT_NULL(JAVLTreeSetLazyDelete(tree, 50));
+	EXPECT_NUM_EQUAL(tree->tombstoneThreshold, 0, int);
+
+	EXPECT_PTR_EQUAL(JAVLTreeClear(tree, CountReleasedNode, &releaseCount), tree);
+	EXPECT_NUM_EQUAL(releaseCount, 33, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 0, int);
+	EXPECT_NULL(JAVLTreeGetMin(tree));
+
+	// 모두 떼어낸 뒤에는 켤 수 있고, 지연 삭제 모드에서는 연결할 수 없다.
+	EXPECT_NUM_EQUAL(tree->externalCount, 0, int);
+	EXPECT_PTR_EQUAL(JAVLTreeSetLazyDelete(tree, 50), tree);
+	EXPECT_NULL(JAVLTreeInsertNode(tree, &nodes[2]));
+	JAVLTreeSetLazyDelete(tree, 0);
+
+	// 트리가 할당한 노드는 release 없이 비우면 DeleteJNode 로 해제된다.
+	for(index = 0; index < 64; index++) JAVLTreeAddNode(tree, &keys[index]);
+	EXPECT_PTR_EQUAL(JAVLTreeClear(tree, NULL, NULL), tree);
+	EXPECT_NULL(tree->root);
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[0]));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, Expire, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	long long now = -1;
+	int keys[100];
+	int otherKey = 0;
+	int index = 0;
+
+	// 만료 시각은 빈 트리에서 설정해야 사용할 수 있다.
+	keys[0] = 1000;
+	EXPECT_NULL(JAVLTreeAddNodeExpire(tree, &keys[0], 10));
+	JAVLTreeAddNode(tree, &keys[0]);
+	EXPECT_NULL(JAVLTreeEnableExpiry(tree, TestClock, &now));
+	JAVLTreeDeleteNodeKey(tree, &keys[0]);
+	EXPECT_PTR_EQUAL(JAVLTreeEnableExpiry(tree, TestClock, &now), tree);
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(NULL, 0, 0), -1, int);
+
+	// 키 k 는 시각 k 에 만료된다.
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = (index * 37) % 100;
+		EXPECT_NOT_NULL(JAVLTreeAddNodeExpire(tree, &keys[index], keys[index]));
+	}
+	EXPECT_NULL(JAVLTreeAddNodeExpire(tree, &keys[0], 5));
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	otherKey = 42;
+	EXPECT_NUM_EQUAL(JAVLTreeGetExpire(tree, JAVLTreeFindNode(tree, &otherKey)) == 42, 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, -1, 0), 0, int);
+
+	// 현재 시각 함수가 있으면 삭제 전에도 만료된 키는 찾지 않는다.
+	now = 10;
+	otherKey = 5;
+	EXPECT_NULL(JAVLTreeFindNode(tree, &otherKey));
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 100, int);
+	otherKey = 11;
+	EXPECT_NOT_NULL(JAVLTreeFindNode(tree, &otherKey));
+
+	// 한 번에 삭제할 개수를 제한하면 나머지는 다음 호출에서 삭제한다.
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, now, 4), 4, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 4, int);
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, now, 0), 7, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 89, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 11, int);
+
+	// 만료 시각을 바꾸거나 지우고, 만료 전에 삭제해도 힙이 맞게 유지된다.
+	otherKey = 50;
+	EXPECT_NOT_NULL(JAVLTreeSetExpire(tree, JAVLTreeFindNode(tree, &otherKey), 3));
+	otherKey = 60;
+	EXPECT_NOT_NULL(JAVLTreeSetExpire(tree, JAVLTreeFindNode(tree, &otherKey), JAVLTREE_NO_EXPIRE));
+	EXPECT_NUM_EQUAL(JAVLTreeGetExpire(tree, JAVLTreeFindNode(tree, &otherKey)) == JAVLTREE_NO_EXPIRE, 1, int);
+	otherKey = 70;
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &otherKey), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, now, 0), 1, int);
+	otherKey = 50;
+	EXPECT_NULL(JAVLTreeFindNode(tree, &otherKey));
+
+	// 지연 삭제 모드에서는 삭제 표시로 만료한다.
+	JAVLTreeSetLazyDelete(tree, 90);
+	now = 100;
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, 30, 0), 20, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 20, int);
+	otherKey = 20;
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &otherKey));
+	EXPECT_NUM_EQUAL(JAVLTreeGetExpire(tree, JAVLTreeFindNode(tree, &otherKey)) == JAVLTREE_NO_EXPIRE, 1, int);
+	JAVLTreeSetLazyDelete(tree, 0);
+	JAVLTreePurgeTombstones(tree);
+
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, now, 0), 66, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 2, int);
+	otherKey = 60;
+	EXPECT_NOT_NULL(JAVLTreeFindNode(tree, &otherKey));
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, BalancePolicy, {
+	JAVLTreeOptions options;
+	JAVLTreeAugment augment;
+	JAVLTreePtr trees[3];
+	TestAggregate aggregate;
+	int keys[1000];
+	int balances[3];
+	int step = 0;
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&augment, 0, sizeof(JAVLTreeAugment));
+	augment.aggregateSize = sizeof(TestAggregate);
+	augment.identity = TestAggregateIdentity;
+	augment.lift = TestAggregateLift;
+	augment.combine = TestAggregateCombine;
+
+	balances[0] = BalanceAVL;
+	balances[1] = BalanceWAVL;
+	balances[2] = BalanceRedBlack;
+	for(index = 0; index < 3; index++)
+	{
+		options.balance = (JAVLTreeBalance)balances[index];
+		trees[index] = NewJAVLTreeEx(IntType, &options);
+		EXPECT_NOT_NULL(JAVLTreeSetAugment(trees[index], &augment));
+		EXPECT_NUM_EQUAL(trees[index]->balance, balances[index], int);
+	}
+	options.balance = (JAVLTreeBalance)123;
+	EXPECT_NULL(NewJAVLTreeEx(IntType, &options));
+	for(index = 0; index < 1000; index++) keys[index] = index;
+
+	// 같은 순서로 추가, 삭제하면 정책마다 조건을 만족하고 크기와 집계 값도 맞는다.
+	srand(42);
+	for(step = 1; step <= 6000; step++)
+	{
+		int key = rand() % 1000;
+		int isDelete = (step > 3000) ? (rand() % 3 != 0) : (rand() % 3 == 0);
+		for(index = 0; index < 3; index++)
+		{
+			if(isDelete) JAVLTreeDeleteNodeKey(trees[index], &keys[key]);
+			else JAVLTreeAddNode(trees[index], &keys[key]);
+		}
+
+		if(step % 500 == 0)
+		{
+			for(index = 0; index < 3; index++)
+			{
+				EXPECT_NUM_EQUAL(CheckBalancedTree(trees[index]), 1, int);
+				EXPECT_NUM_EQUAL(CheckAggregateNode(trees[index], trees[index]->root, &aggregate), 1, int);
+				EXPECT_NUM_EQUAL(JAVLTreeGetSize(trees[index]), JAVLTreeGetSize(trees[0]), int);
+			}
+		}
+	}
+	for(index = 0; index < 3; index++)
+	{
+		EXPECT_NUM_EQUAL(JAVLTreeGetRotationCount(trees[index]) > 0, 1, int);
+	}
+
+	// 지연 삭제 후 다시 만든 트리도 조건을 만족한다.
+	for(index = 0; index < 3; index++)
+	{
+		JAVLTreeSetLazyDelete(trees[index], 50);
+		for(step = 0; step < 1000; step += 3) JAVLTreeDeleteNodeKey(trees[index], &keys[step]);
+		JAVLTreePurgeTombstones(trees[index]);
+		EXPECT_NUM_EQUAL(CheckBalancedTree(trees[index]), 1, int);
+		JAVLTreeSetLazyDelete(trees[index], 0);
+		for(step = 0; step < 1000; step += 2) JAVLTreeAddNode(trees[index], &keys[step]);
+		EXPECT_NUM_EQUAL(CheckBalancedTree(trees[index]), 1, int);
+		EXPECT_NUM_EQUAL(CheckAggregateNode(trees[index], trees[index]->root, &aggregate), 1, int);
+		while(JAVLTreePopMin(trees[index]) != NULL)
+		{
+			if(JAVLTreeGetSize(trees[index]) % 97 == 0)
+			{
+				EXPECT_NUM_EQUAL(CheckBalancedTree(trees[index]), 1, int);
+			}
+		}
+		EXPECT_NULL(trees[index]->root);
+		DeleteJAVLTree(&trees[index]);
+	}
+})
+
+TEST(AVLTree_INT, RelaxedBalance, {
+	JAVLTreeOptions options;
+	JAVLTreeAugment augment;
+	TestAggregate aggregate;
+	int keys[1000];
+	int index = 0;
+	int stepCount = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.balance = BalanceWAVL;
+	JAVLTreePtr wavlTree = NewJAVLTreeEx(IntType, &options);
+	EXPECT_NULL(JAVLTreeSetRelaxed(wavlTree, 1, 0));
+	DeleteJAVLTree(&wavlTree);
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	memset(&augment, 0, sizeof(JAVLTreeAugment));
+	augment.aggregateSize = sizeof(TestAggregate);
+	augment.identity = TestAggregateIdentity;
+	augment.lift = TestAggregateLift;
+	augment.combine = TestAggregateCombine;
+	EXPECT_NOT_NULL(JAVLTreeSetAugment(tree, &augment));
+	EXPECT_NULL(JAVLTreeSetRelaxed(tree, 1, -1));
+	EXPECT_NULL(JAVLTreeSetRelaxed(tree, 2, 0));
+	EXPECT_NOT_NULL(JAVLTreeSetRelaxed(tree, 1, 0));
+	EXPECT_NUM_EQUAL(JAVLTreeRebalanceStep(tree, 10), 0, int);
+
+	// 완화 균형 모드에서 오름차순으로 추가하면 회전하지 않고 트리가 높아진다.
+	for(index = 0; index < 1000; index++) keys[index] = index;
+	for(index = 0; index < 300; index++) JAVLTreeAddNode(tree, &keys[index]);
+	EXPECT_NUM_EQUAL(JAVLTreeGetRotationCount(tree) == 0, 1, int);
+	EXPECT_NUM_EQUAL(tree->root->height, 300, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root), -1, int);
+	EXPECT_NUM_EQUAL(CheckBalancedTree(tree) == 0 && JAVLTreeGetSize(tree) == 300, 1, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeFindNode(tree, &keys[123]))), 123, int);
+
+	// 정해진 작업량만큼 나눠서 처리하면 AVL 조건을 다시 만족한다.
+	while(JAVLTreeRebalanceStep(tree, 16) == 1) stepCount++;
+	EXPECT_NUM_EQUAL(stepCount > 10, 1, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL((tree->root->flags & JNODE_FLAG_UNBALANCED), 0, int);
+
+	// 삭제도 표시만 하고, 모드를 끄면 남은 작업을 모두 처리한다.
+	for(index = 0; index < 300; index += 2) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	for(index = 999; index >= 300; index--) JAVLTreeAddNode(tree, &keys[index]);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root), -1, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NOT_NULL(JAVLTreeSetRelaxed(tree, 0, 0));
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 850, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 1, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMax(tree))), 999, int);
+
+	// 추가, 삭제할 때마다 조금씩 처리하면 높이가 AVL 높이 근처에 머문다.
+	EXPECT_NOT_NULL(JAVLTreeSetRelaxed(tree, 1, 8));
+	srand(7);
+	for(stepCount = 1; stepCount <= 5000; stepCount++)
+	{
+		int key = rand() % 1000;
+		if(rand() % 2 == 0) JAVLTreeDeleteNodeKey(tree, &keys[key]);
+		else JAVLTreeAddNode(tree, &keys[key]);
+		if(stepCount % 500 == 0)
+		{
+			EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+			EXPECT_NUM_EQUAL(tree->root->height < 20, 1, int);
+		}
+	}
+	while(JAVLTreeRebalanceStep(tree, 8) == 1);
+	EXPECT_NUM_EQUAL(CheckBalancedTree(tree), 1, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_INT, OwnedKeys, {
+	JAVLTreeOptions options;
+	JAVLTreeAugment augment;
+	TestAggregate aggregate;
+	int key = 0;
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&augment, 0, sizeof(JAVLTreeAugment));
+	options.keyOwner = KeyOwnerTree;
+	augment.aggregateSize = sizeof(TestAggregate);
+	augment.identity = TestAggregateIdentity;
+	augment.lift = TestAggregateLift;
+	augment.combine = TestAggregateCombine;
+
+	// 노드 뒤에 집계 값, 힙 위치, 키 공간이 차례로 붙어도 서로 덮어쓰지 않는다.
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	EXPECT_NUM_EQUAL(tree->keyOwner, KeyOwnerTree, int);
+	EXPECT_NOT_NULL(JAVLTreeSetAugment(tree, &augment));
+	EXPECT_NOT_NULL(JAVLTreeEnableExpiry(tree, NULL, NULL));
+
+	// 같은 변수를 바꿔 가며 추가해도 트리는 복사본을 가진다.
+	for(index = 0; index < 100; index++)
+	{
+		key = index;
+		EXPECT_NOT_NULL(JAVLTreeAddNodeExpire(tree, &key, index));
+	}
+	key = -1;
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 100, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 0, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL((aggregate.sum == 4950), 1, int);
+
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, 49, 0), 50, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(tree))), 50, int);
+	EXPECT_NUM_EQUAL(CheckAggregateNode(tree, tree->root, &aggregate), 1, int);
+	EXPECT_NUM_EQUAL((aggregate.sum == 3725), 1, int);
+	DeleteJAVLTree(&tree);
+
+	// CustomType 은 키 크기를 알 수 없으므로 소유할 수 없다.
+	EXPECT_NULL(NewJAVLTreeEx(CustomType, &options));
+	options.keyOwner = (JAVLTreeKeyOwner)3;
+	EXPECT_NULL(NewJAVLTreeEx(IntType, &options));
+})
+
+TEST(AVLTree_INT, Allocator, {
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	TestAllocatorCount count;
+	int keys[1000];
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&count, 0, sizeof(TestAllocatorCount));
+	allocator.alloc = TestCountingAlloc;
+	allocator.free = NULL;
+	allocator.context = &count;
+	options.allocator = &allocator;
+
+	// 할당, 해제 함수는 함께 지정해야 한다.
+	EXPECT_NULL(NewJAVLTreeEx(IntType, &options));
+	EXPECT_NUM_EQUAL(count.allocCount, 0, int);
+
+	// 트리 구조체, 해시 색인, 노드, 만료 힙, 임시 배열을 모두 같은 할당자로 할당한다.
+	allocator.free = TestCountingFree;
+	options.lookup = LookupHash;
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL(count.allocCount, 3, int);
+	EXPECT_NOT_NULL(JAVLTreeEnableExpiry(tree, NULL, NULL));
+
+	for(index = 0; index < 1000; index++)
+	{
+		keys[index] = index;
+		EXPECT_NOT_NULL(JAVLTreeAddNodeExpire(tree, &keys[index], index));
+	}
+	EXPECT_NUM_EQUAL((count.allocCount > 1000), 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, 99, 0), 100, int);
+
+	JAVLTreeSetLazyDelete(tree, 90);
+	for(index = 100; index < 200; index++) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	EXPECT_NOT_NULL(JAVLTreePurgeTombstones(tree));
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 800, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	// 떼어낸 노드와 JAVLTreeAlloc 으로 받은 메모리는 JAVLTreeFree 로 해제한다.
+	JNodePtr node = JAVLTreeExtractNode(tree, JAVLTreeFindNode(tree, &keys[500]));
+	EXPECT_NOT_NULL(node);
+	JAVLTreeFree(tree, node);
+	void *memory = JAVLTreeAlloc(tree, 64);
+	EXPECT_NOT_NULL(memory);
+	JAVLTreeFree(tree, memory);
+	EXPECT_NULL(JAVLTreeAlloc(NULL, 64));
+
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+})
+
+TEST(AVLTree_INT, OwnedKeyPop, {
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	TestAllocatorCount count;
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&count, 0, sizeof(TestAllocatorCount));
+	allocator.alloc = TestCountingAlloc;
+	allocator.free = TestCountingFree;
+	allocator.context = &count;
+	options.allocator = &allocator;
+	options.keyOwner = KeyOwnerTree;
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+
+	// 우선순위 큐처럼 넣고 꺼내기를 반복해도 꺼낸 키를 위한 메모리가 쌓이지 않는다.
+	int isSame = 1;
+	for(index = 0; index < 10000; index++)
+	{
+		int key = index;
+		JAVLTreeAddNode(tree, &key);
+		key = index + 1;
+		JAVLTreeAddNode(tree, &key);
+		int *popped = (int*)((index % 2 == 0) ? JAVLTreePopMin(tree) : JAVLTreePopMax(tree));
+		if(popped != (int*)tree->poppedKey || *popped != ((index % 2 == 0) ? index : index + 1)) isSame = 0;
+		JAVLTreePopMin(tree);
+	}
+	EXPECT_NUM_EQUAL(isSame, 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 0, int);
+	// 남은 할당은 트리 구조체 하나뿐이다.
+	EXPECT_NUM_EQUAL(count.allocCount - count.freeCount, 1, int);
+
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+})
+
+TEST(AVLTree_INT, Compact, {
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	TestAllocatorCount count;
+	int keys[2000];
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&count, 0, sizeof(TestAllocatorCount));
+	allocator.alloc = TestCountingAlloc;
+	allocator.free = TestCountingFree;
+	allocator.context = &count;
+	options.allocator = &allocator;
+	options.lookup = LookupHash;
+
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NULL(JAVLTreeCompact(tree, 0));
+	EXPECT_NOT_NULL(JAVLTreeCompact(tree, LayoutInOrder));
+	EXPECT_NUM_EQUAL(JAVLTreeCompactStep(tree, 10), 0, int);
+
+	for(index = 0; index < 2000; index++) keys[index] = index;
+	for(index = 0; index < 2000; index++) JAVLTreeAddNode(tree, &keys[(index * 7) % 2000]);
+	for(index = 0; index < 2000; index += 3) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+
+	// 키 순서로 배치하면 다음 노드는 항상 같은 간격 뒤에 있다.
+	EXPECT_NOT_NULL(JAVLTreeCompact(tree, LayoutInOrder));
+	JNodePtr node = JAVLTreeGetMin(tree);
+	long stride = (long)((char*)JNodeGetNext(node) - (char*)node);
+	int isContiguous = 1;
+	for(; JNodeGetNext(node) != NULL; node = JNodeGetNext(node))
+	{
+		if((char*)JNodeGetNext(node) - (char*)node != stride) isContiguous = 0;
+	}
+	EXPECT_NUM_EQUAL((stride >= (long)sizeof(JNode)), 1, int);
+	EXPECT_NUM_EQUAL(isContiguous, 1, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(*(int*)JNodeGetKey(JAVLTreeFindNode(tree, &keys[1000])), 1000, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[999]));
+
+	// 재배치한 뒤에도 추가, 삭제할 수 있다.
+	for(index = 0; index < 2000; index += 3) EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[index]));
+	for(index = 1; index < 2000; index += 2) EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[index]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 1000, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	// 점진적 재배치 사이에 추가, 삭제해도 된다. (다음에 옮길 노드를 삭제하는 경우 포함)
+	EXPECT_NUM_EQUAL(JAVLTreeCompactStep(tree, 100), 1, int);
+	JAVLTreeDeleteNodeKey(tree, &keys[200]);
+	JAVLTreeDeleteNodeKey(tree, &keys[202]);
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[1999]));
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[5]));
+	int stepCount = 1;
+	while(JAVLTreeCompactStep(tree, 100) == 1) stepCount++;
+	EXPECT_NUM_EQUAL(stepCount, 9, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 1000, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	int found = 0;
+	for(index = 0; index < 2000; index++)
+	{
+		node = JAVLTreeFindNode(tree, &keys[index]);
+		if(node != NULL && *(int*)JNodeGetKey(node) == index) found++;
+	}
+	EXPECT_NUM_EQUAL(found, 1000, int);
+
+	// van Emde Boas 순서에서는 루트가 블록의 맨 앞에 있다.
+	EXPECT_NOT_NULL(JAVLTreeCompact(tree, LayoutVanEmdeBoas));
+	int isRootFirst = 1;
+	for(node = JAVLTreeGetMin(tree); node != NULL; node = JNodeGetNext(node))
+	{
+		if((char*)node < (char*)tree->root) isRootFirst = 0;
+	}
+	EXPECT_NUM_EQUAL(isRootFirst, 1, int);
+	EXPECT_NUM_EQUAL((char*)tree->root->left - (char*)tree->root, stride, long);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(*(int*)JNodeGetKey(JAVLTreeFindNode(tree, &keys[1998])), 1998, int);
+
+	// 블록의 노드가 모두 해제되면 블록도 해제된다.
+	while(JAVLTreePopMin(tree) != NULL);
+	EXPECT_NULL(tree->nodeSlabs);
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[1]));
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+})
+
 // ---------- AVL Tree char Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -212,7 +1547,8 @@ TEST(AVLTree_CHAR, AddNode, {
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected3));
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected4));
 	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &expected5));
-	EXPECT_NUM_EQUAL(*((char*)(tree->root->key)), expected3, int);
+	// a~e 순서로 삽입하면 c 를 기준으로 RR 회전이 일어나서 b 가 루트 노드가 된다.
+	EXPECT_NUM_EQUAL(*((char*)(tree->root->key)), expected2, int);
 	
 	JAVLTreeInorderTraverse(tree);
 
@@ -283,6 +1619,29 @@ TEST(AVLTree_CHAR, DeleteNodeKey, {
 	DeleteJAVLTree(&tree);
 })
 
+TEST(AVLTree_CHAR, BoundQuery, {
+	JAVLTreePtr tree = NewJAVLTree(CharType);
+	char keys[5];
+	int index = 0;
+	for(; index < 5; index++)
+	{
+		keys[index] = (char)('b' + index * 2);
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	char target = 'e';
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreeLowerBound(tree, &target))), 'f', int);
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreeFloor(tree, &target))), 'd', int);
+	target = 'f';
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreeUpperBound(tree, &target))), 'h', int);
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreePredecessor(tree, &target))), 'd', int);
+	target = 'z';
+	EXPECT_NULL(JAVLTreeCeiling(tree, &target));
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreeFloor(tree, &target))), 'j', int);
+
+	DeleteJAVLTree(&tree);
+})
+
 // ---------- AVL Tree string Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +1767,1752 @@ TEST(AVLTree_STRING, DeleteNodeKey, {
 	DeleteJAVLTree(&tree);
 })
 
+TEST(AVLTree_STRING, BoundQuery, {
+	JAVLTreePtr tree = NewJAVLTree(StringType);
+	JAVLTreeAddNode(tree, "cherry");
+	JAVLTreeAddNode(tree, "apple");
+	JAVLTreeAddNode(tree, "melon");
+	JAVLTreeAddNode(tree, "banana");
+	JAVLTreeAddNode(tree, "grape");
+
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeLowerBound(tree, "c")), "cherry");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFloor(tree, "c")), "banana");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeUpperBound(tree, "cherry")), "grape");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeSuccessor(tree, "cherry")), "grape");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreePredecessor(tree, "cherry")), "banana");
+	EXPECT_NULL(JAVLTreeCeiling(tree, "zebra"));
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_STRING, FindBatch, {
+	JAVLTreePtr tree = NewJAVLTree(StringType);
+	void *targetKeys[3];
+	JNodePtr results[3];
+
+	JAVLTreeAddNode(tree, "cherry");
+	JAVLTreeAddNode(tree, "apple");
+	JAVLTreeAddNode(tree, "melon");
+
+	targetKeys[0] = "melon";
+	targetKeys[1] = "kiwi";
+	targetKeys[2] = "apple";
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, targetKeys, 3, results), 2, int);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(results[0]), "melon");
+	EXPECT_NULL(results[1]);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(results[2]), "apple");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFindNode(tree, "cherry")), "cherry");
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_STRING, OwnedKeys, {
+	JAVLTreeOptions options;
+	char buffer[64];
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.keyOwner = KeyOwnerTree;
+	JAVLTreePtr tree = NewJAVLTreeEx(StringType, &options);
+
+	// 짝수 번째는 15 글자 이하(노드 안), 홀수 번째는 더 긴 문자열(키 저장 블록)
+	for(index = 0; index < 200; index++)
+	{
+		if(index % 2 == 0) sprintf(buffer, "k%03d", index);
+		else sprintf(buffer, "long-key-number-%03d", index);
+		EXPECT_NOT_NULL(JAVLTreeAddNode(tree, buffer));
+	}
+	EXPECT_NULL(JAVLTreeAddNode(tree, buffer));
+	strcpy(buffer, "overwritten");
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 200, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	JNodePtr shortNode = JAVLTreeFindNode(tree, "k010");
+	JNodePtr longNode = JAVLTreeFindNode(tree, "long-key-number-011");
+	EXPECT_NOT_NULL(shortNode);
+	EXPECT_NOT_NULL(longNode);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(shortNode), "k010");
+	EXPECT_NUM_EQUAL(((char*)JNodeGetKey(shortNode) > (char*)shortNode), 1, int);
+	EXPECT_NUM_EQUAL(((char*)JNodeGetKey(shortNode) < (char*)shortNode + 128), 1, int);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(longNode), "long-key-number-011");
+
+	// 노드 안의 키는 노드가 해제된 뒤에도 읽을 수 있는 곳으로 옮겨서 반환한다.
+	EXPECT_STR_EQUAL((char*)JAVLTreePopMin(tree), "k000");
+	EXPECT_STR_EQUAL((char*)JAVLTreePopMax(tree), "long-key-number-199");
+
+	// 삭제 후 다시 추가하거나, 지연 삭제된 노드를 되살려도 키는 그대로 찾을 수 있다.
+	strcpy(buffer, "k010");
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, buffer), DeleteSuccess, int);
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, buffer));
+	JAVLTreeSetLazyDelete(tree, 90);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, buffer), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetTombstoneCount(tree), 1, int);
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, buffer));
+	strcpy(buffer, "zzz");
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFindNode(tree, "k010")), "k010");
+
+	// 호출한 쪽이 할당한 노드에는 키 공간이 없으므로 연결할 수 없다.
+	JNodePtr node = NewJNode();
+	JAVLTreeSetLazyDelete(tree, 0);
+	JNodeSetKey(node, "callerKey");
+	EXPECT_NULL(JAVLTreeInsertNode(tree, node));
+	DeleteJNode(&node);
+
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 198, int);
+	DeleteJAVLTree(&tree);
+})
+
+TEST(AVLTree_STRING, Compact, {
+	JAVLTreeOptions options;
+	char keys[300][32];
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.keyOwner = KeyOwnerTree;
+	JAVLTreePtr tree = NewJAVLTreeEx(StringType, &options);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NOT_NULL(JAVLTreeEnableExpiry(tree, NULL, NULL));
+
+	// 노드 안에 저장된 짧은 키와 키 저장 블록의 긴 키가 섞여 있어도 옮긴 뒤 키를 그대로 찾는다.
+	for(index = 0; index < 300; index++)
+	{
+		if(index % 2 == 0) snprintf(keys[index], sizeof(keys[index]), "k%04d", index);
+		else snprintf(keys[index], sizeof(keys[index]), "long-key-%04d-padding-text", index);
+		EXPECT_NOT_NULL(JAVLTreeAddNodeExpire(tree, keys[index], index));
+	}
+	EXPECT_NOT_NULL(JAVLTreeCompact(tree, LayoutVanEmdeBoas));
+	while(JAVLTreeCompactStep(tree, 7) == 1);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	int found = 0;
+	for(index = 0; index < 300; index++)
+	{
+		JNodePtr node = JAVLTreeFindNode(tree, keys[index]);
+		if(node != NULL && strcmp((char*)JNodeGetKey(node), keys[index]) == 0) found++;
+	}
+	EXPECT_NUM_EQUAL(found, 300, int);
+
+	// 만료 힙이 옮긴 노드를 가리키므로 만료 시각 순서로 삭제된다.
+	EXPECT_NUM_EQUAL(JAVLTreeExpire(tree, 149, 0), 150, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, keys[149]));
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFindNode(tree, keys[150])), keys[150]);
+	EXPECT_NUM_EQUAL(JAVLTreeGetExpire(tree, JAVLTreeFindNode(tree, keys[299])) == 299, 1, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+// ---------- Compact AVL Tree Test ----------
+
+/**
+ * @fn static int CheckCompactNode(const JCompactAVLTreePtr tree, unsigned int index)
+ * @brief 배열 기반 AVL Tree 의 하위 트리가 AVL Tree 조건을 만족하는지 검사하는 함수(재귀)
+ * @param tree 검사할 AVL Tree(입력, 읽기 전용)
+ * @param index 검사할 하위 트리의 루트 노드 인덱스(입력)
+ * @return 조건을 만족하면 하위 트리의 높이, 만족하지 않으면 -1 반환
+ */
+static int CheckCompactNode(const JCompactAVLTreePtr tree, unsigned int index)
+{
+	if(index == JCOMPACT_NULL_INDEX) return 0;
+
+	int leftHeight = CheckCompactNode(tree, tree->nodes[index].left);
+	int rightHeight = CheckCompactNode(tree, tree->nodes[index].right);
+	if(leftHeight < 0 || rightHeight < 0) return -1;
+	if(leftHeight - rightHeight > 1 || rightHeight - leftHeight > 1) return -1;
+
+	int height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+	if(tree->nodes[index].height != height) return -1;
+	return height;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compact AVL Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(CompactAVLTree, CreateAndDelete, {
+	JCompactAVLTreePtr tree = NewJCompactAVLTree(IntType);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL((int)sizeof(JCompactNode), 16, int);
+	EXPECT_NUM_EQUAL(DeleteJCompactAVLTree(&tree), DeleteSuccess, int);
+	EXPECT_NULL(tree);
+
+	// 키를 값으로 저장하므로 문자열 키는 지원하지 않는다.
+	EXPECT_NULL(NewJCompactAVLTree(StringType));
+	EXPECT_NUM_EQUAL(DeleteJCompactAVLTree(NULL), DeleteFail, int);
+})
+
+TEST(CompactAVLTree_INT, AddFindDelete, {
+	JCompactAVLTreePtr tree = NewJCompactAVLTree(IntType);
+	int index = 0;
+	int key = 0;
+
+	for(index = 0; index < 1000; index++)
+	{
+		key = (index * 7919) % 1000;
+		EXPECT_NOT_NULL(JCompactAVLTreeAddKey(tree, &key));
+	}
+	EXPECT_NUM_EQUAL((int)JCompactAVLTreeGetSize(tree), 1000, int);
+	EXPECT_NUM_EQUAL(CheckCompactNode(tree, tree->root) > 0, 1, int);
+
+	// 중복 허용 테스트
+	key = 10;
+	EXPECT_NULL(JCompactAVLTreeAddKey(tree, &key));
+
+	for(key = 0; key < 1000; key += 2)
+	{
+		EXPECT_NUM_EQUAL(JCompactAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL((int)JCompactAVLTreeGetSize(tree), 500, int);
+	EXPECT_NUM_EQUAL(CheckCompactNode(tree, tree->root) > 0, 1, int);
+
+	key = 10;
+	EXPECT_NUM_EQUAL(JCompactAVLTreeFindKey(tree, &key), FindFail, int);
+	EXPECT_NUM_EQUAL(JCompactAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+	key = 11;
+	EXPECT_NUM_EQUAL(JCompactAVLTreeFindKey(tree, &key), FindSuccess, int);
+
+	// 삭제된 슬롯을 다시 사용하므로 배열이 늘어나지 않는다.
+	unsigned int used = tree->used;
+	for(key = 0; key < 1000; key += 2) JCompactAVLTreeAddKey(tree, &key);
+	EXPECT_NUM_EQUAL((int)tree->used, (int)used, int);
+
+	EXPECT_NULL(JCompactAVLTreeAddKey(NULL, &key));
+	EXPECT_NULL(JCompactAVLTreeAddKey(tree, NULL));
+	EXPECT_NUM_EQUAL(JCompactAVLTreeDeleteKey(NULL, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JCompactAVLTreeFindKey(NULL, &key), FindFail, int);
+
+	DeleteJCompactAVLTree(&tree);
+})
+
+TEST(CompactAVLTree_CHAR, AddFindDelete, {
+	JCompactAVLTreePtr tree = NewJCompactAVLTree(CharType);
+	char key = 'a';
+
+	for(key = 'a'; key <= 'z'; key++) JCompactAVLTreeAddKey(tree, &key);
+	JCompactAVLTreeInorderTraverse(tree);
+	EXPECT_NUM_EQUAL((int)JCompactAVLTreeGetSize(tree), 26, int);
+
+	key = 'm';
+	EXPECT_NUM_EQUAL(JCompactAVLTreeFindKey(tree, &key), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JCompactAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JCompactAVLTreeFindKey(tree, &key), FindFail, int);
+	JCompactAVLTreeInorderTraverse(tree);
+
+	DeleteJCompactAVLTree(&tree);
+})
+
+// ---------- Chunked AVL Tree Test ----------
+
+/**
+ * @fn static int CheckChunkNode(const JChunkNodePtr node, KeyType type)
+ * @brief 키 배열 노드 AVL Tree 의 하위 트리가 조건을 만족하는지 검사하는 함수(재귀)
+ * 높이 균형, 노드 안의 키 정렬, 자식 하위 트리와 노드 키 범위의 순서를 모두 검사한다.
+ * @param node 검사할 하위 트리의 루트 노드(입력, 읽기 전용)
+ * @param type 키 데이터 유형(입력)
+ * @return 조건을 만족하면 하위 트리의 높이, 만족하지 않으면 -1 반환
+ */
+static int CheckChunkNode(const JChunkNodePtr node, KeyType type)
+{
+	if(node == NULL) return 0;
+	if(node->count < 1 || node->count > JCHUNK_CAPACITY) return -1;
+
+	int index = 1;
+	for(; index < node->count; index++)
+	{
+		if(type == StringType && strcmp((char*)node->keys[index - 1], (char*)node->keys[index]) >= 0) return -1;
+		if(type == IntType && *((int*)node->keys[index - 1]) >= *((int*)node->keys[index])) return -1;
+	}
+
+	JChunkNodePtr childNode = node->left;
+	if(childNode != NULL)
+	{
+		while(childNode->right != NULL) childNode = childNode->right;
+		if(type == StringType && strcmp((char*)childNode->keys[childNode->count - 1], (char*)node->keys[0]) >= 0) return -1;
+		if(type == IntType && *((int*)childNode->keys[childNode->count - 1]) >= *((int*)node->keys[0])) return -1;
+	}
+	childNode = node->right;
+	if(childNode != NULL)
+	{
+		while(childNode->left != NULL) childNode = childNode->left;
+		if(type == StringType && strcmp((char*)node->keys[node->count - 1], (char*)childNode->keys[0]) >= 0) return -1;
+		if(type == IntType && *((int*)node->keys[node->count - 1]) >= *((int*)childNode->keys[0])) return -1;
+	}
+
+	int leftHeight = CheckChunkNode(node->left, type);
+	int rightHeight = CheckChunkNode(node->right, type);
+	if(leftHeight < 0 || rightHeight < 0) return -1;
+	if(leftHeight - rightHeight > 1 || rightHeight - leftHeight > 1) return -1;
+
+	int height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+	if(node->height != height) return -1;
+	return height;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Chunked AVL Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(ChunkedAVLTree, CreateAndDelete, {
+	JChunkedAVLTreePtr tree = NewJChunkedAVLTree(IntType);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL((int)JChunkedAVLTreeGetSize(tree), 0, int);
+	EXPECT_NULL(JChunkedAVLTreeGetMin(tree));
+	EXPECT_NUM_EQUAL(DeleteJChunkedAVLTree(&tree), DeleteSuccess, int);
+	EXPECT_NULL(tree);
+
+	EXPECT_NULL(NewJChunkedAVLTree(Unknown));
+	EXPECT_NUM_EQUAL(DeleteJChunkedAVLTree(NULL), DeleteFail, int);
+})
+
+TEST(ChunkedAVLTree_INT, AddFindDelete, {
+	JChunkedAVLTreePtr tree = NewJChunkedAVLTree(IntType);
+	int keys[5000];
+	int key = 0;
+	int index = 0;
+
+	// 음수 키도 순서가 유지되어야 한다.
+	for(index = 0; index < 5000; index++)
+	{
+		keys[index] = ((index * 7919) % 5000) - 2500;
+		EXPECT_NOT_NULL(JChunkedAVLTreeAddKey(tree, &keys[index]));
+	}
+	EXPECT_NUM_EQUAL((int)JChunkedAVLTreeGetSize(tree), 5000, int);
+	EXPECT_NUM_EQUAL(CheckChunkNode(tree->root, IntType) > 0, 1, int);
+	// 노드마다 여러 키를 저장하므로 노드 개수가 키 개수보다 훨씬 적다.
+	EXPECT_NUM_EQUAL((int)tree->nodeCount * 4 < 5000, 1, int);
+
+	// 중복 허용 테스트
+	key = 10;
+	EXPECT_NULL(JChunkedAVLTreeAddKey(tree, &key));
+
+	EXPECT_NUM_EQUAL(*((int*)JChunkedAVLTreeGetMin(tree)), -2500, int);
+	EXPECT_NUM_EQUAL(*((int*)JChunkedAVLTreeGetMax(tree)), 2499, int);
+
+	for(key = -2500; key < 2500; key += 2)
+	{
+		EXPECT_NUM_EQUAL(JChunkedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL((int)JChunkedAVLTreeGetSize(tree), 2500, int);
+	EXPECT_NUM_EQUAL(CheckChunkNode(tree->root, IntType) > 0, 1, int);
+
+	key = 10;
+	EXPECT_NULL(JChunkedAVLTreeFindKey(tree, &key));
+	EXPECT_NUM_EQUAL(JChunkedAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL(*((int*)JChunkedAVLTreeLowerBound(tree, &key)), 11, int);
+	key = 11;
+	EXPECT_NUM_EQUAL(*((int*)JChunkedAVLTreeFindKey(tree, &key)), 11, int);
+	key = 2499;
+	EXPECT_NUM_EQUAL(*((int*)JChunkedAVLTreeLowerBound(tree, &key)), 2499, int);
+	key = 2500;
+	EXPECT_NULL(JChunkedAVLTreeLowerBound(tree, &key));
+
+	// 모두 삭제하면 노드도 모두 해제된다.
+	for(key = -2499; key < 2500; key += 2)
+	{
+		EXPECT_NUM_EQUAL(JChunkedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL((int)tree->nodeCount, 0, int);
+	EXPECT_NULL(tree->root);
+
+	EXPECT_NULL(JChunkedAVLTreeAddKey(NULL, &key));
+	EXPECT_NULL(JChunkedAVLTreeAddKey(tree, NULL));
+	EXPECT_NUM_EQUAL(JChunkedAVLTreeDeleteKey(NULL, &key), DeleteFail, int);
+	EXPECT_NULL(JChunkedAVLTreeFindKey(NULL, &key));
+
+	DeleteJChunkedAVLTree(&tree);
+})
+
+TEST(ChunkedAVLTree_STRING, AddFindDelete, {
+	JChunkedAVLTreePtr tree = NewJChunkedAVLTree(StringType);
+	char keys[300][16];
+	char key[16];
+	int index = 0;
+
+	// 앞 8 바이트가 같은 키가 많아서 strcmp 비교도 검사된다.
+	for(index = 0; index < 300; index++)
+	{
+		sprintf(keys[index], "prefix%03d", (index * 7) % 300);
+		EXPECT_NOT_NULL(JChunkedAVLTreeAddKey(tree, keys[index]));
+	}
+	EXPECT_NUM_EQUAL(CheckChunkNode(tree->root, StringType) > 0, 1, int);
+	EXPECT_STR_EQUAL((char*)JChunkedAVLTreeGetMin(tree), "prefix000");
+	EXPECT_STR_EQUAL((char*)JChunkedAVLTreeGetMax(tree), "prefix299");
+
+	strcpy(key, "prefix150");
+	EXPECT_NULL(JChunkedAVLTreeAddKey(tree, key));
+	EXPECT_STR_EQUAL((char*)JChunkedAVLTreeFindKey(tree, key), "prefix150");
+	EXPECT_NUM_EQUAL(JChunkedAVLTreeDeleteKey(tree, key), DeleteSuccess, int);
+	EXPECT_NULL(JChunkedAVLTreeFindKey(tree, key));
+	EXPECT_STR_EQUAL((char*)JChunkedAVLTreeLowerBound(tree, key), "prefix151");
+	strcpy(key, "prefix");
+	EXPECT_STR_EQUAL((char*)JChunkedAVLTreeLowerBound(tree, key), "prefix000");
+	JChunkedAVLTreeInorderTraverse(tree);
+
+	EXPECT_NUM_EQUAL(CheckChunkNode(tree->root, StringType) > 0, 1, int);
+	DeleteJChunkedAVLTree(&tree);
+})
+
+// ---------- Write-Ahead Log Test ----------
+
+#define WAL_TEST_LOG_PATH "javltree_wal_test.log"
+#define WAL_TEST_SNAPSHOT_PATH "javltree_wal_test.snap"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write-Ahead Log Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(WAL_INT, GroupCommit, {
+	remove(WAL_TEST_LOG_PATH);
+
+	JWALPolicy policy;
+	policy.batchSize = 4;
+	policy.windowMicros = 0;
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JWALPtr wal = NewJWAL(WAL_TEST_LOG_PATH, IntType, policy);
+	EXPECT_NOT_NULL(wal);
+	EXPECT_NOT_NULL(JAVLTreeAttachWAL(tree, wal));
+
+	int keys[10];
+	int index = 0;
+	for(index = 0; index < 10; index++)
+	{
+		keys[index] = index * 10;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+
+	// 4 개가 쌓일 때마다 한 번만 fsync 한다.
+	EXPECT_NUM_EQUAL((int)wal->recordCount, 10, int);
+	EXPECT_NUM_EQUAL((int)wal->syncCount, 2, int);
+	EXPECT_NUM_EQUAL(wal->pendingCount, 2, int);
+
+	// 실패한 추가, 삭제는 기록되지 않는다.
+	int key = 30;
+	EXPECT_NULL(JAVLTreeAddNode(tree, &key));
+	key = 35;
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL((int)wal->recordCount, 10, int);
+
+	key = 30;
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NOT_NULL(JAVLTreePopMin(tree));
+	EXPECT_NUM_EQUAL(JWALSync(wal), WALSuccess, int);
+	EXPECT_NUM_EQUAL((int)wal->syncCount, 3, int);
+	EXPECT_NUM_EQUAL(wal->pendingCount, 0, int);
+
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(DeleteJWAL(&wal), DeleteSuccess, int);
+	EXPECT_NULL(wal);
+
+	// 로그만으로 복구
+	JAVLTreePtr recoveredTree = JWALRecover(IntType, NULL, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(recoveredTree);
+	EXPECT_NUM_EQUAL(CheckAVLNode(recoveredTree->root) > 0, 1, int);
+	for(index = 0; index < 10; index++)
+	{
+		if(keys[index] == 0 || keys[index] == 30)
+		{
+			EXPECT_NULL(JAVLTreeFindNode(recoveredTree, &keys[index]));
+		}
+		else
+		{
+			EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, &keys[index]));
+		}
+	}
+	DeleteJAVLTree(&recoveredTree);
+
+	EXPECT_NULL(NewJWAL(NULL, IntType, policy));
+	policy.batchSize = 0;
+	EXPECT_NULL(NewJWAL(WAL_TEST_LOG_PATH, IntType, policy));
+	EXPECT_NUM_EQUAL(JWALAppend(NULL, WALAddNode, &key), WALFail, int);
+	EXPECT_NUM_EQUAL(DeleteJWAL(NULL), DeleteFail, int);
+
+	remove(WAL_TEST_LOG_PATH);
+})
+
+TEST(WAL_INT, ShortWrite, {
+	remove(WAL_TEST_LOG_PATH);
+
+	JWALPolicy policy;
+	policy.batchSize = 1;
+	policy.windowMicros = 0;
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JWALPtr wal = NewJWAL(WAL_TEST_LOG_PATH, IntType, policy);
+	EXPECT_NOT_NULL(JAVLTreeAttachWAL(tree, wal));
+
+	int keys[3];
+	keys[0] = 1;
+	keys[1] = 2;
+	keys[2] = 3;
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[0]));
+	// 헤더 8 바이트 + 정수 키 기록 13 바이트
+	EXPECT_NUM_EQUAL((int)wal->syncedLength, 21, int);
+
+	// 파일 크기 제한으로 다음 기록이 5 바이트만 쓰이고 나머지는 EFBIG 으로 실패하게 한다.
+	struct rlimit oldLimit;
+	struct rlimit limit;
+	getrlimit(RLIMIT_FSIZE, &oldLimit);
+	limit = oldLimit;
+	limit.rlim_cur = (rlim_t)wal->syncedLength + 5;
+	void (*oldHandler)(int) = signal(SIGXFSZ, SIG_IGN);
+	setrlimit(RLIMIT_FSIZE, &limit);
+
+	// 기록하지 못한 추가는 되돌리고, 로그는 마지막 fsync 시점으로 잘라낸다.
+	JAVLTreePtr result = JAVLTreeAddNode(tree, &keys[1]);
+	setrlimit(RLIMIT_FSIZE, &oldLimit);
+	signal(SIGXFSZ, oldHandler);
+
+	EXPECT_NULL(result);
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[1]));
+	EXPECT_NUM_EQUAL(wal->isFailed, 1, int);
+	struct stat fileStat;
+	EXPECT_NUM_EQUAL(stat(WAL_TEST_LOG_PATH, &fileStat), 0, int);
+	EXPECT_NUM_EQUAL((int)fileStat.st_size, 21, int);
+
+	// 실패한 로그는 이후의 기록을 모두 거절하므로 트리도 바뀌지 않는다.
+	EXPECT_NULL(JAVLTreeAddNode(tree, &keys[2]));
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[0]), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 1, int);
+	EXPECT_NUM_EQUAL(JWALSync(wal), WALFail, int);
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(DeleteJWAL(&wal), DeleteFail, int);
+
+	// 잘라낸 로그는 기록 경계에서 끝나므로 다시 열어 이어 쓴 기록까지 모두 복구된다.
+	tree = JWALRecover(IntType, NULL, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(tree);
+	wal = NewJWAL(WAL_TEST_LOG_PATH, IntType, policy);
+	EXPECT_NOT_NULL(JAVLTreeAttachWAL(tree, wal));
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &keys[2]));
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(DeleteJWAL(&wal), DeleteSuccess, int);
+
+	tree = JWALRecover(IntType, NULL, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 2, int);
+	EXPECT_NOT_NULL(JAVLTreeFindNode(tree, &keys[0]));
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[1]));
+	EXPECT_NOT_NULL(JAVLTreeFindNode(tree, &keys[2]));
+	DeleteJAVLTree(&tree);
+
+	remove(WAL_TEST_LOG_PATH);
+})
+
+TEST(WAL_INT, CheckpointAndRecover, {
+	remove(WAL_TEST_LOG_PATH);
+	remove(WAL_TEST_SNAPSHOT_PATH);
+
+	JWALPolicy policy;
+	policy.batchSize = 64;
+	policy.windowMicros = 1000;
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JWALPtr wal = NewJWAL(WAL_TEST_LOG_PATH, IntType, policy);
+	JAVLTreeAttachWAL(tree, wal);
+
+	int keys[200];
+	int index = 0;
+	for(index = 0; index < 200; index++) keys[index] = index;
+	for(index = 0; index < 100; index++) JAVLTreeAddNode(tree, &keys[index]);
+
+	// 스냅샷 이후의 변경만 로그에 남는다.
+	EXPECT_NUM_EQUAL(JWALCheckpoint(wal, tree, WAL_TEST_SNAPSHOT_PATH), WALSuccess, int);
+	for(index = 0; index < 50; index += 2) JAVLTreeDeleteNodeKey(tree, &keys[index]);
+	for(index = 100; index < 200; index++) JAVLTreeAddNode(tree, &keys[index]);
+
+	DeleteJAVLTree(&tree);
+	DeleteJWAL(&wal);
+
+	// 장애로 쓰다 만 기록을 흉내낸다.
+	FILE *file = fopen(WAL_TEST_LOG_PATH, "ab");
+	fputs("abc", file);
+	fclose(file);
+
+	JAVLTreePtr recoveredTree = JWALRecover(IntType, WAL_TEST_SNAPSHOT_PATH, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(recoveredTree);
+	EXPECT_NUM_EQUAL(CheckAVLNode(recoveredTree->root) > 0, 1, int);
+	for(index = 0; index < 200; index++)
+	{
+		if(index < 50 && index % 2 == 0)
+		{
+			EXPECT_NULL(JAVLTreeFindNode(recoveredTree, &keys[index]));
+		}
+		else
+		{
+			EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, &keys[index]));
+		}
+	}
+
+	// 끊긴 기록은 잘려 나가므로 이어서 기록한 뒤에도 다시 복구할 수 있다.
+	wal = NewJWAL(WAL_TEST_LOG_PATH, IntType, policy);
+	EXPECT_NOT_NULL(wal);
+	JAVLTreeAttachWAL(recoveredTree, wal);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(recoveredTree, &keys[199]), DeleteSuccess, int);
+	DeleteJAVLTree(&recoveredTree);
+	DeleteJWAL(&wal);
+
+	recoveredTree = JWALRecover(IntType, WAL_TEST_SNAPSHOT_PATH, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(recoveredTree);
+	EXPECT_NULL(JAVLTreeFindNode(recoveredTree, &keys[199]));
+	EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, &keys[198]));
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JAVLTreeGetMin(recoveredTree))), 1, int);
+	DeleteJAVLTree(&recoveredTree);
+
+	// 키 데이터 유형이 다른 파일은 복구하지 않는다.
+	EXPECT_NULL(JWALRecover(CharType, WAL_TEST_SNAPSHOT_PATH, NULL));
+	EXPECT_NULL(JWALRecover(CharType, NULL, WAL_TEST_LOG_PATH));
+	EXPECT_NULL(NewJWAL(WAL_TEST_LOG_PATH, CharType, policy));
+
+	remove(WAL_TEST_LOG_PATH);
+	remove(WAL_TEST_SNAPSHOT_PATH);
+})
+
+TEST(WAL_STRING, CheckpointAndRecover, {
+	remove(WAL_TEST_LOG_PATH);
+	remove(WAL_TEST_SNAPSHOT_PATH);
+
+	JWALPolicy policy;
+	policy.batchSize = 1;
+	policy.windowMicros = 0;
+
+	JAVLTreePtr tree = NewJAVLTree(StringType);
+	JWALPtr wal = NewJWAL(WAL_TEST_LOG_PATH, StringType, policy);
+	EXPECT_NOT_NULL(JAVLTreeAttachWAL(tree, wal));
+
+	// 키 데이터 유형이 다른 트리에는 연결할 수 없다.
+	JAVLTreePtr intTree = NewJAVLTree(IntType);
+	EXPECT_NULL(JAVLTreeAttachWAL(intTree, wal));
+	DeleteJAVLTree(&intTree);
+
+	char *keys[5];
+	keys[0] = "apple";
+	keys[1] = "banana";
+	keys[2] = "cherry";
+	keys[3] = "";
+	keys[4] = "durian";
+
+	JAVLTreeAddNode(tree, keys[0]);
+	JAVLTreeAddNode(tree, keys[1]);
+	EXPECT_NUM_EQUAL(JWALCheckpoint(wal, tree, WAL_TEST_SNAPSHOT_PATH), WALSuccess, int);
+	JAVLTreeAddNode(tree, keys[2]);
+	JAVLTreeAddNode(tree, keys[3]);
+	JAVLTreeAddNode(tree, keys[4]);
+	JAVLTreeDeleteNodeKey(tree, keys[0]);
+
+	// 기록마다 fsync 하는 정책
+	EXPECT_NUM_EQUAL((int)wal->syncCount, (int)wal->recordCount + 1, int);
+
+	DeleteJAVLTree(&tree);
+	DeleteJWAL(&wal);
+
+	JAVLTreePtr recoveredTree = JWALRecover(StringType, WAL_TEST_SNAPSHOT_PATH, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(recoveredTree);
+	EXPECT_NULL(JAVLTreeFindNode(recoveredTree, keys[0]));
+
+	// 복구된 키는 트리가 소유하는 복사본이다.
+	JNodePtr node = JAVLTreeFindNode(recoveredTree, keys[1]);
+	EXPECT_NOT_NULL(node);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(node), keys[1]);
+	EXPECT_PTR_NOT_EQUAL(JNodeGetKey(node), keys[1]);
+	EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, keys[2]));
+	EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, keys[3]));
+	EXPECT_NOT_NULL(JAVLTreeFindNode(recoveredTree, keys[4]));
+	DeleteJAVLTree(&recoveredTree);
+
+	// 키를 소유하고 해시 색인과 할당자를 쓰는 트리로도 복구할 수 있다.
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	TestAllocatorCount count;
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&count, 0, sizeof(TestAllocatorCount));
+	allocator.alloc = TestCountingAlloc;
+	allocator.free = TestCountingFree;
+	allocator.context = &count;
+	options.allocator = &allocator;
+	options.lookup = LookupHash;
+	options.keyOwner = KeyOwnerTree;
+
+	recoveredTree = JWALRecoverEx(StringType, &options, WAL_TEST_SNAPSHOT_PATH, WAL_TEST_LOG_PATH);
+	EXPECT_NOT_NULL(recoveredTree);
+	EXPECT_NUM_EQUAL(recoveredTree->keyOwner, KeyOwnerTree, int);
+	EXPECT_NOT_NULL(recoveredTree->index);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(recoveredTree), 4, int);
+	EXPECT_NULL(JAVLTreeFindNode(recoveredTree, keys[0]));
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFindNode(recoveredTree, keys[1])), keys[1]);
+	EXPECT_STR_EQUAL((char*)JNodeGetKey(JAVLTreeFindNode(recoveredTree, keys[4])), keys[4]);
+	EXPECT_NUM_EQUAL(CheckAVLNode(recoveredTree->root) > 0, 1, int);
+	DeleteJAVLTree(&recoveredTree);
+	EXPECT_NUM_EQUAL(count.allocCount > 0, 1, int);
+	EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+
+	// 복구용 버퍼도 트리의 할당자로 할당하므로, 어느 할당이 실패해도 할당자로 받은 메모리는 모두 해제된다.
+	int allocLimit = 0;
+	int totalCount = count.allocCount;
+	for(allocLimit = 1; allocLimit < totalCount; allocLimit++)
+	{
+		memset(&count, 0, sizeof(TestAllocatorCount));
+		count.allocLimit = allocLimit;
+		recoveredTree = JWALRecoverEx(StringType, &options, WAL_TEST_SNAPSHOT_PATH, WAL_TEST_LOG_PATH);
+		if(recoveredTree != NULL) DeleteJAVLTree(&recoveredTree);
+		EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+	}
+
+	remove(WAL_TEST_LOG_PATH);
+	remove(WAL_TEST_SNAPSHOT_PATH);
+})
+
+// ---------- Memory-Mapped AVL Tree Test ----------
+
+#define MAPPED_TEST_PATH "javltree_mapped_test.jav"
+
+/**
+ * @fn static int CheckMappedNode(const JMappedAVLTreePtr tree, unsigned long long offset)
+ * @brief 파일 기반 AVL Tree 의 하위 트리가 AVL Tree 조건을 만족하는지 검사하는 함수(재귀)
+ * @param tree 검사할 AVL Tree(입력, 읽기 전용)
+ * @param offset 검사할 하위 트리의 루트 노드 오프셋(입력)
+ * @return 조건을 만족하면 하위 트리의 높이, 만족하지 않으면 -1 반환
+ */
+static int CheckMappedNode(const JMappedAVLTreePtr tree, unsigned long long offset)
+{
+	if(offset == JMAPPED_NULL_OFFSET) return 0;
+
+	const JMappedNode *node = (const JMappedNode*)(tree->base + offset);
+	int leftHeight = CheckMappedNode(tree, node->left);
+	int rightHeight = CheckMappedNode(tree, node->right);
+	if(leftHeight < 0 || rightHeight < 0) return -1;
+	if(leftHeight - rightHeight > 1 || rightHeight - leftHeight > 1) return -1;
+
+	int height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+	if(node->height != height) return -1;
+	return height;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Memory-Mapped AVL Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(MappedAVLTree, CreateAndDelete, {
+	remove(MAPPED_TEST_PATH);
+
+	// 없는 파일은 읽기 전용으로 열 수 없다.
+	EXPECT_NULL(NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadOnly));
+
+	JMappedAVLTreePtr tree = NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadWrite);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL((int)sizeof(JMappedHeader), 64, int);
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 0, int);
+	EXPECT_NUM_EQUAL(DeleteJMappedAVLTree(&tree), DeleteSuccess, int);
+	EXPECT_NULL(tree);
+
+	// 키 데이터 유형이 다른 파일은 열지 않는다.
+	EXPECT_NULL(NewJMappedAVLTree(MAPPED_TEST_PATH, CharType, MappedReadWrite));
+	EXPECT_NULL(NewJMappedAVLTree(MAPPED_TEST_PATH, StringType, MappedReadWrite));
+	EXPECT_NULL(NewJMappedAVLTree(NULL, IntType, MappedReadWrite));
+	EXPECT_NUM_EQUAL(DeleteJMappedAVLTree(NULL), DeleteFail, int);
+
+	remove(MAPPED_TEST_PATH);
+})
+
+TEST(MappedAVLTree_INT, AddFindDelete, {
+	remove(MAPPED_TEST_PATH);
+
+	JMappedAVLTreePtr tree = NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadWrite);
+	int index = 0;
+	int key = 0;
+
+	// 파일이 여러 번 늘어나고 다시 매핑된다.
+	for(index = 0; index < 10000; index++)
+	{
+		key = (index * 7919) % 10000;
+		EXPECT_NOT_NULL(JMappedAVLTreeAddKey(tree, &key));
+	}
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 10000, int);
+	EXPECT_NUM_EQUAL(CheckMappedNode(tree, ((JMappedHeaderPtr)tree->base)->root) > 0, 1, int);
+
+	// 중복 허용 테스트
+	key = 10;
+	EXPECT_NULL(JMappedAVLTreeAddKey(tree, &key));
+
+	for(key = 0; key < 10000; key += 2)
+	{
+		EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 5000, int);
+	EXPECT_NUM_EQUAL(CheckMappedNode(tree, ((JMappedHeaderPtr)tree->base)->root) > 0, 1, int);
+
+	// 삭제된 슬롯은 파일의 빈 슬롯 목록으로 다시 사용하므로 파일이 늘어나지 않는다.
+	unsigned long long end = ((JMappedHeaderPtr)tree->base)->end;
+	for(key = 0; key < 10000; key += 4) JMappedAVLTreeAddKey(tree, &key);
+	EXPECT_NUM_EQUAL((int)(((JMappedHeaderPtr)tree->base)->end == end), 1, int);
+
+	EXPECT_NOT_NULL(JMappedAVLTreeSync(tree));
+	DeleteJMappedAVLTree(&tree);
+
+	// 다시 열면 노드를 읽어 들이지 않고 바로 사용할 수 있다.
+	tree = NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadWrite);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 7500, int);
+	key = 4;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindSuccess, int);
+	key = 6;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindFail, int);
+	key = 9999;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindSuccess, int);
+
+	// 읽기 전용 매핑은 쓰기 매핑과 같은 파일을 공유하고, 변경할 수 없다.
+	JMappedAVLTreePtr readOnlyTree = NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadOnly);
+	EXPECT_NOT_NULL(readOnlyTree);
+	key = 7;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(readOnlyTree, &key), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(readOnlyTree, &key), FindFail, int);
+	EXPECT_NULL(JMappedAVLTreeAddKey(readOnlyTree, &key));
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(readOnlyTree, &key), DeleteFail, int);
+	EXPECT_NULL(JMappedAVLTreeSync(readOnlyTree));
+
+	DeleteJMappedAVLTree(&readOnlyTree);
+	DeleteJMappedAVLTree(&tree);
+	remove(MAPPED_TEST_PATH);
+})
+
+TEST(MappedAVLTree_INT, CorruptFile, {
+	remove(MAPPED_TEST_PATH);
+
+	JMappedAVLTreePtr tree = NewJMappedAVLTree(MAPPED_TEST_PATH, IntType, MappedReadWrite);
+	JMappedHeaderPtr header = (JMappedHeaderPtr)tree->base;
+	int key = 0;
+
+	for(key = 0; key < 100; key++) JMappedAVLTreeAddKey(tree, &key);
+	JMappedNodePtr rootNode = (JMappedNodePtr)(tree->base + header->root);
+	unsigned long long left = rootNode->left;
+
+	// 매핑 범위 밖의 오프셋은 쓰기 경로에서도 따라가지 않는다.
+	rootNode->left = 1ULL << 40;
+	key = -1;
+	EXPECT_NULL(JMappedAVLTreeAddKey(tree, &key));
+	key = 0;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 100, int);
+
+	// 순환 연결은 경로 길이 제한으로 끝난다.
+	rootNode->left = header->root;
+	key = -1;
+	EXPECT_NULL(JMappedAVLTreeAddKey(tree, &key));
+	key = 0;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+
+	// 다음 키를 찾는 경로도 검사한다.
+	rootNode->left = left;
+	unsigned long long right = rootNode->right;
+	JMappedNodePtr rightNode = (JMappedNodePtr)(tree->base + right);
+	while(rightNode->left != JMAPPED_NULL_OFFSET) rightNode = (JMappedNodePtr)(tree->base + rightNode->left);
+	rightNode->left = 1ULL << 40;
+	key = rootNode->key;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindSuccess, int);
+	rightNode->left = JMAPPED_NULL_OFFSET;
+
+	// 손상된 빈 슬롯 목록에서는 슬롯을 꺼내지 않는다.
+	key = 99;
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	header->freeList = (unsigned long long)tree->mappedSize + 1;
+	EXPECT_NULL(JMappedAVLTreeAddKey(tree, &key));
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 99, int);
+
+	DeleteJMappedAVLTree(&tree);
+	remove(MAPPED_TEST_PATH);
+})
+
+TEST(MappedAVLTree_CHAR, AddFindDelete, {
+	remove(MAPPED_TEST_PATH);
+
+	JMappedAVLTreePtr tree = NewJMappedAVLTree(MAPPED_TEST_PATH, CharType, MappedReadWrite);
+	char key = 'a';
+
+	for(key = 'a'; key <= 'z'; key++) JMappedAVLTreeAddKey(tree, &key);
+	JMappedAVLTreeInorderTraverse(tree);
+	EXPECT_NUM_EQUAL((int)JMappedAVLTreeGetSize(tree), 26, int);
+
+	key = 'm';
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JMappedAVLTreeDeleteKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JMappedAVLTreeFindKey(tree, &key), FindFail, int);
+	JMappedAVLTreeInorderTraverse(tree);
+
+	DeleteJMappedAVLTree(&tree);
+	remove(MAPPED_TEST_PATH);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Bloom Filter Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(BloomFilter, CreateAndDelete, {
+	JBloomFilterPtr filter = NewJBloomFilter(IntType, BloomBlocked, 1000, 10);
+	EXPECT_NOT_NULL(filter);
+	EXPECT_NUM_EQUAL(filter->hashCount, 7, int);
+	EXPECT_NUM_EQUAL((int)((unsigned long)filter->blocks % JBLOOM_BLOCK_SIZE), 0, int);
+	EXPECT_NUM_EQUAL(DeleteJBloomFilter(&filter), DeleteSuccess, int);
+	EXPECT_NULL(filter);
+
+	EXPECT_NULL(NewJBloomFilter(Unknown, BloomBlocked, 1000, 10));
+	EXPECT_NULL(NewJBloomFilter(IntType, BloomBlocked, 1000, 0));
+	EXPECT_NUM_EQUAL(DeleteJBloomFilter(NULL), DeleteFail, int);
+})
+
+TEST(BloomFilter_INT, Blocked, {
+	JBloomFilterPtr filter = NewJBloomFilter(IntType, BloomBlocked, 1000, 10);
+	int index = 0;
+	int key = 0;
+	int positiveCount = 0;
+
+	for(index = 0; index < 1000; index++)
+	{
+		key = index * 2;
+		JBloomFilterAdd(filter, &key);
+	}
+
+	// 추가한 키는 항상 있을 수 있다고 답한다.
+	for(index = 0; index < 1000; index++)
+	{
+		key = index * 2;
+		EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, &key), FindSuccess, int);
+	}
+
+	// 키 당 10 칸이면 거짓 양성은 몇 % 이내여야 한다.
+	for(index = 0; index < 10000; index++)
+	{
+		key = index * 2 + 1;
+		if(JBloomFilterMayContain(filter, &key) == FindSuccess) positiveCount++;
+	}
+	EXPECT_NUM_EQUAL(positiveCount < 500, 1, int);
+	EXPECT_NUM_EQUAL((int)filter->queryCount, 11000, int);
+	EXPECT_NUM_EQUAL((int)filter->negativeCount, 10000 - positiveCount, int);
+
+	// 블록 방식은 삭제를 반영하지 않는다.
+	key = 0;
+	JBloomFilterRemove(filter, &key);
+	EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, &key), FindSuccess, int);
+
+	JBloomFilterClear(filter);
+	EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, &key), FindFail, int);
+	EXPECT_NUM_EQUAL((int)filter->queryCount, 1, int);
+
+	DeleteJBloomFilter(&filter);
+})
+
+TEST(BloomFilter_INT, Counting, {
+	JBloomFilterPtr filter = NewJBloomFilter(IntType, BloomCounting, 1000, 10);
+	int index = 0;
+	int key = 0;
+	int positiveCount = 0;
+
+	for(index = 0; index < 1000; index++) JBloomFilterAdd(filter, &index);
+	for(index = 0; index < 1000; index += 2) JBloomFilterRemove(filter, &index);
+
+	// 남은 키는 항상 있을 수 있다고 답하고, 삭제한 키는 대부분 없다고 답한다.
+	for(index = 1; index < 1000; index += 2)
+	{
+		EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, &index), FindSuccess, int);
+	}
+	for(key = 0; key < 1000; key += 2)
+	{
+		if(JBloomFilterMayContain(filter, &key) == FindSuccess) positiveCount++;
+	}
+	EXPECT_NUM_EQUAL(positiveCount < 25, 1, int);
+
+	DeleteJBloomFilter(&filter);
+})
+
+TEST(BloomFilter_STRING, AttachTree, {
+	JAVLTreePtr tree = NewJAVLTree(StringType);
+	JBloomFilterPtr filter = NewJBloomFilter(StringType, BloomCounting, 100, 10);
+	JBloomFilterPtr intFilter = NewJBloomFilter(IntType, BloomBlocked, 100, 10);
+	char keys[5][8];
+	char missingKey[8] = "fig";
+	char *batchKeys[3];
+	JNodePtr results[3];
+	int index = 0;
+
+	strcpy(keys[0], "apple");
+	strcpy(keys[1], "banana");
+	strcpy(keys[2], "cherry");
+	strcpy(keys[3], "durian");
+	strcpy(keys[4], "elder");
+
+	// 연결하기 전에 추가한 키도 연결할 때 Bloom Filter 에 추가된다.
+	JAVLTreeAddNode(tree, keys[0]);
+	JAVLTreeAddNode(tree, keys[1]);
+	EXPECT_NULL(JAVLTreeAttachBloomFilter(tree, intFilter));
+	EXPECT_NOT_NULL(JAVLTreeAttachBloomFilter(tree, filter));
+	for(index = 2; index < 5; index++) JAVLTreeAddNode(tree, keys[index]);
+
+	for(index = 0; index < 5; index++)
+	{
+		EXPECT_NOT_NULL(JAVLTreeFindNode(tree, keys[index]));
+	}
+	EXPECT_NULL(JAVLTreeFindNode(tree, missingKey));
+	EXPECT_NUM_EQUAL((int)filter->queryCount, 6, int);
+	EXPECT_NUM_EQUAL((int)(filter->negativeCount + filter->falsePositiveCount), 1, int);
+
+	// 삭제한 키는 Bloom Filter 에서도 빠지므로 트리를 내려가지 않는다.
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, keys[2]), DeleteSuccess, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, keys[2]));
+	EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, keys[2]), FindFail, int);
+	EXPECT_NUM_EQUAL(JAVLTreePopMin(tree) == keys[0], 1, int);
+	EXPECT_NUM_EQUAL(JBloomFilterMayContain(filter, keys[0]), FindFail, int);
+
+	batchKeys[0] = keys[1];
+	batchKeys[1] = keys[2];
+	batchKeys[2] = missingKey;
+	EXPECT_NUM_EQUAL(JAVLTreeFindBatch(tree, (void**)batchKeys, 3, results), 1, int);
+	EXPECT_NUM_EQUAL(results[0] != NULL && results[1] == NULL && results[2] == NULL, 1, int);
+	EXPECT_NUM_EQUAL(JBloomFilterGetFalsePositiveRate(filter) <= 1.0, 1, int);
+
+	// 연결을 해제하면 Bloom Filter 를 확인하지 않는다.
+	unsigned long long queryCount = filter->queryCount;
+	EXPECT_NOT_NULL(JAVLTreeAttachBloomFilter(tree, NULL));
+	EXPECT_NOT_NULL(JAVLTreeFindNode(tree, keys[1]));
+	EXPECT_NUM_EQUAL((int)(filter->queryCount == queryCount), 1, int);
+
+	DeleteJAVLTree(&tree);
+	DeleteJBloomFilter(&filter);
+	DeleteJBloomFilter(&intFilter);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Lookup Cache Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(LookupCache, CreateAndDelete, {
+	JLookupCachePtr cache = NewJLookupCache(IntType, 100);
+	EXPECT_NOT_NULL(cache);
+	// 2 의 거듭제곱으로 올림 (64 집합 * 2 항목)
+	EXPECT_NUM_EQUAL((int)cache->setMask, 63, int);
+	EXPECT_NUM_EQUAL((int)((unsigned long)cache->entries % JLOOKUP_CACHE_ALIGNMENT), 0, int);
+	EXPECT_NUM_EQUAL(DeleteJLookupCache(&cache), DeleteSuccess, int);
+	EXPECT_NULL(cache);
+
+	EXPECT_NULL(NewJLookupCache(Unknown, 100));
+	EXPECT_NULL(NewJLookupCache(IntType, 0));
+	EXPECT_NUM_EQUAL(DeleteJLookupCache(NULL), DeleteFail, int);
+})
+
+TEST(LookupCache_INT, AttachTree, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JLookupCachePtr cache = NewJLookupCache(IntType, 2);
+	JLookupCachePtr charCache = NewJLookupCache(CharType, 2);
+	int keys[100];
+	int otherKey = 10;
+	int index = 0;
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		JAVLTreeAddNode(tree, &keys[index]);
+	}
+	EXPECT_NULL(JAVLTreeAttachLookupCache(tree, charCache));
+	EXPECT_NOT_NULL(JAVLTreeAttachLookupCache(tree, cache));
+
+	// 처음 찾을 때는 트리를 내려가고, 다음부터는 검색 캐시에서 찾는다.
+	JNodePtr node = JAVLTreeFindNode(tree, &keys[10]);
+	EXPECT_NOT_NULL(node);
+	EXPECT_NUM_EQUAL((int)cache->missCount, 1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeFindNode(tree, &otherKey) == node, 1, int);
+	EXPECT_NUM_EQUAL((int)cache->hitCount, 1, int);
+
+	// 없는 키는 기억하지 않는다.
+	otherKey = 1000;
+	EXPECT_NULL(JAVLTreeFindNode(tree, &otherKey));
+	EXPECT_NULL(JAVLTreeFindNode(tree, &otherKey));
+	EXPECT_NUM_EQUAL((int)cache->missCount, 3, int);
+
+	// 삭제하면 항목이 지워지고, 다시 추가한 키는 새 노드를 찾는다.
+	otherKey = 10;
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &keys[10]), DeleteSuccess, int);
+	EXPECT_NULL(JLookupCacheFind(cache, &otherKey));
+	EXPECT_NULL(JAVLTreeFindNode(tree, &otherKey));
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, &otherKey));
+	node = JAVLTreeFindNode(tree, &keys[10]);
+	EXPECT_NUM_EQUAL(node != NULL && JNodeGetKey(node) == &otherKey, 1, int);
+
+	// 집합 하나(2-way)보다 많은 키를 찾아도 결과는 항상 트리와 같다.
+	for(index = 0; index < 100; index++)
+	{
+		node = JAVLTreeFindNode(tree, &keys[index]);
+		EXPECT_NUM_EQUAL(node != NULL && *((int*)JNodeGetKey(node)) == index, 1, int);
+	}
+	EXPECT_NUM_EQUAL(JAVLTreePopMin(tree) == &keys[0], 1, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, &keys[0]));
+	EXPECT_NUM_EQUAL(JLookupCacheGetHitRatio(cache) < 1.0, 1, int);
+
+	DeleteJAVLTree(&tree);
+	EXPECT_NULL(JLookupCacheFind(cache, &keys[99]));
+	DeleteJLookupCache(&cache);
+	DeleteJLookupCache(&charCache);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hash Index Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(HashIndex, CreateAndDelete, {
+	JHashIndexPtr hashIndex = NewJHashIndex(IntType, 100);
+	EXPECT_NOT_NULL(hashIndex);
+	// 2 의 거듭제곱으로 올림
+	EXPECT_NUM_EQUAL((int)hashIndex->mask, 127, int);
+	EXPECT_NUM_EQUAL(DeleteJHashIndex(&hashIndex), DeleteSuccess, int);
+	EXPECT_NULL(hashIndex);
+
+	hashIndex = NewJHashIndex(StringType, 0);
+	EXPECT_NUM_EQUAL((int)hashIndex->mask, JHASH_INDEX_DEFAULT_CAPACITY - 1, int);
+	DeleteJHashIndex(&hashIndex);
+
+	EXPECT_NULL(NewJHashIndex(Unknown, 100));
+	EXPECT_NULL(NewJHashIndex(CustomType, 100));
+	EXPECT_NUM_EQUAL(DeleteJHashIndex(NULL), DeleteFail, int);
+})
+
+TEST(HashIndex_INT, AddFindRemove, {
+	JHashIndexPtr hashIndex = NewJHashIndex(IntType, 0);
+	JNode nodes[1000];
+	int keys[1000];
+	int otherKey = 0;
+	int index = 0;
+
+	for(index = 0; index < 1000; index++)
+	{
+		keys[index] = index * 7;
+		nodes[index].key = &keys[index];
+		EXPECT_PTR_EQUAL(JHashIndexAdd(hashIndex, &nodes[index]), hashIndex);
+	}
+	// 사용 비율을 넘으면 칸 배열을 늘린다.
+	EXPECT_NUM_EQUAL((int)hashIndex->count, 1000, int);
+	EXPECT_NUM_EQUAL((hashIndex->count * 100 <= (hashIndex->mask + 1) * JHASH_INDEX_MAX_LOAD_PERCENT), 1, int);
+
+	otherKey = 70;
+	EXPECT_PTR_EQUAL(JHashIndexFind(hashIndex, &otherKey), &nodes[10]);
+	otherKey = 71;
+	EXPECT_NULL(JHashIndexFind(hashIndex, &otherKey));
+
+	// 지운 칸 뒤의 항목을 당겨도 남은 노드는 모두 찾을 수 있다.
+	for(index = 0; index < 1000; index += 3)
+	{
+		EXPECT_NUM_EQUAL(JHashIndexRemove(hashIndex, &nodes[index]), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL(JHashIndexRemove(hashIndex, &nodes[0]), DeleteFail, int);
+	for(index = 0; index < 1000; index++)
+	{
+		if(index % 3 == 0)
+		{
+			EXPECT_NULL(JHashIndexFind(hashIndex, &keys[index]));
+		}
+		else
+		{
+			EXPECT_PTR_EQUAL(JHashIndexFind(hashIndex, &keys[index]), &nodes[index]);
+		}
+	}
+
+	JHashIndexClear(hashIndex);
+	EXPECT_NUM_EQUAL((int)hashIndex->count, 0, int);
+	EXPECT_NULL(JHashIndexFind(hashIndex, &keys[1]));
+
+	DeleteJHashIndex(&hashIndex);
+})
+
+TEST(HashIndex_STRING, TreeLookup, {
+	JAVLTreeOptions options;
+	char keys[500][8];
+	int index = 0;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	options.lookup = LookupHash;
+	JAVLTreePtr tree = NewJAVLTreeEx(StringType, &options);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NOT_NULL(tree->index);
+	EXPECT_NULL(NewJAVLTreeEx(CustomType, &options));
+	options.lookup = (JAVLTreeLookup)123;
+	EXPECT_NULL(NewJAVLTreeEx(IntType, &options));
+
+	for(index = 0; index < 500; index++)
+	{
+		snprintf(keys[index], sizeof(keys[index]), "k%d", index);
+		EXPECT_NOT_NULL(JAVLTreeAddNode(tree, keys[index]));
+	}
+	EXPECT_NUM_EQUAL((int)tree->index->count, 500, int);
+	EXPECT_NUM_EQUAL(*((char*)JNodeGetKey(JAVLTreeFindNode(tree, "k42")) + 1), '4', int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, "k500"));
+
+	// 삭제, 지연 삭제, 되살리기, 꺼내기를 해도 해시 색인은 살아 있는 노드만 가진다.
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, "k0"), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, "k0"), DeleteFail, int);
+	JAVLTreeSetLazyDelete(tree, 90);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, "k1"), DeleteSuccess, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, "k1"));
+	EXPECT_NOT_NULL(JAVLTreeAddNode(tree, keys[1]));
+	EXPECT_PTR_EQUAL(JNodeGetKey(JAVLTreeFindNode(tree, "k1")), keys[1]);
+	EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, "k2"), DeleteSuccess, int);
+	JAVLTreePurgeTombstones(tree);
+	JAVLTreeSetLazyDelete(tree, 0);
+	JAVLTreePopMin(tree);
+	JAVLTreePopMax(tree);
+	EXPECT_NUM_EQUAL((int)tree->index->count, JAVLTreeGetSize(tree), int);
+	for(index = 0; index < 500; index++)
+	{
+		JNodePtr node = JAVLTreeFindNode(tree, keys[index]);
+		JNodePtr treeNode = JAVLTreeLowerBound(tree, keys[index]);
+		if(treeNode != NULL && strcmp((char*)JNodeGetKey(treeNode), keys[index]) != 0) treeNode = NULL;
+		EXPECT_PTR_EQUAL(node, treeNode);
+	}
+
+	// 범위 검색은 트리를 사용한다.
+	EXPECT_NUM_EQUAL(strcmp((char*)JNodeGetKey(JAVLTreeLowerBound(tree, "k40")), "k40"), 0, int);
+
+	EXPECT_NOT_NULL(JAVLTreeClear(tree, NULL, NULL));
+	EXPECT_NUM_EQUAL((int)tree->index->count, 0, int);
+	EXPECT_NULL(JAVLTreeFindNode(tree, "k42"));
+
+	DeleteJAVLTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interval Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(IntervalTree, CreateAndDelete, {
+	JAVLTreePtr tree = NewJIntervalTree();
+	JAVLTreePtr plainTree = NewJAVLTree(IntervalType);
+	JIntervalIterator iterator;
+
+	EXPECT_NOT_NULL(tree);
+	EXPECT_PTR_EQUAL(JIntervalTreeStab(tree, 0, &iterator), &iterator);
+	EXPECT_NULL(JIntervalIteratorNext(&iterator));
+	EXPECT_NULL(JIntervalIteratorNext(&iterator));
+	EXPECT_NUM_EQUAL(JIntervalTreeGetMaxEnd(tree, tree->root), INT_MIN, int);
+
+	// 집계 값이 없는 IntervalType 트리나 잘못된 범위는 검색할 수 없다.
+	EXPECT_NULL(JIntervalTreeStab(plainTree, 0, &iterator));
+	EXPECT_NULL(JIntervalTreeFindOverlap(tree, 5, 4, &iterator));
+	EXPECT_NULL(JIntervalTreeFindOverlap(tree, 0, 1, NULL));
+	EXPECT_NULL(JIntervalIteratorNext(NULL));
+
+	EXPECT_NUM_EQUAL(DeleteJAVLTree(&tree), DeleteSuccess, int);
+	DeleteJAVLTree(&plainTree);
+})
+
+TEST(IntervalTree, StabAndOverlap, {
+	JAVLTreePtr tree = NewJIntervalTree();
+	JIntervalIterator iterator;
+	JInterval intervals[500];
+	int isPresent[500];
+	int index = 0;
+	int round = 0;
+
+	srand(38);
+	for(index = 0; index < 500; index++)
+	{
+		intervals[index].start = rand() % 10000;
+		intervals[index].end = intervals[index].start + rand() % 300;
+		isPresent[index] = (JAVLTreeAddNode(tree, &intervals[index]) != NULL);
+	}
+
+	// 일부를 바로 삭제하고, 지연 삭제 모드에서 일부를 삭제 표시한다.
+	for(index = 0; index < 500; index += 3)
+	{
+		if(isPresent[index] == 0) continue;
+		EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &intervals[index]), DeleteSuccess, int);
+		isPresent[index] = 0;
+	}
+	JAVLTreeSetLazyDelete(tree, 90);
+	for(index = 1; index < 500; index += 7)
+	{
+		if(isPresent[index] == 0) continue;
+		EXPECT_NUM_EQUAL(JAVLTreeDeleteNodeKey(tree, &intervals[index]), DeleteSuccess, int);
+		isPresent[index] = 0;
+	}
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	for(round = 0; round < 200; round++)
+	{
+		int low = rand() % 10400 - 200;
+		int high = low + ((round % 2 == 0) ? 0 : rand() % 500);
+		int expectedCount = 0;
+		int count = 0;
+		int isOrdered = 1;
+		int isOverlapping = 1;
+		int previousStart = INT_MIN;
+		JNodePtr node = NULL;
+
+		for(index = 0; index < 500; index++)
+		{
+			if(isPresent[index] == 1 && intervals[index].start <= high && intervals[index].end >= low) expectedCount++;
+		}
+
+		if(low == high)
+		{
+			EXPECT_PTR_EQUAL(JIntervalTreeStab(tree, low, &iterator), &iterator);
+		}
+		else
+		{
+			EXPECT_PTR_EQUAL(JIntervalTreeFindOverlap(tree, low, high, &iterator), &iterator);
+		}
+
+		while((node = JIntervalIteratorNext(&iterator)) != NULL)
+		{
+			const JInterval *interval = (const JInterval*)JNodeGetKey(node);
+			if(interval->start < previousStart) isOrdered = 0;
+			if(interval->start > high || interval->end < low) isOverlapping = 0;
+			previousStart = interval->start;
+			count++;
+		}
+
+		EXPECT_NUM_EQUAL(count, expectedCount, int);
+		EXPECT_NUM_EQUAL(isOrdered, 1, int);
+		EXPECT_NUM_EQUAL(isOverlapping, 1, int);
+	}
+
+	// 구간 키로 경계 검색도 할 수 있다.
+	JInterval interval;
+	interval.start = 5000;
+	interval.end = INT_MIN;
+	JNodePtr boundNode = JAVLTreeLowerBound(tree, &interval);
+	EXPECT_NUM_EQUAL(boundNode == NULL || ((JInterval*)JNodeGetKey(boundNode))->start >= 5000, 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Buffered AVL Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(BufferedAVLTree, CreateAndDelete, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	EXPECT_NULL(NewJBufferedAVLTree(NULL, 0));
+	EXPECT_NULL(NewJBufferedAVLTree(tree, -1));
+
+	JBufferedAVLTreePtr front = NewJBufferedAVLTree(tree, 0);
+	EXPECT_NOT_NULL(front);
+	EXPECT_NUM_EQUAL(front->bufferCapacity, JINSERT_BUFFER_DEFAULT_CAPACITY, int);
+	JInsertBufferPtr buffer = NewJInsertBuffer(front);
+	EXPECT_NOT_NULL(buffer);
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&buffer), DeleteSuccess, int);
+	EXPECT_NULL(buffer);
+	EXPECT_NULL(front->buffers);
+	EXPECT_NUM_EQUAL(DeleteJBufferedAVLTree(&front), DeleteSuccess, int);
+	EXPECT_NULL(front);
+	EXPECT_NUM_EQUAL(DeleteJBufferedAVLTree(&front), DeleteFail, int);
+	DeleteJAVLTree(&tree);
+})
+
+TEST(BufferedAVLTree_INT, AddFindFlush, {
+	int keys[10];
+	int index = 0;
+	for(index = 0; index < 10; index++) keys[index] = index;
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JBufferedAVLTreePtr front = NewJBufferedAVLTree(tree, 4);
+	JInsertBufferPtr buffer = NewJInsertBuffer(front);
+	JInsertBufferPtr otherBuffer = NewJInsertBuffer(front);
+
+	// 버퍼가 찰 때까지는 공유 트리를 건드리지 않고, 검색은 버퍼에서 찾는다.
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[5]));
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[1]));
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[3]));
+	EXPECT_NULL(JInsertBufferAddKey(buffer, &keys[3]));
+	EXPECT_NOT_NULL(JInsertBufferAddKey(otherBuffer, &keys[7]));
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 0, int);
+	EXPECT_NUM_EQUAL(*((int*)buffer->keys[0]) == 1 && *((int*)buffer->keys[1]) == 3 && *((int*)buffer->keys[2]) == 5, 1, int);
+	EXPECT_PTR_EQUAL(JBufferedAVLTreeFindKey(front, &keys[3]), &keys[3]);
+	EXPECT_PTR_EQUAL(JBufferedAVLTreeFindKey(front, &keys[7]), &keys[7]);
+	EXPECT_NULL(JBufferedAVLTreeFindKey(front, &keys[8]));
+
+	// 가득 차면 한 번에 합친다.
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[2]));
+	EXPECT_NUM_EQUAL(buffer->count, 0, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 4, int);
+	EXPECT_NUM_EQUAL(front->mergeCount == 1, 1, int);
+	EXPECT_PTR_EQUAL(JBufferedAVLTreeFindKey(front, &keys[2]), &keys[2]);
+
+	// 공유 트리에 이미 있는 키는 합칠 때 건너뛴다.
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[1]));
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[9]));
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), 1, int);
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), 0, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 5, int);
+
+	// 전체 합치기와 버퍼 삭제는 남은 키를 공유 트리로 옮긴다.
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[0]));
+	EXPECT_NUM_EQUAL(JBufferedAVLTreeFlush(front), 2, int);
+	EXPECT_NOT_NULL(JInsertBufferAddKey(otherBuffer, &keys[8]));
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&otherBuffer), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 8, int);
+	EXPECT_NOT_NULL(JInsertBufferAddKey(buffer, &keys[4]));
+	DeleteJBufferedAVLTree(&front);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 9, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+
+	DeleteJAVLTree(&tree);
+})
+
+TEST(BufferedAVLTree_INT, MergeFailure, {
+	JAVLTreeOptions options;
+	JAVLTreeAllocator allocator;
+	TestAllocatorCount count;
+	int keys[6];
+	int index = 0;
+	for(index = 0; index < 6; index++) keys[index] = index;
+
+	memset(&options, 0, sizeof(JAVLTreeOptions));
+	memset(&count, 0, sizeof(TestAllocatorCount));
+	allocator.alloc = TestCountingAlloc;
+	allocator.free = TestCountingFree;
+	allocator.context = &count;
+	options.allocator = &allocator;
+
+	JAVLTreePtr tree = NewJAVLTreeEx(IntType, &options);
+	JBufferedAVLTreePtr front = NewJBufferedAVLTree(tree, 8);
+	JInsertBufferPtr buffer = NewJInsertBuffer(front);
+	JAVLTreeAddNode(tree, &keys[2]);
+	for(index = 1; index < 6; index++) JInsertBufferAddKey(buffer, &keys[index]);
+
+	// 노드를 두 개만 더 할당할 수 있게 해서 합치는 도중에 할당이 실패하게 한다.
+	// 1, 3 은 추가되고 2 는 이미 있으므로 건너뛰며, 4, 5 는 버퍼에 남는다.
+	count.allocLimit = count.allocCount + 2;
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), -1, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 3, int);
+	EXPECT_NUM_EQUAL(buffer->count, 2, int);
+	EXPECT_PTR_EQUAL(buffer->keys[0], &keys[4]);
+	EXPECT_PTR_EQUAL(JBufferedAVLTreeFindKey(front, &keys[5]), &keys[5]);
+	EXPECT_NUM_EQUAL(JBufferedAVLTreeFlush(front), -1, int);
+
+	// 합치지 못한 키가 있으면 버퍼를 삭제하지 않는다.
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&buffer), DeleteFail, int);
+	EXPECT_NOT_NULL(buffer);
+
+	count.allocLimit = 0;
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), 2, int);
+	EXPECT_NUM_EQUAL(buffer->count, 0, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 5, int);
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&buffer), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(DeleteJBufferedAVLTree(&front), DeleteSuccess, int);
+
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	DeleteJAVLTree(&tree);
+	EXPECT_NUM_EQUAL(count.allocCount, count.freeCount, int);
+})
+
+TEST(BufferedAVLTree_INT, Threads, {
+	pthread_t threads[4];
+	TestBufferWork works[4];
+	int *keys = (int*)malloc(sizeof(int) * 20000);
+	int index = 0;
+	for(index = 0; index < 20000; index++) keys[index] = index;
+
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JBufferedAVLTreePtr front = NewJBufferedAVLTree(tree, 64);
+
+	for(index = 0; index < 4; index++)
+	{
+		works[index].front = front;
+		works[index].keys = keys;
+		works[index].start = index;
+		works[index].step = 4;
+		works[index].count = 5000;
+		pthread_create(&threads[index], NULL, TestBufferInsertThread, &works[index]);
+	}
+	for(index = 0; index < 4; index++) pthread_join(threads[index], NULL);
+
+	for(index = 0; index < 4; index++)
+	{
+		EXPECT_NUM_EQUAL(works[index].count, 5000, int);
+	}
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 20000, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	EXPECT_NUM_EQUAL(front->mergeCount <= 4 * (5000 / 64 + 1), 1, int);
+	EXPECT_NULL(front->buffers);
+
+	DeleteJBufferedAVLTree(&front);
+	DeleteJAVLTree(&tree);
+	free(keys);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Ingest Queue Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(IngestQueue, CreateAndDelete, {
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	int key = 1;
+
+	EXPECT_NULL(NewJIngestQueue(NULL, 0, 0));
+	EXPECT_NULL(NewJIngestQueue(tree, 0, -1));
+
+	JIngestQueuePtr queue = NewJIngestQueue(tree, 100, 0);
+	EXPECT_NOT_NULL(queue);
+	EXPECT_NUM_EQUAL((int)queue->mask, 127, int);
+	EXPECT_NUM_EQUAL(queue->batchSize, JINGEST_QUEUE_DEFAULT_BATCH_SIZE, int);
+	EXPECT_NULL(JIngestQueueSubmit(queue, (JIngestOperation)0, &key, NULL, NULL));
+	EXPECT_NULL(JIngestQueueSubmit(queue, IngestInsert, NULL, NULL, NULL));
+
+	// 삭제할 때 남은 작업을 반영한다.
+	EXPECT_NOT_NULL(JIngestQueueSubmit(queue, IngestInsert, &key, NULL, NULL));
+	EXPECT_NUM_EQUAL(DeleteJIngestQueue(&queue), DeleteSuccess, int);
+	EXPECT_NULL(queue);
+	EXPECT_NUM_EQUAL(DeleteJIngestQueue(&queue), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 1, int);
+	DeleteJAVLTree(&tree);
+})
+
+TEST(IngestQueue_INT, SubmitAndSync, {
+	pthread_t threads[4];
+	TestIngestWork works[4];
+	TestIngestResult result;
+	int *keys = (int*)malloc(sizeof(int) * 20000);
+	int missingKey = 20000;
+	int index = 0;
+	for(index = 0; index < 20000; index++) keys[index] = index;
+	memset(&result, 0, sizeof(TestIngestResult));
+
+	// 칸이 적어서 넣는 쪽이 가득 찬 큐를 자주 만난다.
+	JAVLTreePtr tree = NewJAVLTree(IntType);
+	JIngestQueuePtr queue = NewJIngestQueue(tree, 64, 16);
+
+	for(index = 0; index < 4; index++)
+	{
+		works[index].queue = queue;
+		works[index].result = &result;
+		works[index].keys = keys;
+		works[index].start = index;
+		works[index].step = 4;
+		works[index].count = 5000;
+		pthread_create(&threads[index], NULL, TestIngestSubmitThread, &works[index]);
+	}
+	for(index = 0; index < 4; index++) pthread_join(threads[index], NULL);
+
+	JIngestQueueSync(queue);
+	EXPECT_NUM_EQUAL(result.successCounts[0], 20000, int);
+	EXPECT_NUM_EQUAL(result.failCount, 0, int);
+	EXPECT_NUM_EQUAL((queue->appliedCount == 20000), 1, int);
+
+	// 작업은 넣은 순서대로 반영되므로 같은 스레드에서 넣은 삭제 뒤의 검색은 삭제 결과를 본다.
+	for(index = 0; index < 20000; index += 2)
+	{
+		while(JIngestQueueSubmit(queue, IngestDelete, &keys[index], TestIngestCallback, &result) == NULL) sched_yield();
+	}
+	while(JIngestQueueSubmit(queue, IngestFind, &keys[0], TestIngestCallback, &result) == NULL) sched_yield();
+	while(JIngestQueueSubmit(queue, IngestInsert, &keys[1], TestIngestCallback, &result) == NULL) sched_yield();
+	while(JIngestQueueSubmit(queue, IngestFind, &missingKey, TestIngestCallback, &result) == NULL) sched_yield();
+	while(JIngestQueueSubmit(queue, IngestFind, &keys[1], TestIngestCallback, &result) == NULL) sched_yield();
+	JIngestQueueSync(queue);
+	EXPECT_NUM_EQUAL(result.successCounts[1], 10000, int);
+	EXPECT_NUM_EQUAL(result.successCounts[2], 1, int);
+	EXPECT_NUM_EQUAL(result.failCount, 3, int);
+	EXPECT_PTR_EQUAL(result.foundKey, &keys[1]);
+
+	DeleteJIngestQueue(&queue);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree), 10000, int);
+	EXPECT_NUM_EQUAL(CheckAVLNode(tree->root) > 0, 1, int);
+	DeleteJAVLTree(&tree);
+	free(keys);
+})
+
+// ---------- Char Bitmap Test ----------
+
+////////////////////////////////////////////////////////////////////////////////
+/// Char Bitmap Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(CharBitmap, CreateAndDelete, {
+	JCharBitmapPtr bitmap = NewJCharBitmap();
+	char key = 'a';
+
+	EXPECT_NOT_NULL(bitmap);
+	EXPECT_NUM_EQUAL((int)sizeof(JCharBitmap), 32, int);
+	EXPECT_NUM_EQUAL(JCharBitmapGetSize(bitmap), 0, int);
+	EXPECT_NUM_EQUAL(JCharBitmapGetMin(bitmap, &key), FindFail, int);
+	EXPECT_NUM_EQUAL(JCharBitmapFindKey(bitmap, &key), FindFail, int);
+	EXPECT_NULL(JCharBitmapAddKey(NULL, &key));
+	EXPECT_NULL(JCharBitmapAddKey(bitmap, NULL));
+	EXPECT_NUM_EQUAL(DeleteJCharBitmap(&bitmap), DeleteSuccess, int);
+	EXPECT_NULL(bitmap);
+	EXPECT_NUM_EQUAL(DeleteJCharBitmap(NULL), DeleteFail, int);
+})
+
+TEST(CharBitmap_CHAR, SameAsAVLTree, {
+	JCharBitmapPtr bitmap = NewJCharBitmap();
+	JAVLTreePtr tree = NewJAVLTree(CharType);
+	char keys[256];
+	char result = 0;
+	int index = 0;
+
+	// 음수 char 를 포함한 모든 키를 섞어서 추가, 삭제해도 AVL Tree 와 같은 결과를 낸다.
+	for(index = 0; index < 256; index++) keys[index] = (char)(index - 128);
+	for(index = 0; index < 256; index++)
+	{
+		char *key = &keys[(index * 37) % 256];
+		if(index % 3 == 0) continue;
+		EXPECT_NOT_NULL(JCharBitmapAddKey(bitmap, key));
+		JAVLTreeAddNode(tree, key);
+	}
+	EXPECT_NULL(JCharBitmapAddKey(bitmap, &keys[37]));
+	for(index = 0; index < 256; index += 5)
+	{
+		EXPECT_NUM_EQUAL(JCharBitmapDeleteKey(bitmap, &keys[index]), JAVLTreeDeleteNodeKey(tree, &keys[index]), int);
+	}
+	EXPECT_NUM_EQUAL(JCharBitmapGetSize(bitmap), JAVLTreeGetSize(tree), int);
+
+	int isSame = 1;
+	JNodePtr node = JAVLTreeGetMin(tree);
+	FindResult found = JCharBitmapGetMin(bitmap, &result);
+	for(; node != NULL; node = JNodeGetNext(node))
+	{
+		if(found != FindSuccess || result != *(char*)JNodeGetKey(node)) isSame = 0;
+		found = JCharBitmapSuccessor(bitmap, &result, &result);
+	}
+	EXPECT_NUM_EQUAL(found, FindFail, int);
+	EXPECT_NUM_EQUAL(JCharBitmapGetMax(bitmap, &result), FindSuccess, int);
+	EXPECT_NUM_EQUAL((int)result, (int)*(char*)JNodeGetKey(JAVLTreeGetMax(tree)), int);
+
+	// 경계 검색과 순위는 트리를 순서대로 훑은 결과와 같다.
+	int rank = 0;
+	for(index = 0; index < 256; index++)
+	{
+		JNodePtr bound = JAVLTreeCeiling(tree, &keys[index]);
+		if(JCharBitmapCeiling(bitmap, &keys[index], &result) != (bound != NULL ? FindSuccess : FindFail)) isSame = 0;
+		if(bound != NULL && result != *(char*)JNodeGetKey(bound)) isSame = 0;
+		bound = JAVLTreeFloor(tree, &keys[index]);
+		if(JCharBitmapFloor(bitmap, &keys[index], &result) != (bound != NULL ? FindSuccess : FindFail)) isSame = 0;
+		if(bound != NULL && result != *(char*)JNodeGetKey(bound)) isSame = 0;
+		bound = JAVLTreeSuccessor(tree, &keys[index]);
+		if(JCharBitmapSuccessor(bitmap, &keys[index], &result) != (bound != NULL ? FindSuccess : FindFail)) isSame = 0;
+		if(bound != NULL && result != *(char*)JNodeGetKey(bound)) isSame = 0;
+		bound = JAVLTreePredecessor(tree, &keys[index]);
+		if(JCharBitmapPredecessor(bitmap, &keys[index], &result) != (bound != NULL ? FindSuccess : FindFail)) isSame = 0;
+		if(bound != NULL && result != *(char*)JNodeGetKey(bound)) isSame = 0;
+
+		if(JCharBitmapRank(bitmap, &keys[index]) != rank) isSame = 0;
+		if((JAVLTreeFindNode(tree, &keys[index]) != NULL) != (JCharBitmapFindKey(bitmap, &keys[index]) == FindSuccess)) isSame = 0;
+		if(JAVLTreeFindNode(tree, &keys[index]) != NULL) rank++;
+	}
+	EXPECT_NUM_EQUAL(isSame, 1, int);
+	EXPECT_NUM_EQUAL(rank, JCharBitmapGetSize(bitmap), int);
+
+	EXPECT_NUM_EQUAL(JCharBitmapCountRange(bitmap, &keys[0], &keys[255]), rank, int);
+	EXPECT_NUM_EQUAL(JCharBitmapCountRange(bitmap, &keys[200], &keys[100]), 0, int);
+	EXPECT_NUM_EQUAL(JCharBitmapCountRange(bitmap, &keys[100], &keys[200]), JCharBitmapRank(bitmap, &keys[201]) - JCharBitmapRank(bitmap, &keys[100]), int);
+
+	JCharBitmapClear(bitmap);
+	EXPECT_NUM_EQUAL(JCharBitmapGetSize(bitmap), 0, int);
+	DeleteJCharBitmap(&bitmap);
+	DeleteJAVLTree(&tree);
+})
+
+// ---------- Small AVL Tree Test ----------
+
+////////////////////////////////////////////////////////////////////////////////
+/// Small AVL Tree Test
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(SmallAVLTree, CreateAndDelete, {
+	JSmallAVLTreePtr tree = NewJSmallAVLTree(IntType);
+	int key = 1;
+
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NUM_EQUAL((int)JSmallAVLTreeGetSize(tree), 0, int);
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 0, int);
+	EXPECT_NULL(JSmallAVLTreeGetMin(tree));
+	EXPECT_NULL(JSmallAVLTreeFindKey(tree, &key));
+	EXPECT_NUM_EQUAL(JSmallAVLTreeDeleteKey(tree, &key), DeleteFail, int);
+	EXPECT_NUM_EQUAL(DeleteJSmallAVLTree(&tree), DeleteSuccess, int);
+	EXPECT_NULL(tree);
+
+	EXPECT_NULL(NewJSmallAVLTree(IntervalType));
+	EXPECT_NUM_EQUAL(DeleteJSmallAVLTree(NULL), DeleteFail, int);
+})
+
+TEST(SmallAVLTree_INT, PromoteAndDemote, {
+	JSmallAVLTreePtr tree = NewJSmallAVLTree(IntType);
+	int keys[64];
+	int index = 0;
+
+	// 배열 모드에서는 순서와 상관없이 추가해도 정렬된 상태를 유지한다.
+	for(index = 0; index < 64; index++) keys[index] = index * 2;
+	for(index = 0; index < JSMALL_CAPACITY; index++) EXPECT_NOT_NULL(JSmallAVLTreeAddKey(tree, &keys[(index * 7) % JSMALL_CAPACITY]));
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 0, int);
+	EXPECT_NULL(JSmallAVLTreeAddKey(tree, &keys[3]));
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 0, int);
+	int isSorted = 1;
+	for(index = 0; index < JSMALL_CAPACITY; index++)
+	{
+		if(tree->keys[index] != &keys[index]) isSorted = 0;
+	}
+	EXPECT_NUM_EQUAL(isSorted, 1, int);
+
+	// 배열이 가득 찬 뒤에 추가하면 노드 기반 AVL Tree 로 바뀐다.
+	for(index = JSMALL_CAPACITY; index < 64; index++) EXPECT_NOT_NULL(JSmallAVLTreeAddKey(tree, &keys[index]));
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 1, int);
+	EXPECT_NUM_EQUAL((int)JSmallAVLTreeGetSize(tree), 64, int);
+	EXPECT_NUM_EQUAL(JAVLTreeGetSize(tree->tree), 64, int);
+	EXPECT_NUM_EQUAL(CheckBalancedTree(tree->tree), 1, int);
+	EXPECT_PTR_EQUAL(JSmallAVLTreeFindKey(tree, &keys[40]), &keys[40]);
+	EXPECT_PTR_EQUAL(JSmallAVLTreeGetMin(tree), &keys[0]);
+	EXPECT_PTR_EQUAL(JSmallAVLTreeGetMax(tree), &keys[63]);
+
+	// 경계 근처에서 추가, 삭제를 반복해도 바로 배열로 돌아가지 않는다.
+	for(index = 63; index > JSMALL_DEMOTE_SIZE; index--) EXPECT_NUM_EQUAL(JSmallAVLTreeDeleteKey(tree, &keys[index]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 1, int);
+	EXPECT_NUM_EQUAL(JSmallAVLTreeDeleteKey(tree, &keys[JSMALL_DEMOTE_SIZE]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 0, int);
+	EXPECT_NUM_EQUAL((int)JSmallAVLTreeGetSize(tree), JSMALL_DEMOTE_SIZE, int);
+
+	int isSame = 1;
+	for(index = 0; index < 64; index++)
+	{
+		int halfKey = index;
+		void *found = JSmallAVLTreeFindKey(tree, &keys[index]);
+		if((index < JSMALL_DEMOTE_SIZE) != (found == &keys[index])) isSame = 0;
+		// 홀수 키는 다음 짝수 키가 경계이다.
+		void *bound = JSmallAVLTreeLowerBound(tree, &halfKey);
+		if((index + 1) / 2 < JSMALL_DEMOTE_SIZE && bound != &keys[(index + 1) / 2]) isSame = 0;
+		if((index + 1) / 2 >= JSMALL_DEMOTE_SIZE && bound != NULL) isSame = 0;
+	}
+	EXPECT_NUM_EQUAL(isSame, 1, int);
+	EXPECT_NUM_EQUAL(JSmallAVLTreeDeleteKey(tree, &keys[63]), DeleteFail, int);
+	EXPECT_PTR_EQUAL(JSmallAVLTreeGetMax(tree), &keys[JSMALL_DEMOTE_SIZE - 1]);
+
+	DeleteJSmallAVLTree(&tree);
+})
+
+TEST(SmallAVLTree_STRING, AddFindDelete, {
+	JSmallAVLTreePtr tree = NewJSmallAVLTree(StringType);
+	char keys[40][16];
+	char key[16];
+	int index = 0;
+
+	for(index = 0; index < 40; index++)
+	{
+		snprintf(keys[index], sizeof(keys[index]), "key%02d", (index * 13) % 40);
+		EXPECT_NOT_NULL(JSmallAVLTreeAddKey(tree, keys[index]));
+	}
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 1, int);
+	EXPECT_STR_EQUAL((char*)JSmallAVLTreeGetMin(tree), "key00");
+
+	// 다른 주소의 같은 문자열로도 찾고 삭제한다.
+	for(index = 0; index < 35; index++)
+	{
+		snprintf(key, sizeof(key), "key%02d", index);
+		EXPECT_NUM_EQUAL(JSmallAVLTreeDeleteKey(tree, key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL(JSmallAVLTreeIsPromoted(tree), 0, int);
+	snprintf(key, sizeof(key), "key37");
+	EXPECT_STR_EQUAL((char*)JSmallAVLTreeFindKey(tree, key), "key37");
+	snprintf(key, sizeof(key), "key10");
+	EXPECT_STR_EQUAL((char*)JSmallAVLTreeLowerBound(tree, key), "key35");
+	EXPECT_STR_EQUAL((char*)JSmallAVLTreeGetMax(tree), "key39");
+
+	DeleteJSmallAVLTree(&tree);
+})
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main Function
 ////////////////////////////////////////////////////////////////////////////////
@@ -420,6 +3525,7 @@ int main()
 		// @ Common Test -----------------------------------------
 		Test_Node_CreateAndDeleteNode,
 		Test_AVLTree_CreateAndDeleteAVLTree,
+		Test_AVLTree_CustomCompare,
 
 		// @ INT Test -------------------------------------------
 		Test_Node_INT_SetKey,
@@ -428,6 +3534,23 @@ int main()
 		Test_AVLTree_INT_SetData,
 		Test_AVLTree_INT_GetData,
 		Test_AVLTree_INT_DeleteNodeKey,
+		Test_AVLTree_INT_BoundQuery,
+		Test_AVLTree_INT_Balance,
+		Test_AVLTree_INT_MinMax,
+		Test_AVLTree_INT_PopMinMax,
+		Test_AVLTree_INT_AddNodeHint,
+		Test_AVLTree_INT_FindNode,
+		Test_AVLTree_INT_FindBatch,
+		Test_AVLTree_INT_LazyDelete,
+		Test_AVLTree_INT_Aggregate,
+		Test_AVLTree_INT_InsertExtractNode,
+		Test_AVLTree_INT_Expire,
+		Test_AVLTree_INT_BalancePolicy,
+		Test_AVLTree_INT_RelaxedBalance,
+		Test_AVLTree_INT_OwnedKeys,
+		Test_AVLTree_INT_Allocator,
+		Test_AVLTree_INT_OwnedKeyPop,
+		Test_AVLTree_INT_Compact,
 
 		// @ CHAR Test -------------------------------------------
 		Test_Node_CHAR_SetKey,
@@ -436,6 +3559,7 @@ int main()
 		Test_AVLTree_CHAR_SetData,
 		Test_AVLTree_CHAR_GetData,
 		Test_AVLTree_CHAR_DeleteNodeKey,
+		Test_AVLTree_CHAR_BoundQuery,
 
 		// @ STRING Test -------------------------------------------
 		Test_Node_STRING_SetKey,
@@ -443,7 +3567,71 @@ int main()
 		Test_AVLTree_STRING_AddNode,
 		Test_AVLTree_STRING_SetData,
 		Test_AVLTree_STRING_GetData,
-		Test_AVLTree_STRING_DeleteNodeKey
+		Test_AVLTree_STRING_DeleteNodeKey,
+		Test_AVLTree_STRING_BoundQuery,
+		Test_AVLTree_STRING_FindBatch,
+		Test_AVLTree_STRING_OwnedKeys,
+		Test_AVLTree_STRING_Compact,
+
+		// @ Compact AVL Tree Test -------------------------------
+		Test_CompactAVLTree_CreateAndDelete,
+		Test_CompactAVLTree_INT_AddFindDelete,
+		Test_CompactAVLTree_CHAR_AddFindDelete,
+
+		// @ Chunked AVL Tree Test -------------------------------
+		Test_ChunkedAVLTree_CreateAndDelete,
+		Test_ChunkedAVLTree_INT_AddFindDelete,
+		Test_ChunkedAVLTree_STRING_AddFindDelete,
+
+		// @ Write-Ahead Log Test --------------------------------
+		Test_WAL_INT_GroupCommit,
+		Test_WAL_INT_ShortWrite,
+		Test_WAL_INT_CheckpointAndRecover,
+		Test_WAL_STRING_CheckpointAndRecover,
+
+		// @ Memory-Mapped AVL Tree Test -------------------------
+		Test_MappedAVLTree_CreateAndDelete,
+		Test_MappedAVLTree_INT_AddFindDelete,
+		Test_MappedAVLTree_INT_CorruptFile,
+		Test_MappedAVLTree_CHAR_AddFindDelete,
+
+		// @ Bloom Filter Test -----------------------------------
+		Test_BloomFilter_CreateAndDelete,
+		Test_BloomFilter_INT_Blocked,
+		Test_BloomFilter_INT_Counting,
+		Test_BloomFilter_STRING_AttachTree,
+
+		// @ Lookup Cache Test -----------------------------------
+		Test_LookupCache_CreateAndDelete,
+		Test_LookupCache_INT_AttachTree,
+
+		// @ Hash Index Test -------------------------------------
+		Test_HashIndex_CreateAndDelete,
+		Test_HashIndex_INT_AddFindRemove,
+		Test_HashIndex_STRING_TreeLookup,
+
+		// @ Interval Tree Test ----------------------------------
+		Test_IntervalTree_CreateAndDelete,
+		Test_IntervalTree_StabAndOverlap,
+
+		// @ Buffered AVL Tree Test ------------------------------
+		Test_BufferedAVLTree_CreateAndDelete,
+		Test_BufferedAVLTree_INT_AddFindFlush,
+		Test_BufferedAVLTree_INT_MergeFailure,
+		Test_BufferedAVLTree_INT_Threads,
+
+		// @ Ingest Queue Test -----------------------------------
+		Test_IngestQueue_CreateAndDelete,
+		Test_IngestQueue_INT_SubmitAndSync,
+
+		// @ Char Bitmap Test ------------------------------------
+		Test_CharBitmap_CreateAndDelete,
+		Test_CharBitmap_CHAR_SameAsAVLTree,
+
+		// @ Small AVL Tree Test ---------------------------------
+		Test_SmallAVLTree_CreateAndDelete,
+		Test_SmallAVLTree_INT_PromoteAndDemote,
+		Test_SmallAVLTree_STRING_AddFindDelete
     );
 
     RUN_ALL_TESTS();
@@ -0,0 +1,420 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <strings.h>
+#include <utility>
+#include <vector>
+
+#include "../include/javltree.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Test
+////////////////////////////////////////////////////////////////////////////////
+
+// 실패한 검사 수 (0 이 아니면 main 이 실패로 종료)
+static int failCount = 0;
+
+// 조건이 거짓이면 위치를 출력하고 실패 수를 늘린다.
+#define EXPECT(condition) \
+	do { \
+		if(!(condition)) { \
+			printf("%s:%d: 실패 (%s)\n", __FILE__, __LINE__, #condition); \
+			failCount++; \
+		} \
+	} while(0)
+
+// 할당기로 할당한 전체 횟수와 아직 해제하지 않은 개수
+static long allocateCount = 0;
+static long liveCount = 0;
+
+/**
+ * @class CountingAllocator
+ * @brief 할당 횟수와 해제하지 않은 개수를 세는 할당기 (노드 누수, 불필요한 할당 검사용)
+ */
+template <class T>
+struct CountingAllocator
+{
+	typedef T value_type;
+
+	CountingAllocator() {}
+	template <class U>
+	CountingAllocator(const CountingAllocator<U>&) {}
+
+	T* allocate(std::size_t count)
+	{
+		allocateCount++;
+		liveCount++;
+		return static_cast<T*>(::operator new(count * sizeof(T)));
+	}
+
+	void deallocate(T *pointer, std::size_t)
+	{
+		liveCount--;
+		::operator delete(pointer);
+	}
+};
+
+template <class T, class U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+// 생성 횟수가 지정한 값에 도달하면 예외를 던지는 값
+struct ThrowingValue
+{
+	static int constructCount;
+	static int throwAt;
+	int value;
+
+	ThrowingValue(int newValue) : value(newValue)
+	{
+		if(++constructCount == throwAt) throw std::runtime_error("ThrowingValue");
+	}
+};
+
+int ThrowingValue::constructCount = 0;
+int ThrowingValue::throwAt = -1;
+
+// 대소문자를 구분하지 않는 문자열 비교 함수
+struct CaseInsensitiveLess
+{
+	bool operator()(const std::string &left, const std::string &right) const
+	{
+		return strcasecmp(left.c_str(), right.c_str()) < 0;
+	}
+};
+
+typedef javl::tree<int, int, std::less<int>, CountingAllocator<std::pair<const int, int> > > CountingTree;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static bool IsSameAsMap(const Tree &tree, const Map &map)
+ * @brief javl::tree 와 std::map 의 크기와 순서대로의 키, 값이 모두 같은지 검사하는 함수
+ * @param tree 검사할 트리(입력, 읽기 전용)
+ * @param map 비교할 std::map(입력, 읽기 전용)
+ * @return 같으면 true, 다르면 false 반환
+ */
+template <class Tree, class Map>
+static bool IsSameAsMap(const Tree &tree, const Map &map)
+{
+	if(tree.size() != map.size()) return false;
+	return std::equal(map.begin(), map.end(), tree.begin(), [](const typename Map::value_type &left, const typename Tree::value_type &right) { return left.first == right.first && left.second == right.second; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// C++ Wrapper Test
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void TestEmplaceDuplicate()
+ * @brief 중복 키의 emplace, try_emplace, operator[] 가 노드를 남기지 않는지 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestEmplaceDuplicate()
+{
+	{
+		CountingTree tree;
+
+		EXPECT(tree.emplace(1, 10).second == true);
+		EXPECT(liveCount == 1);
+
+		// emplace 는 키를 알기 위해 노드를 만들지만, 중복이면 바로 해제한다.
+		std::pair<CountingTree::iterator, bool> result = tree.emplace(1, 20);
+		EXPECT(result.second == false);
+		EXPECT(result.first->second == 10);
+		EXPECT(liveCount == 1);
+
+		// try_emplace 와 operator[] 는 키가 있으면 할당하지 않는다.
+		long count = allocateCount;
+		result = tree.try_emplace(1, 30);
+		EXPECT(result.second == false);
+		EXPECT(result.first->second == 10);
+		EXPECT(tree[1] == 10);
+		EXPECT(allocateCount == count);
+		EXPECT(tree.size() == 1);
+
+		EXPECT(tree.try_emplace(2, 20).second == true);
+		EXPECT(tree.insert(std::make_pair(2, 40)).second == false);
+		EXPECT(tree.size() == 2);
+		EXPECT(liveCount == 2);
+	}
+	EXPECT(liveCount == 0);
+}
+
+/**
+ * @fn static void TestSubscriptAndAt()
+ * @brief operator[] 의 기본값 생성과 at() 의 조회, 예외를 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestSubscriptAndAt()
+{
+	javl::tree<int, int> tree;
+
+	EXPECT(tree[5] == 0);
+	EXPECT(tree.size() == 1);
+	tree[5] = 50;
+	tree[7] += 70;
+	EXPECT(tree.at(5) == 50);
+	EXPECT(tree.at(7) == 70);
+
+	const javl::tree<int, int> &constTree = tree;
+	EXPECT(constTree.at(7) == 70);
+
+	bool isThrown = false;
+	try { tree.at(6); }
+	catch(const std::out_of_range&) { isThrown = true; }
+	EXPECT(isThrown == true);
+
+	isThrown = false;
+	try { constTree.at(6); }
+	catch(const std::out_of_range&) { isThrown = true; }
+	EXPECT(isThrown == true);
+	EXPECT(tree.size() == 2);
+}
+
+/**
+ * @fn static void TestEraseAndReverse()
+ * @brief erase(iterator) 의 반환값, --end(), 역방향 순회를 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestEraseAndReverse()
+{
+	javl::tree<int, int> tree;
+	int key = 0;
+
+	// 비어 있으면 begin() 과 end() 가 같고, 역방향 순회도 비어 있다.
+	EXPECT(tree.begin() == tree.end());
+	EXPECT(tree.rbegin() == tree.rend());
+
+	for(key = 0; key < 10; key++) tree.emplace(key, key * 10);
+
+	javl::tree<int, int>::iterator last = tree.end();
+	--last;
+	EXPECT(last->first == 9);
+	EXPECT((--tree.end())->second == 90);
+
+	std::vector<int> reverseKeys;
+	for(javl::tree<int, int>::reverse_iterator iterator = tree.rbegin(); iterator != tree.rend(); ++iterator) reverseKeys.push_back(iterator->first);
+	EXPECT(reverseKeys.size() == 10);
+	EXPECT(std::is_sorted(reverseKeys.rbegin(), reverseKeys.rend()) == true);
+	EXPECT(reverseKeys.front() == 9 && reverseKeys.back() == 0);
+
+	// 삭제한 값의 다음 반복자를 반환한다.
+	javl::tree<int, int>::iterator next = tree.erase(tree.find(4));
+	EXPECT(next != tree.end() && next->first == 5);
+	EXPECT(tree.find(4) == tree.end());
+
+	next = tree.erase(last);
+	EXPECT(next == tree.end());
+	EXPECT((--tree.end())->first == 8);
+
+	// 짝수 키만 남긴다.
+	for(javl::tree<int, int>::iterator iterator = tree.begin(); iterator != tree.end();)
+	{
+		if(iterator->first % 2 != 0) iterator = tree.erase(iterator);
+		else ++iterator;
+	}
+	EXPECT(tree.size() == 4);
+	EXPECT(tree.erase(0) == 1);
+	EXPECT(tree.erase(0) == 0);
+	EXPECT(tree.begin()->first == 2);
+
+	next = tree.erase(tree.begin(), tree.end());
+	EXPECT(next == tree.end());
+	EXPECT(tree.empty() == true);
+}
+
+/**
+ * @fn static void TestBoundsSameAsMap()
+ * @brief 무작위 데이터에서 삽입, 삭제, lower_bound, upper_bound, equal_range 결과가 std::map 과 같은지 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestBoundsSameAsMap()
+{
+	javl::tree<int, int> tree;
+	std::map<int, int> map;
+	int index = 0;
+
+	srand(3939);
+	for(index = 0; index < 20000; index++)
+	{
+		int key = rand() % 5000;
+		if(rand() % 3 == 0)
+		{
+			EXPECT(tree.erase(key) == map.erase(key));
+		}
+		else
+		{
+			EXPECT(tree.emplace(key, index).second == map.emplace(key, index).second);
+		}
+	}
+	EXPECT(IsSameAsMap(tree, map) == true);
+
+	for(index = -10; index < 5010; index++)
+	{
+		javl::tree<int, int>::iterator lower = tree.lower_bound(index);
+		javl::tree<int, int>::iterator upper = tree.upper_bound(index);
+		std::map<int, int>::iterator mapLower = map.lower_bound(index);
+		std::map<int, int>::iterator mapUpper = map.upper_bound(index);
+
+		EXPECT((lower == tree.end()) == (mapLower == map.end()));
+		EXPECT((upper == tree.end()) == (mapUpper == map.end()));
+		if(lower != tree.end() && mapLower != map.end()) EXPECT(lower->first == mapLower->first);
+		if(upper != tree.end() && mapUpper != map.end()) EXPECT(upper->first == mapUpper->first);
+
+		std::pair<javl::tree<int, int>::iterator, javl::tree<int, int>::iterator> range = tree.equal_range(index);
+		EXPECT(std::distance(range.first, range.second) == std::distance(map.equal_range(index).first, map.equal_range(index).second));
+		EXPECT(tree.count(index) == map.count(index));
+	}
+}
+
+/**
+ * @fn static void TestMove()
+ * @brief 이동 생성, 이동 대입 후 원본 객체의 상태와 노드 해제를 검사하는 함수
+ * 이동된 객체는 비어 있고, 소멸하거나 다른 객체를 이동 대입받을 수 있어야 한다.
+ * @return 반환값 없음
+ */
+static void TestMove()
+{
+	{
+		CountingTree tree;
+		int key = 0;
+		for(key = 0; key < 100; key++) tree.emplace(key, key);
+
+		CountingTree movedTree(std::move(tree));
+		EXPECT(movedTree.size() == 100);
+		EXPECT(movedTree.find(50) != movedTree.end());
+		EXPECT(tree.size() == 0);
+		EXPECT(tree.empty() == true);
+		EXPECT(tree.begin() == tree.end());
+		EXPECT(tree.find(50) == tree.end());
+		EXPECT(tree.count(50) == 0);
+		EXPECT(tree.native_handle() == NULL);
+
+		// 이동 대입은 기존 노드를 모두 해제한다.
+		CountingTree otherTree;
+		for(key = 0; key < 10; key++) otherTree.emplace(key + 1000, key);
+		otherTree = std::move(movedTree);
+		EXPECT(otherTree.size() == 100);
+		EXPECT(otherTree.find(1000) == otherTree.end());
+		EXPECT(movedTree.empty() == true);
+		EXPECT(movedTree.native_handle() == NULL);
+		EXPECT(liveCount == 100);
+
+		// 이동된 객체에 다시 이동 대입하면 다시 사용할 수 있다.
+		tree = CountingTree();
+		EXPECT(tree.emplace(1, 1).second == true);
+		EXPECT(tree.size() == 1);
+		EXPECT(liveCount == 101);
+	}
+	EXPECT(liveCount == 0);
+}
+
+/**
+ * @fn static void TestThrowingConstructor()
+ * @brief emplace 중 값 생성자가 예외를 던지면 트리가 바뀌지 않고 노드가 해제되는지 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestThrowingConstructor()
+{
+	{
+		javl::tree<int, ThrowingValue, std::less<int>, CountingAllocator<std::pair<const int, ThrowingValue> > > tree;
+		int key = 0;
+
+		ThrowingValue::constructCount = 0;
+		ThrowingValue::throwAt = 6;
+		for(key = 0; key < 5; key++) tree.emplace(key, key);
+		EXPECT(liveCount == 5);
+
+		bool isThrown = false;
+		try { tree.emplace(100, 100); }
+		catch(const std::runtime_error&) { isThrown = true; }
+		EXPECT(isThrown == true);
+		EXPECT(tree.size() == 5);
+		EXPECT(tree.find(100) == tree.end());
+		EXPECT(liveCount == 5);
+
+		// try_emplace 의 예외도 같다.
+		ThrowingValue::constructCount = 0;
+		ThrowingValue::throwAt = 1;
+		isThrown = false;
+		try { tree.try_emplace(200, 200); }
+		catch(const std::runtime_error&) { isThrown = true; }
+		EXPECT(isThrown == true);
+		EXPECT(tree.size() == 5);
+		EXPECT(liveCount == 5);
+
+		ThrowingValue::throwAt = -1;
+		EXPECT(tree.try_emplace(200, 200).second == true);
+		EXPECT(tree.at(200).value == 200);
+	}
+	EXPECT(liveCount == 0);
+}
+
+/**
+ * @fn static void TestCustomCompare()
+ * @brief std::greater 와 문자열 비교 함수가 CustomType 비교 함수를 거쳐 순서와 조회에 쓰이는지 검사하는 함수
+ * @return 반환값 없음
+ */
+static void TestCustomCompare()
+{
+	javl::tree<int, int, std::greater<int> > descendingTree;
+	std::map<int, int, std::greater<int> > descendingMap;
+	int key = 0;
+
+	for(key = 0; key < 1000; key++)
+	{
+		int value = (key * 7919) % 1000;
+		descendingTree.emplace(value, key);
+		descendingMap.emplace(value, key);
+	}
+	EXPECT(IsSameAsMap(descendingTree, descendingMap) == true);
+	EXPECT(descendingTree.begin()->first == 999);
+	EXPECT((--descendingTree.end())->first == 0);
+	EXPECT(descendingTree.lower_bound(500)->first == 500);
+	EXPECT(descendingTree.upper_bound(500)->first == 499);
+
+	javl::tree<std::string, int, CaseInsensitiveLess> stringTree;
+	EXPECT(stringTree.emplace("Banana", 1).second == true);
+	EXPECT(stringTree.emplace("apple", 2).second == true);
+	EXPECT(stringTree.emplace("cherry", 3).second == true);
+	EXPECT(stringTree.emplace("APPLE", 4).second == false);
+	EXPECT(stringTree.size() == 3);
+	EXPECT(stringTree.at("BANANA") == 1);
+	EXPECT(stringTree.find("Cherry") != stringTree.end());
+	EXPECT(stringTree.begin()->first == "apple");
+	EXPECT((--stringTree.end())->first == "cherry");
+	EXPECT(stringTree.erase("aPPle") == 1);
+	EXPECT(stringTree.begin()->first == "Banana");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	// @ C++ Wrapper Test -------------------------------------------
+	TestEmplaceDuplicate();
+	TestSubscriptAndAt();
+	TestEraseAndReverse();
+	TestBoundsSameAsMap();
+	TestMove();
+	TestThrowingConstructor();
+	TestCustomCompare();
+
+	if(failCount > 0)
+	{
+		printf("[ C++ 래퍼 테스트 실패 수: %d 개 ]\n", failCount);
+		return 1;
+	}
+	printf("[ C++ 래퍼 테스트 성공 ]\n");
+	return 0;
+}